@@ -0,0 +1,192 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host frame-time benchmark: runs the shared test_apps/main/bench scenes
+ * against the RAM framebuffer and writes the JSON report.
+ *
+ *   gfx_bench [-f frames] [-w warmup] [-m frame_ms] [-W width] [-H height]
+ *             [--full-frame] [-s scene] [-o report.json] [-t trace.json]
+ *
+ * Timers run on a virtual clock advanced by frame_ms per frame, so animation
+ * progress does not depend on host speed (-m 0 uses the wall clock).
+ *
+ * Compare two reports with scripts/bench_compare.py. -t writes the tail of the
+ * run as Chrome trace-event JSON (needs -DCONFIG_GFX_TRACE=1).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gfx.h"
+#include "gfx_host_fb.h"
+#include "bench/bench.h"
+
+#define BENCH_DEFAULT_FRAMES    300
+#define BENCH_DEFAULT_WARMUP    2
+#define BENCH_DEFAULT_FRAME_MS  33
+#define BENCH_DEFAULT_H_RES     320
+#define BENCH_DEFAULT_V_RES     240
+
+static void trace_write(const char *data, size_t len, void *user_data)
+{
+    fwrite(data, 1, len, (FILE *)user_data);
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [-f frames] [-w warmup] [-m frame_ms] [-W width] [-H height] [--full-frame] [-s scene] [-o report.json] [-t trace.json]\n",
+            prog);
+}
+
+int main(int argc, char **argv)
+{
+    bench_config_t cfg = {
+        .frames = BENCH_DEFAULT_FRAMES,
+        .warmup_frames = BENCH_DEFAULT_WARMUP,
+        .frame_ms = BENCH_DEFAULT_FRAME_MS,
+        .target = "linux",
+    };
+    uint32_t h_res = BENCH_DEFAULT_H_RES;
+    uint32_t v_res = BENCH_DEFAULT_V_RES;
+    bool full_frame = false;
+    const char *only = NULL;
+    const char *out_path = NULL;
+    const char *trace_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *val = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--full-frame") == 0) {
+            full_frame = true;
+            continue;
+        }
+        if (val == NULL) {
+            usage(argv[0]);
+            return 2;
+        }
+        if (strcmp(arg, "-f") == 0) {
+            cfg.frames = (uint32_t)strtoul(val, NULL, 0);
+        } else if (strcmp(arg, "-w") == 0) {
+            cfg.warmup_frames = (uint32_t)strtoul(val, NULL, 0);
+        } else if (strcmp(arg, "-m") == 0) {
+            cfg.frame_ms = (uint32_t)strtoul(val, NULL, 0);
+        } else if (strcmp(arg, "-W") == 0) {
+            h_res = (uint32_t)strtoul(val, NULL, 0);
+        } else if (strcmp(arg, "-H") == 0) {
+            v_res = (uint32_t)strtoul(val, NULL, 0);
+        } else if (strcmp(arg, "-s") == 0) {
+            only = val;
+        } else if (strcmp(arg, "-o") == 0) {
+            out_path = val;
+        } else if (strcmp(arg, "-t") == 0) {
+            trace_path = val;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+        i++;
+    }
+    if (cfg.frames == 0 || h_res == 0 || v_res == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    gfx_log_set_level_all(GFX_LOG_LEVEL_WARN);
+
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    if (handle == NULL) {
+        fprintf(stderr, "gfx_emote_init failed\n");
+        return 1;
+    }
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    if (gfx_host_fb_init(&fb, h_res, v_res, &disp_cfg) != ESP_OK) {
+        fprintf(stderr, "gfx_host_fb_init failed\n");
+        gfx_emote_deinit(handle);
+        return 1;
+    }
+    disp_cfg.flags.double_buffer = 1;
+    disp_cfg.flags.full_frame = full_frame;
+    if (full_frame) {
+        disp_cfg.buffers.buf_pixels = h_res * v_res;
+    }
+    fb.full_frame = full_frame;
+
+    gfx_emote_lock(handle);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    if (disp != NULL) {
+        gfx_disp_set_bg_color(disp, GFX_COLOR_HEX(0x181818));
+    }
+    gfx_emote_unlock(handle);
+    if (disp == NULL) {
+        fprintf(stderr, "gfx_disp_add failed\n");
+        gfx_emote_deinit(handle);
+        gfx_host_fb_deinit(&fb);
+        return 1;
+    }
+
+    bench_result_t *results = calloc(bench_scene_count, sizeof(bench_result_t));
+    size_t result_count = 0;
+    int rc = 0;
+
+    for (size_t i = 0; results != NULL && i < bench_scene_count; i++) {
+        if (only != NULL && strcmp(only, bench_scenes[i].name) != 0) {
+            continue;
+        }
+        if (bench_run_scene(&bench_scenes[i], handle, disp, &cfg, &results[result_count]) != ESP_OK) {
+            fprintf(stderr, "scene %s failed\n", bench_scenes[i].name);
+            rc = 1;
+            continue;
+        }
+        result_count++;
+    }
+    if (results == NULL || (only != NULL && result_count == 0 && rc == 0)) {
+        fprintf(stderr, "%s\n", results == NULL ? "out of memory" : "no such scene");
+        rc = 1;
+    }
+
+    if (result_count > 0) {
+        FILE *out = (out_path != NULL) ? fopen(out_path, "w") : stdout;
+        if (out == NULL) {
+            perror(out_path);
+            rc = 1;
+        } else {
+            bench_report_write(out, &cfg, disp, results, result_count);
+            if (out != stdout) {
+                fclose(out);
+            }
+        }
+    }
+
+    if (trace_path != NULL) {
+        FILE *trace = fopen(trace_path, "w");
+        if (trace == NULL) {
+            perror(trace_path);
+            rc = 1;
+        } else {
+            esp_err_t ret = gfx_trace_dump(trace_write, trace);
+            fclose(trace);
+            if (ret != ESP_OK) {
+                fprintf(stderr, "gfx_trace_dump: %s\n", esp_err_to_name(ret));
+                rc = 1;
+            }
+        }
+    }
+
+    free(results);
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return rc;
+}
@@ -0,0 +1,98 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gfx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * In-memory display backend for the host build. Every flushed chunk is
+ * copied into `pixels` (native RGB565 order, h_res * v_res) and completed
+ * immediately with gfx_disp_flush_ready().
+ */
+typedef struct {
+    uint16_t *pixels;           /**< Emulated panel memory */
+    uint32_t h_res;
+    uint32_t v_res;
+    bool full_frame;            /**< Display renders into full-screen buffers; every flush shows the whole buffer */
+    bool swap;                  /**< Display swaps color bytes; undone by gfx_host_fb_get_pixel() */
+    uint32_t flush_count;       /**< Flush callbacks since init; written by the render task, read with gfx_host_fb_flush_count() */
+    uint32_t frame_count;       /**< Flushes that ended a frame (gfx_disp_is_flushing_last); read with gfx_host_fb_frame_count() */
+    uint64_t flush_pixels;      /**< Pixels copied since init */
+} gfx_host_fb_t;
+
+/**********************
+ *   PUBLIC API
+ **********************/
+
+/**
+ * @brief Allocate the panel memory and fill in a display config that flushes into it
+ *
+ * @param fb Backend to initialize
+ * @param h_res Horizontal resolution
+ * @param v_res Vertical resolution
+ * @param out_cfg Display config to pass to gfx_disp_add(); buffers and flags may be edited
+ *                before that, but full_frame/swap must then be mirrored in fb
+ * @return ESP_OK on success, ESP_ERR_NO_MEM on allocation failure
+ */
+esp_err_t gfx_host_fb_init(gfx_host_fb_t *fb, uint32_t h_res, uint32_t v_res, gfx_disp_config_t *out_cfg);
+
+/**
+ * @brief Free the panel memory
+ */
+void gfx_host_fb_deinit(gfx_host_fb_t *fb);
+
+/**
+ * @brief gfx_disp flush callback; user_data must point at the gfx_host_fb_t
+ */
+void gfx_host_fb_flush_cb(gfx_disp_t *disp, int x1, int y1, int x2, int y2, const void *data);
+
+/**
+ * @brief Read one pixel as RGB565 (byte swap undone)
+ */
+uint16_t gfx_host_fb_get_pixel(const gfx_host_fb_t *fb, uint32_t x, uint32_t y);
+
+/**
+ * @brief FNV-1a hash of the panel memory, for golden-image regression checks
+ */
+uint32_t gfx_host_fb_checksum(const gfx_host_fb_t *fb);
+
+/**
+ * @brief Atomically read frame_count from any task
+ */
+uint32_t gfx_host_fb_frame_count(const gfx_host_fb_t *fb);
+
+/**
+ * @brief Atomically read flush_count from any task
+ */
+uint32_t gfx_host_fb_flush_count(const gfx_host_fb_t *fb);
+
+/**
+ * @brief Block until frame_count reaches at least `frames` or timeout_ms elapses
+ * @return true if the frame count was reached
+ */
+bool gfx_host_fb_wait_frames(gfx_host_fb_t *fb, uint32_t frames, uint32_t timeout_ms);
+
+/**
+ * @brief Write the panel memory as a binary PPM (P6) image
+ * @return ESP_OK on success, ESP_FAIL if the file cannot be written
+ */
+esp_err_t gfx_host_fb_write_ppm(const gfx_host_fb_t *fb, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
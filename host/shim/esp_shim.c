@@ -0,0 +1,138 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <malloc.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "lvgl.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Pretend heap size, so free-size readings shrink as the process allocates */
+#define SHIM_HEAP_SIZE  ((size_t)256 * 1024 * 1024)
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static int64_t s_boot_time_us;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static int64_t shim_monotonic_us(void);
+static void shim_boot(void) __attribute__((constructor));
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static int64_t shim_monotonic_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/** esp_timer counts from boot; the host counts from process start */
+static void shim_boot(void)
+{
+    s_boot_time_us = shim_monotonic_us();
+}
+
+/**********************
+ *   PUBLIC FUNCTIONS
+ **********************/
+
+int64_t esp_timer_get_time(void)
+{
+    return shim_monotonic_us() - s_boot_time_us;
+}
+
+const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+    case ESP_OK:                    return "ESP_OK";
+    case ESP_FAIL:                  return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:            return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:       return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE:     return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:      return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:         return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED:     return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:           return "ESP_ERR_TIMEOUT";
+    case ESP_ERR_INVALID_RESPONSE:  return "ESP_ERR_INVALID_RESPONSE";
+    case ESP_ERR_INVALID_CRC:       return "ESP_ERR_INVALID_CRC";
+    case ESP_ERR_INVALID_VERSION:   return "ESP_ERR_INVALID_VERSION";
+    default:                        return "UNKNOWN ERROR";
+    }
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void)caps;
+    return malloc(size);
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return calloc(n, size);
+}
+
+void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps)
+{
+    (void)caps;
+    return realloc(ptr, size);
+}
+
+void *heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+    (void)caps;
+    /* aligned_alloc wants a size that is a multiple of the alignment */
+    return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+void heap_caps_free(void *ptr)
+{
+    free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    struct mallinfo2 mi = mallinfo2();
+    size_t used = mi.uordblks + mi.hblkhd;
+
+    (void)caps;
+    return (used < SHIM_HEAP_SIZE) ? SHIM_HEAP_SIZE - used : 0;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t *font, lv_font_glyph_dsc_t *dsc_out,
+                                   uint32_t unicode_letter, uint32_t unicode_letter_next)
+{
+    (void)font;
+    (void)dsc_out;
+    (void)unicode_letter;
+    (void)unicode_letter_next;
+    return false;
+}
+
+const void *lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t *g_dsc, lv_draw_buf_t *draw_buf)
+{
+    (void)g_dsc;
+    (void)draw_buf;
+    return NULL;
+}
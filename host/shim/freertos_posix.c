@@ -0,0 +1,457 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct tskTaskControlBlock {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+    char name[configMAX_TASK_NAME_LEN];
+};
+
+struct EventGroupDef_t {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    EventBits_t bits;
+};
+
+typedef enum {
+    SEM_KIND_COUNTING,
+    SEM_KIND_MUTEX,
+    SEM_KIND_RECURSIVE,
+} sem_kind_t;
+
+struct QueueDefinition {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    sem_kind_t kind;
+    UBaseType_t count;
+    UBaseType_t max_count;
+    pthread_t owner;
+    UBaseType_t depth;              /**< Recursive mutex nesting; 0 = free */
+};
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static __thread struct tskTaskControlBlock *s_current_task;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void shim_cond_init(pthread_cond_t *cond);
+static bool shim_deadline(TickType_t ticks, struct timespec *out);
+static int shim_cond_wait(pthread_cond_t *cond, pthread_mutex_t *lock, TickType_t ticks, const struct timespec *deadline);
+static void shim_task_cleanup(void *arg);
+static void *shim_task_entry(void *arg);
+static SemaphoreHandle_t shim_sem_create(sem_kind_t kind, UBaseType_t max_count, UBaseType_t initial_count);
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void shim_cond_init(pthread_cond_t *cond)
+{
+    pthread_condattr_t attr;
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+/** Absolute CLOCK_MONOTONIC deadline for a finite wait; false for portMAX_DELAY */
+static bool shim_deadline(TickType_t ticks, struct timespec *out)
+{
+    if (ticks == portMAX_DELAY) {
+        return false;
+    }
+
+    uint64_t ms = pdTICKS_TO_MS(ticks);
+    clock_gettime(CLOCK_MONOTONIC, out);
+    out->tv_sec += (time_t)(ms / 1000U);
+    out->tv_nsec += (long)((ms % 1000U) * 1000000U);
+    if (out->tv_nsec >= 1000000000L) {
+        out->tv_sec++;
+        out->tv_nsec -= 1000000000L;
+    }
+    return true;
+}
+
+static int shim_cond_wait(pthread_cond_t *cond, pthread_mutex_t *lock, TickType_t ticks, const struct timespec *deadline)
+{
+    if (ticks == portMAX_DELAY) {
+        return pthread_cond_wait(cond, lock);
+    }
+    return pthread_cond_timedwait(cond, lock, deadline);
+}
+
+static void shim_task_cleanup(void *arg)
+{
+    free(arg);
+}
+
+static void *shim_task_entry(void *arg)
+{
+    struct tskTaskControlBlock *tcb = (struct tskTaskControlBlock *)arg;
+
+    s_current_task = tcb;
+    pthread_cleanup_push(shim_task_cleanup, tcb);
+    tcb->fn(tcb->arg);
+    pthread_cleanup_pop(1);
+    return NULL;
+}
+
+static SemaphoreHandle_t shim_sem_create(sem_kind_t kind, UBaseType_t max_count, UBaseType_t initial_count)
+{
+    SemaphoreHandle_t sem = calloc(1, sizeof(*sem));
+
+    if (sem == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&sem->lock, NULL);
+    shim_cond_init(&sem->cond);
+    sem->kind = kind;
+    sem->max_count = max_count;
+    sem->count = initial_count;
+    return sem;
+}
+
+/**********************
+ *   PUBLIC FUNCTIONS
+ **********************/
+
+/*=====================
+ * Tasks
+ *====================*/
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                       void *arg, UBaseType_t priority, TaskHandle_t *out_handle)
+{
+    struct tskTaskControlBlock *tcb = calloc(1, sizeof(*tcb));
+    pthread_attr_t attr;
+
+    (void)stack_depth;
+    (void)priority;
+    if (tcb == NULL) {
+        return pdFAIL;
+    }
+    tcb->fn = fn;
+    tcb->arg = arg;
+    strncpy(tcb->name, (name != NULL) ? name : "", sizeof(tcb->name) - 1);
+
+    /* Host stacks keep the pthread default: IDF sizes do not account for glibc */
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    if (pthread_create(&tcb->thread, &attr, shim_task_entry, tcb) != 0) {
+        pthread_attr_destroy(&attr);
+        free(tcb);
+        return pdFAIL;
+    }
+    pthread_attr_destroy(&attr);
+
+    if (out_handle != NULL) {
+        *out_handle = tcb;
+    }
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *out_handle, BaseType_t core_id)
+{
+    (void)core_id;
+    return xTaskCreate(fn, name, stack_depth, arg, priority, out_handle);
+}
+
+BaseType_t xTaskCreateWithCaps(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                               void *arg, UBaseType_t priority, TaskHandle_t *out_handle, UBaseType_t caps)
+{
+    (void)caps;
+    return xTaskCreate(fn, name, stack_depth, arg, priority, out_handle);
+}
+
+BaseType_t xTaskCreatePinnedToCoreWithCaps(TaskFunction_t fn, const char *name, uint32_t stack_depth,
+                                           void *arg, UBaseType_t priority, TaskHandle_t *out_handle,
+                                           BaseType_t core_id, UBaseType_t caps)
+{
+    (void)core_id;
+    (void)caps;
+    return xTaskCreate(fn, name, stack_depth, arg, priority, out_handle);
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task == NULL || task == s_current_task) {
+        pthread_exit(NULL);
+    }
+    abort();
+}
+
+void vTaskDeleteWithCaps(TaskHandle_t task)
+{
+    vTaskDelete(task);
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    uint64_t ms = pdTICKS_TO_MS(ticks);
+    struct timespec ts = {
+        .tv_sec = (time_t)(ms / 1000U),
+        .tv_nsec = (long)((ms % 1000U) * 1000000U),
+    };
+
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (TickType_t)pdMS_TO_TICKS((uint64_t)ts.tv_sec * 1000U + (uint64_t)ts.tv_nsec / 1000000U);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return s_current_task;
+}
+
+/*=====================
+ * Event groups
+ *====================*/
+
+EventGroupHandle_t xEventGroupCreate(void)
+{
+    EventGroupHandle_t group = calloc(1, sizeof(*group));
+
+    if (group == NULL) {
+        return NULL;
+    }
+    pthread_mutex_init(&group->lock, NULL);
+    shim_cond_init(&group->cond);
+    return group;
+}
+
+void vEventGroupDelete(EventGroupHandle_t group)
+{
+    if (group == NULL) {
+        return;
+    }
+    pthread_cond_destroy(&group->cond);
+    pthread_mutex_destroy(&group->lock);
+    free(group);
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    EventBits_t ret;
+
+    pthread_mutex_lock(&group->lock);
+    group->bits |= bits;
+    ret = group->bits;
+    pthread_cond_broadcast(&group->cond);
+    pthread_mutex_unlock(&group->lock);
+    return ret;
+}
+
+BaseType_t xEventGroupSetBitsFromISR(EventGroupHandle_t group, EventBits_t bits,
+                                     BaseType_t *higher_priority_task_woken)
+{
+    xEventGroupSetBits(group, bits);
+    if (higher_priority_task_woken != NULL) {
+        *higher_priority_task_woken = pdFALSE;
+    }
+    return pdPASS;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits)
+{
+    EventBits_t ret;
+
+    pthread_mutex_lock(&group->lock);
+    ret = group->bits;
+    group->bits &= ~bits;
+    pthread_mutex_unlock(&group->lock);
+    return ret;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group)
+{
+    EventBits_t ret;
+
+    pthread_mutex_lock(&group->lock);
+    ret = group->bits;
+    pthread_mutex_unlock(&group->lock);
+    return ret;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit,
+                                BaseType_t wait_for_all, TickType_t ticks_to_wait)
+{
+    struct timespec deadline;
+    EventBits_t ret;
+
+    shim_deadline(ticks_to_wait, &deadline);
+    pthread_mutex_lock(&group->lock);
+    for (;;) {
+        EventBits_t set = group->bits & bits;
+        bool done = wait_for_all ? (set == bits) : (set != 0);
+
+        if (done) {
+            ret = group->bits;
+            if (clear_on_exit) {
+                group->bits &= ~bits;
+            }
+            break;
+        }
+        if (ticks_to_wait == 0 ||
+                shim_cond_wait(&group->cond, &group->lock, ticks_to_wait, &deadline) == ETIMEDOUT) {
+            ret = group->bits;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&group->lock);
+    return ret;
+}
+
+/*=====================
+ * Semaphores and mutexes
+ *====================*/
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return shim_sem_create(SEM_KIND_MUTEX, 1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void)
+{
+    return shim_sem_create(SEM_KIND_RECURSIVE, 1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return shim_sem_create(SEM_KIND_COUNTING, 1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    return shim_sem_create(SEM_KIND_COUNTING, max_count, initial_count);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    if (sem == NULL) {
+        return;
+    }
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->lock);
+    free(sem);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks_to_wait)
+{
+    struct timespec deadline;
+    BaseType_t ret = pdFAIL;
+
+    shim_deadline(ticks_to_wait, &deadline);
+    pthread_mutex_lock(&sem->lock);
+    for (;;) {
+        if (sem->count > 0) {
+            sem->count--;
+            sem->owner = pthread_self();
+            ret = pdPASS;
+            break;
+        }
+        if (ticks_to_wait == 0 ||
+                shim_cond_wait(&sem->cond, &sem->lock, ticks_to_wait, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    BaseType_t ret = pdFAIL;
+
+    pthread_mutex_lock(&sem->lock);
+    if (sem->count < sem->max_count) {
+        sem->count++;
+        pthread_cond_signal(&sem->cond);
+        ret = pdPASS;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *higher_priority_task_woken)
+{
+    if (higher_priority_task_woken != NULL) {
+        *higher_priority_task_woken = pdFALSE;
+    }
+    return xSemaphoreGive(sem);
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks_to_wait)
+{
+    struct timespec deadline;
+    BaseType_t ret = pdFAIL;
+    pthread_t self = pthread_self();
+
+    shim_deadline(ticks_to_wait, &deadline);
+    pthread_mutex_lock(&sem->lock);
+    for (;;) {
+        if (sem->depth == 0 || pthread_equal(sem->owner, self)) {
+            sem->owner = self;
+            sem->depth++;
+            ret = pdPASS;
+            break;
+        }
+        if (ticks_to_wait == 0 ||
+                shim_cond_wait(&sem->cond, &sem->lock, ticks_to_wait, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem)
+{
+    BaseType_t ret = pdFAIL;
+
+    pthread_mutex_lock(&sem->lock);
+    if (sem->depth > 0 && pthread_equal(sem->owner, pthread_self())) {
+        if (--sem->depth == 0) {
+            pthread_cond_signal(&sem->cond);
+        }
+        ret = pdPASS;
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return ret;
+}
@@ -0,0 +1,39 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host shim: there are no GPIOs, touch always runs in polling mode */
+
+#pragma once
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    GPIO_NUM_NC = -1,
+    GPIO_NUM_0 = 0,
+    GPIO_NUM_MAX = 1,
+} gpio_num_t;
+
+#define GPIO_IS_VALID_GPIO(gpio_num)    (0)
+
+static inline esp_err_t gpio_intr_enable(gpio_num_t gpio_num)
+{
+    (void)gpio_num;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline esp_err_t gpio_intr_disable(gpio_num_t gpio_num)
+{
+    (void)gpio_num;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,93 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host shim: the esp_lcd_touch handle layout used by gfx_touch. A host
+ * "driver" fills read_data/get_data to inject touches; interrupts are
+ * not available, so gfx_touch always polls.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "driver/gpio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct esp_lcd_touch_s esp_lcd_touch_t;
+typedef esp_lcd_touch_t *esp_lcd_touch_handle_t;
+typedef void (*esp_lcd_touch_interrupt_callback_t)(esp_lcd_touch_handle_t tp);
+
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t strength;
+    uint8_t track_id;
+} esp_lcd_touch_point_data_t;
+
+typedef struct {
+    uint16_t x_max;
+    uint16_t y_max;
+    gpio_num_t rst_gpio_num;
+    gpio_num_t int_gpio_num;
+    esp_lcd_touch_interrupt_callback_t interrupt_callback;
+    void *user_data;
+} esp_lcd_touch_config_t;
+
+struct esp_lcd_touch_s {
+    esp_err_t (*read_data)(esp_lcd_touch_handle_t tp);
+    esp_err_t (*get_data)(esp_lcd_touch_handle_t tp, esp_lcd_touch_point_data_t *data,
+                          uint8_t *point_cnt, uint8_t max_point_cnt);
+    esp_lcd_touch_config_t config;
+};
+
+static inline esp_err_t esp_lcd_touch_read_data(esp_lcd_touch_handle_t tp)
+{
+    if (tp == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return (tp->read_data != NULL) ? tp->read_data(tp) : ESP_OK;
+}
+
+static inline esp_err_t esp_lcd_touch_get_data(esp_lcd_touch_handle_t tp, esp_lcd_touch_point_data_t *data,
+                                               uint8_t *point_cnt, uint8_t max_point_cnt)
+{
+    if (tp == NULL || data == NULL || point_cnt == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (tp->get_data == NULL) {
+        *point_cnt = 0;
+        return ESP_OK;
+    }
+    return tp->get_data(tp, data, point_cnt, max_point_cnt);
+}
+
+static inline esp_err_t esp_lcd_touch_register_interrupt_callback(esp_lcd_touch_handle_t tp,
+                                                                  esp_lcd_touch_interrupt_callback_t callback)
+{
+    (void)tp;
+    (void)callback;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+static inline esp_err_t esp_lcd_touch_register_interrupt_callback_with_data(esp_lcd_touch_handle_t tp,
+                                                                            esp_lcd_touch_interrupt_callback_t callback,
+                                                                            void *user_data)
+{
+    (void)tp;
+    (void)callback;
+    (void)user_data;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host shim: a thin FreeRTOS surface on POSIX threads. One tick is one
+ * millisecond; tasks are detached pthreads, priorities and core affinity
+ * are accepted and ignored.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_bit_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+#define pdFALSE                 ((BaseType_t)0)
+#define pdTRUE                  ((BaseType_t)1)
+#define pdFAIL                  pdFALSE
+#define pdPASS                  pdTRUE
+
+#define configTICK_RATE_HZ      1000
+#define configMAX_TASK_NAME_LEN 16
+#define configMAX_PRIORITIES    25
+
+#define portMAX_DELAY           ((TickType_t)0xFFFFFFFFUL)
+#define portTICK_PERIOD_MS      ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portNUM_PROCESSORS      2
+#define portYIELD_FROM_ISR(...) do { } while (0)
+
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000U))
+#define pdTICKS_TO_MS(ticks)    ((uint32_t)(((uint64_t)(ticks) * 1000U) / configTICK_RATE_HZ))
+
+#define tskNO_AFFINITY          ((BaseType_t)0x7FFFFFFF)
+
+/** There are no interrupts on the host */
+static inline BaseType_t xPortInIsrContext(void)
+{
+    return pdFALSE;
+}
+
+#ifdef __cplusplus
+}
+#endif
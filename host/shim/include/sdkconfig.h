@@ -0,0 +1,78 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host build configuration: Kconfig defaults of the component, with the
+ * options that need ESP-IDF managed components (FreeType, esp_new_jpeg,
+ * heatshrink) turned off. Integer options can be overridden with -D.
+ */
+
+#pragma once
+
+#define CONFIG_IDF_TARGET_LINUX 1
+
+/* Render */
+#ifndef CONFIG_GFX_DISP_COPY_ON_MOVE
+#define CONFIG_GFX_DISP_COPY_ON_MOVE 1
+#endif
+#ifndef CONFIG_GFX_RENDER_PIPELINED_FLUSH
+#define CONFIG_GFX_RENDER_PIPELINED_FLUSH 1
+#endif
+#ifndef CONFIG_GFX_RENDER_ADAPTIVE_CHUNK
+#define CONFIG_GFX_RENDER_ADAPTIVE_CHUNK 1
+#endif
+#ifndef CONFIG_GFX_RENDER_FIRST_CHUNK_ROWS
+#define CONFIG_GFX_RENDER_FIRST_CHUNK_ROWS 16
+#endif
+#ifndef CONFIG_GFX_RENDER_STRIPE_WORKERS
+#define CONFIG_GFX_RENDER_STRIPE_WORKERS 0
+#endif
+#ifndef CONFIG_GFX_RENDER_STRIPE_MIN_ROWS
+#define CONFIG_GFX_RENDER_STRIPE_MIN_ROWS 8
+#endif
+#ifndef CONFIG_GFX_DISP_PERF_HIST
+#define CONFIG_GFX_DISP_PERF_HIST 1
+#endif
+#ifndef CONFIG_GFX_DISP_PERF_HIST_WINDOW
+#define CONFIG_GFX_DISP_PERF_HIST_WINDOW 1024
+#endif
+#ifndef CONFIG_GFX_CMD_QUEUE_LEN
+#define CONFIG_GFX_CMD_QUEUE_LEN 32
+#endif
+
+/* Software Blend */
+#ifndef CONFIG_GFX_BLEND_TRI_EDGE_AA_RANGE
+#define CONFIG_GFX_BLEND_TRI_EDGE_AA_RANGE 0
+#endif
+#ifndef CONFIG_GFX_MESH_IMG_SCANLINE_MAX_VERTS
+#define CONFIG_GFX_MESH_IMG_SCANLINE_MAX_VERTS 512
+#endif
+#ifndef CONFIG_GFX_BLEND_POLYGON_INWARD_AA
+#define CONFIG_GFX_BLEND_POLYGON_INWARD_AA 1
+#endif
+#ifndef CONFIG_GFX_BLEND_POLYGON_SOLID_HARD_EDGE
+#define CONFIG_GFX_BLEND_POLYGON_SOLID_HARD_EDGE 1
+#endif
+#ifndef CONFIG_GFX_BLEND_VECTOR
+#define CONFIG_GFX_BLEND_VECTOR 1
+#endif
+
+/* Motion Widget */
+#ifndef CONFIG_GFX_MOTION_BEZIER_STROKE_SEGS_PER_SEG
+#define CONFIG_GFX_MOTION_BEZIER_STROKE_SEGS_PER_SEG 6
+#endif
+#ifndef CONFIG_GFX_MOTION_BEZIER_FILL_LOOP_SEGS_PER_SEG
+#define CONFIG_GFX_MOTION_BEZIER_FILL_LOOP_SEGS_PER_SEG 12
+#endif
+#ifndef CONFIG_GFX_MOTION_BEZIER_FILL_SEGS
+#define CONFIG_GFX_MOTION_BEZIER_FILL_SEGS 24
+#endif
+#ifndef CONFIG_GFX_MOTION_HUB_FILL_MAX_POINTS
+#define CONFIG_GFX_MOTION_HUB_FILL_MAX_POINTS 512
+#endif
+#if !defined(CONFIG_GFX_MOTION_BEZIER_FILL_RASTERIZER_TRIANGLE)
+#define CONFIG_GFX_MOTION_BEZIER_FILL_RASTERIZER_SCANLINE 1
+#endif
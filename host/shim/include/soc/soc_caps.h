@@ -0,0 +1,12 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Host shim: SoC capabilities of a dual-core target without PSRAM DMA */
+
+#pragma once
+
+#define SOC_CPU_CORES_NUM       2
+#define SOC_PSRAM_DMA_CAPABLE   0
@@ -0,0 +1,165 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_check.h"
+#include "esp_timer.h"
+
+#include "gfx_host_fb.h"
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const char *TAG = "host_fb";
+
+/**********************
+ *   PUBLIC FUNCTIONS
+ **********************/
+
+esp_err_t gfx_host_fb_init(gfx_host_fb_t *fb, uint32_t h_res, uint32_t v_res, gfx_disp_config_t *out_cfg)
+{
+    ESP_RETURN_ON_FALSE(fb != NULL && out_cfg != NULL, ESP_ERR_INVALID_ARG, TAG, "init host fb: invalid argument");
+    ESP_RETURN_ON_FALSE(h_res > 0 && v_res > 0, ESP_ERR_INVALID_ARG, TAG, "init host fb: invalid resolution");
+
+    memset(fb, 0, sizeof(*fb));
+    fb->pixels = calloc((size_t)h_res * v_res, sizeof(uint16_t));
+    ESP_RETURN_ON_FALSE(fb->pixels != NULL, ESP_ERR_NO_MEM, TAG, "init host fb: no mem for %ux%u",
+                        (unsigned)h_res, (unsigned)v_res);
+    fb->h_res = h_res;
+    fb->v_res = v_res;
+
+    memset(out_cfg, 0, sizeof(*out_cfg));
+    out_cfg->h_res = h_res;
+    out_cfg->v_res = v_res;
+    out_cfg->flush_cb = gfx_host_fb_flush_cb;
+    out_cfg->user_data = fb;
+    out_cfg->buffers.buf_pixels = (size_t)h_res * 16;
+    return ESP_OK;
+}
+
+void gfx_host_fb_deinit(gfx_host_fb_t *fb)
+{
+    if (fb == NULL) {
+        return;
+    }
+
+    free(fb->pixels);
+    fb->pixels = NULL;
+}
+
+void gfx_host_fb_flush_cb(gfx_disp_t *disp, int x1, int y1, int x2, int y2, const void *data)
+{
+    gfx_host_fb_t *fb = (gfx_host_fb_t *)gfx_disp_get_user_data(disp);
+    const uint16_t *src = (const uint16_t *)data;
+
+    if (fb != NULL && fb->pixels != NULL && src != NULL && x2 > x1 && y2 > y1) {
+        size_t row_px = (size_t)(x2 - x1);
+
+        if (fb->full_frame) {
+            /* RGB panels scan out the whole buffer they are handed, not just the chunk */
+            memcpy(fb->pixels, src, (size_t)fb->h_res * fb->v_res * sizeof(uint16_t));
+        } else {
+            for (int y = y1; y < y2; y++) {
+                memcpy(&fb->pixels[(size_t)y * fb->h_res + (size_t)x1], src, row_px * sizeof(uint16_t));
+                src += row_px;
+            }
+        }
+        fb->flush_pixels += row_px * (size_t)(y2 - y1);
+        /* Test tasks poll the counters while the render task flushes */
+        __atomic_fetch_add(&fb->flush_count, 1U, __ATOMIC_RELEASE);
+        if (gfx_disp_is_flushing_last(disp)) {
+            __atomic_fetch_add(&fb->frame_count, 1U, __ATOMIC_RELEASE);
+        }
+    }
+
+    gfx_disp_flush_ready(disp, true);
+}
+
+uint16_t gfx_host_fb_get_pixel(const gfx_host_fb_t *fb, uint32_t x, uint32_t y)
+{
+    if (fb == NULL || fb->pixels == NULL || x >= fb->h_res || y >= fb->v_res) {
+        return 0;
+    }
+
+    uint16_t px = fb->pixels[(size_t)y * fb->h_res + x];
+    return fb->swap ? (uint16_t)__builtin_bswap16(px) : px;
+}
+
+uint32_t gfx_host_fb_checksum(const gfx_host_fb_t *fb)
+{
+    uint32_t hash = 2166136261U;
+
+    if (fb == NULL || fb->pixels == NULL) {
+        return 0;
+    }
+
+    const uint8_t *bytes = (const uint8_t *)fb->pixels;
+    size_t len = (size_t)fb->h_res * fb->v_res * sizeof(uint16_t);
+    for (size_t i = 0; i < len; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+uint32_t gfx_host_fb_frame_count(const gfx_host_fb_t *fb)
+{
+    return __atomic_load_n(&fb->frame_count, __ATOMIC_ACQUIRE);
+}
+
+uint32_t gfx_host_fb_flush_count(const gfx_host_fb_t *fb)
+{
+    return __atomic_load_n(&fb->flush_count, __ATOMIC_ACQUIRE);
+}
+
+bool gfx_host_fb_wait_frames(gfx_host_fb_t *fb, uint32_t frames, uint32_t timeout_ms)
+{
+    int64_t deadline_us = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+
+    while (gfx_host_fb_frame_count(fb) < frames) {
+        if (esp_timer_get_time() >= deadline_us) {
+            return false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(1));
+    }
+    return true;
+}
+
+esp_err_t gfx_host_fb_write_ppm(const gfx_host_fb_t *fb, const char *path)
+{
+    ESP_RETURN_ON_FALSE(fb != NULL && fb->pixels != NULL && path != NULL, ESP_ERR_INVALID_ARG, TAG,
+                        "write ppm: invalid argument");
+
+    FILE *f = fopen(path, "wb");
+    ESP_RETURN_ON_FALSE(f != NULL, ESP_FAIL, TAG, "write ppm: cannot open %s", path);
+
+    fprintf(f, "P6\n%u %u\n255\n", (unsigned)fb->h_res, (unsigned)fb->v_res);
+    for (uint32_t y = 0; y < fb->v_res; y++) {
+        for (uint32_t x = 0; x < fb->h_res; x++) {
+            uint16_t px = gfx_host_fb_get_pixel(fb, x, y);
+            uint8_t rgb[3] = {
+                (uint8_t)(((px >> 11) & 0x1F) * 255 / 31),
+                (uint8_t)(((px >> 5) & 0x3F) * 255 / 63),
+                (uint8_t)((px & 0x1F) * 255 / 31),
+            };
+            fwrite(rgb, 1, sizeof(rgb), f);
+        }
+    }
+
+    bool ok = (ferror(f) == 0);
+    ok = (fclose(f) == 0) && ok;
+    ESP_RETURN_ON_FALSE(ok, ESP_FAIL, TAG, "write ppm: write to %s failed", path);
+    return ESP_OK;
+}
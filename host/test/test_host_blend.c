@@ -0,0 +1,664 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Blend backend equivalence test: every built-in backend is run against the
+ * scalar reference on randomized buffers, masks and clip rects, kernel by
+ * kernel and through the gfx_sw_blend_*() entry points, and must match bit
+ * for bit. The triangle block traversal is checked against a per-pixel
+ * draw, polygon coverage against supersampling and premultiplied images
+ * against straight alpha. Then prints Mpix/s per kernel and the gain over
+ * scalar.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common/gfx_comm.h"
+#include "common/gfx_mesh_frac.h"
+#include "core/draw/gfx_blend_priv.h"
+#include "core/draw/gfx_blend_backend_priv.h"
+
+#define TEST_W          160
+#define TEST_H          96
+#define TEST_TEX_W      48
+#define TEST_TEX_H      40
+#define TEST_ROUNDS     400
+#define BENCH_MIN_NS    20000000LL
+
+#define TEST_CHECK(cond) do {                                               \
+        if (!(cond)) {                                                      \
+            fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                       \
+        }                                                                   \
+    } while (0)
+
+typedef enum {
+    KERNEL_FILL,
+    KERNEL_COLOR_DRAW,
+    KERNEL_COLOR_DRAW_OPA,
+    KERNEL_IMAGE_DRAW,
+    KERNEL_PREMUL_DRAW,
+    KERNEL_TRI_SPAN,
+    KERNEL_POLY_SPAN,
+    KERNEL_COUNT,
+} test_kernel_t;
+
+static const char *const s_kernel_names[KERNEL_COUNT] = {
+    "fill", "color_draw", "color_draw/opa", "image_draw", "premul_draw", "tri_span", "poly_span",
+};
+
+static uint32_t s_rng = 0x2545F491U;
+static uint16_t s_dst_init[TEST_W * TEST_H];
+static uint16_t s_dst_ref[TEST_W * TEST_H];
+static uint16_t s_dst_out[TEST_W * TEST_H];
+static uint8_t s_mask[TEST_W * TEST_H];
+static uint16_t s_tex[TEST_TEX_W * TEST_TEX_H];
+static uint8_t s_tex_mask[TEST_TEX_W * TEST_TEX_H];
+static uint16_t s_tex_premul[TEST_TEX_W * TEST_TEX_H];
+
+static uint32_t rnd(void)
+{
+    s_rng ^= s_rng << 13;
+    s_rng ^= s_rng >> 17;
+    s_rng ^= s_rng << 5;
+    return s_rng;
+}
+
+/* Runs of 0 and 255 (to hit the skip/copy fast paths) mixed with noise */
+static void fill_mask(uint8_t *mask, size_t len)
+{
+    size_t i = 0;
+
+    while (i < len) {
+        size_t run = 1 + rnd() % 24;
+        uint32_t kind = rnd() % 4;
+        for (; run > 0 && i < len; run--, i++) {
+            mask[i] = (kind == 0) ? 0 : (kind == 1) ? 255 : (uint8_t)rnd();
+        }
+    }
+}
+
+static void randomize(void)
+{
+    for (size_t i = 0; i < TEST_W * TEST_H; i++) {
+        s_dst_init[i] = (uint16_t)rnd();
+    }
+    for (size_t i = 0; i < TEST_TEX_W * TEST_TEX_H; i++) {
+        s_tex[i] = (uint16_t)rnd();
+    }
+    fill_mask(s_mask, sizeof(s_mask));
+    fill_mask(s_tex_mask, sizeof(s_tex_mask));
+}
+
+static uint16_t premultiply_rgb565(uint16_t c, uint8_t a, bool swap)
+{
+    if (swap) {
+        c = (uint16_t)(c << 8 | c >> 8);
+    }
+    uint32_t r = (((uint32_t)(c >> 11) * a) + 127U) / 255U;
+    uint32_t g = (((uint32_t)((c >> 5) & 0x3FU) * a) + 127U) / 255U;
+    uint32_t b = (((uint32_t)(c & 0x1FU) * a) + 127U) / 255U;
+    c = (uint16_t)(r << 11 | g << 5 | b);
+    return swap ? (uint16_t)(c << 8 | c >> 8) : c;
+}
+
+static gfx_opa_t random_opa(void)
+{
+    switch (rnd() % 4) {
+    case 0:
+        return 255;
+    case 1:
+        return (gfx_opa_t)(253 + rnd() % 2);
+    default:
+        return (gfx_opa_t)rnd();
+    }
+}
+
+/* Run one kernel on dst over clip rect (x, y, w, h) with the given parameters */
+static void run_kernel(const gfx_blend_backend_t *be, test_kernel_t k, uint16_t *dst,
+                       int32_t x, int32_t y, int32_t w, int32_t h,
+                       uint16_t color, gfx_opa_t opa, bool swap, bool use_mask, uint32_t seed)
+{
+    gfx_color_t *d = (gfx_color_t *)dst + (size_t)y * TEST_W + x;
+    const uint8_t *m = s_mask + (size_t)y * TEST_W + x;
+    gfx_color_t c = {.full = color};
+
+    switch (k) {
+    case KERNEL_FILL:
+        for (int32_t row = 0; row < h; row++) {
+            be->fill((uint16_t *)(d + (size_t)row * TEST_W), color, (size_t)w);
+        }
+        break;
+    case KERNEL_COLOR_DRAW:
+    case KERNEL_COLOR_DRAW_OPA:
+        be->color_draw(d, TEST_W, m, TEST_W, w, h, c, opa, swap);
+        break;
+    case KERNEL_IMAGE_DRAW:
+        w = MIN(w, TEST_TEX_W);
+        h = MIN(h, TEST_TEX_H);
+        be->image_draw(d, TEST_W, (const gfx_color_t *)s_tex, TEST_TEX_W,
+                       use_mask ? s_tex_mask : NULL, TEST_TEX_W, w, h, swap);
+        break;
+    case KERNEL_PREMUL_DRAW:
+        /* The kernel does not saturate, so feed it texels premultiplied by their alpha like real assets */
+        w = MIN(w, TEST_TEX_W);
+        h = MIN(h, TEST_TEX_H);
+        for (size_t i = 0; i < TEST_TEX_W * TEST_TEX_H; i++) {
+            s_tex_premul[i] = premultiply_rgb565(s_tex[i], s_tex_mask[i], swap);
+        }
+        be->premul_draw(d, TEST_W, (const gfx_color_t *)s_tex_premul, TEST_TEX_W, s_tex_mask, TEST_TEX_W, w, h, swap);
+        break;
+    case KERNEL_TRI_SPAN: {
+        const gfx_blend_tex_t tex = {
+            .buf = (const gfx_color_t *)s_tex,
+            .mask = use_mask ? s_tex_mask : NULL,
+            .stride = TEST_TEX_W,
+            .height = TEST_TEX_H,
+            .mask_stride = TEST_TEX_W,
+        };
+        /* Gradients that walk off the texture on both sides to exercise the clamp */
+        int32_t du = (int32_t)(seed % 0x30000U) - 0x18000;
+        int32_t dv = (int32_t)((seed >> 8) % 0x8000U) - 0x4000;
+        for (int32_t row = 0; row < h; row++) {
+            be->tri_span(d + (size_t)row * TEST_W, w, &tex, (int32_t)(seed % (TEST_TEX_W << 16)) - 0x40000,
+                         row << 15, du, dv, opa, swap);
+        }
+        break;
+    }
+    case KERNEL_POLY_SPAN:
+        for (int32_t row = 0; row < h; row++) {
+            be->poly_span(d + (size_t)row * TEST_W, m + (size_t)row * TEST_W, w, c, swap);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static int test_kernels(const gfx_blend_backend_t *be)
+{
+    const gfx_blend_backend_t *ref = &gfx_blend_backend_scalar;
+
+    for (int round = 0; round < TEST_ROUNDS; round++) {
+        randomize();
+        for (int k = 0; k < KERNEL_COUNT; k++) {
+            int32_t x = (int32_t)(rnd() % (TEST_W - 1));
+            int32_t y = (int32_t)(rnd() % (TEST_H - 1));
+            int32_t w = 1 + (int32_t)(rnd() % (uint32_t)(TEST_W - x));
+            int32_t h = 1 + (int32_t)(rnd() % (uint32_t)(TEST_H - y));
+            uint16_t color = (uint16_t)rnd();
+            gfx_opa_t opa = (k == KERNEL_COLOR_DRAW_OPA) ? (gfx_opa_t)(rnd() % 253) : random_opa();
+            bool swap = (rnd() & 1) != 0;
+            bool use_mask = (rnd() % 4) != 0;
+            uint32_t seed = rnd();
+
+            memcpy(s_dst_ref, s_dst_init, sizeof(s_dst_ref));
+            memcpy(s_dst_out, s_dst_init, sizeof(s_dst_out));
+            run_kernel(ref, (test_kernel_t)k, s_dst_ref, x, y, w, h, color, opa, swap, use_mask, seed);
+            run_kernel(be, (test_kernel_t)k, s_dst_out, x, y, w, h, color, opa, swap, use_mask, seed);
+            if (memcmp(s_dst_ref, s_dst_out, sizeof(s_dst_ref)) != 0) {
+                fprintf(stderr, "%s/%s differs: rect %d,%d %dx%d opa %u swap %d\n",
+                        be->name, s_kernel_names[k], (int)x, (int)y, (int)w, (int)h, opa, swap);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/* One random triangle and polygon through gfx_sw_blend_*() with the active backend */
+static void draw_shapes(uint16_t *dst, uint32_t seed)
+{
+    uint32_t saved = s_rng;
+    gfx_area_t buf_area = {0, 0, TEST_W, TEST_H};
+    gfx_area_t clip = {
+        (gfx_coord_t)(seed % 24), (gfx_coord_t)((seed >> 5) % 24),
+        (gfx_coord_t)(TEST_W - (seed >> 10) % 24), (gfx_coord_t)(TEST_H - (seed >> 15) % 24),
+    };
+    gfx_sw_blend_img_vertex_t v[3];
+    int32_t vx[10], vy[10];
+    int n;
+
+    s_rng = seed | 1U;
+    for (int i = 0; i < 3; i++) {
+        v[i].x = (int32_t)(rnd() % ((TEST_W + 20) * GFX_MESH_FRAC_ONE)) - 10 * GFX_MESH_FRAC_ONE;
+        v[i].y = (int32_t)(rnd() % ((TEST_H + 20) * GFX_MESH_FRAC_ONE)) - 10 * GFX_MESH_FRAC_ONE;
+        v[i].u = (gfx_coord_t)(rnd() % TEST_TEX_W);
+        v[i].v = (gfx_coord_t)(rnd() % TEST_TEX_H);
+    }
+    gfx_sw_blend_img_triangle_draw((gfx_color_t *)dst, TEST_W, &buf_area, &clip,
+                                   (const gfx_color_t *)s_tex, TEST_TEX_W, TEST_TEX_H,
+                                   (rnd() & 1) ? s_tex_mask : NULL, TEST_TEX_W, random_opa(),
+                                   &v[0], &v[1], &v[2], (uint8_t)(rnd() & (0x07 | GFX_BLEND_TRI_AA_INWARD)), NULL, 0, (rnd() & 1) != 0);
+
+    n = 3 + (int)(rnd() % 8);
+    for (int i = 0; i < n; i++) {
+        vx[i] = (int32_t)(rnd() % ((TEST_W + 20) * GFX_MESH_FRAC_ONE)) - 10 * GFX_MESH_FRAC_ONE;
+        vy[i] = (int32_t)(rnd() % ((TEST_H + 20) * GFX_MESH_FRAC_ONE)) - 10 * GFX_MESH_FRAC_ONE;
+    }
+    gfx_sw_blend_polygon_fill((gfx_color_t *)dst, TEST_W, &buf_area, &clip,
+                              (gfx_color_t) {
+        .full = (uint16_t)rnd()
+    }, random_opa(), vx, vy, n, (gfx_sw_blend_fill_rule_t)(rnd() & 1), (rnd() & 1) != 0);
+    s_rng = saved;
+}
+
+static int test_entry_points(const gfx_blend_backend_t *be)
+{
+    for (int round = 0; round < TEST_ROUNDS; round++) {
+        uint32_t seed = rnd();
+
+        randomize();
+        memcpy(s_dst_ref, s_dst_init, sizeof(s_dst_ref));
+        memcpy(s_dst_out, s_dst_init, sizeof(s_dst_out));
+        TEST_CHECK(gfx_blend_backend_set(&gfx_blend_backend_scalar) == ESP_OK);
+        draw_shapes(s_dst_ref, seed);
+        TEST_CHECK(gfx_blend_backend_set(be) == ESP_OK);
+        draw_shapes(s_dst_out, seed);
+        if (memcmp(s_dst_ref, s_dst_out, sizeof(s_dst_ref)) != 0) {
+            fprintf(stderr, "%s: triangle/polygon differs (seed %08x)\n", be->name, (unsigned)seed);
+            gfx_blend_backend_set(NULL);
+            return 1;
+        }
+    }
+    TEST_CHECK(gfx_blend_backend_set(NULL) == ESP_OK);
+    return 0;
+}
+
+/*
+ * Block traversal: drawing pixel by pixel through 1x1 clip rects, where every
+ * block degenerates to one exactly classified pixel, must give the same image
+ * as the full draw, and a large triangle must reject/accept most blocks.
+ * Each clip rect re-derives UV at its own origin, so the texture is flat to
+ * keep UV rounding out of the comparison; edge values are exact integers.
+ */
+static int test_triangle_blocks(void)
+{
+    gfx_area_t buf_area = {0, 0, TEST_W, TEST_H};
+    const gfx_sw_blend_aa_edge_t xaa[2] = {
+        {40 * GFX_MESH_FRAC_ONE, -30 * GFX_MESH_FRAC_ONE, 50 * GFX_MESH_FRAC_ONE, 60 * GFX_MESH_FRAC_ONE, 20 * GFX_MESH_FRAC_ONE},
+        {-10 * GFX_MESH_FRAC_ONE, 0, 10 * GFX_MESH_FRAC_ONE, 120 * GFX_MESH_FRAC_ONE, 0},
+    };
+    gfx_blend_perf_stats_t stats;
+
+    for (int round = 0; round < 24; round++) {
+        gfx_sw_blend_img_vertex_t v[3];
+        uint8_t edges = (uint8_t)(rnd() & 0x07);
+        gfx_opa_t opa = random_opa();
+        bool swap = (rnd() & 1) != 0;
+        const gfx_opa_t *tex_mask = (rnd() & 1) ? s_tex_mask : NULL;
+        uint8_t xaa_n = (uint8_t)(rnd() % 3);
+
+        if (round & 1) {
+            edges |= GFX_BLEND_TRI_AA_INWARD;
+        }
+        for (int i = 0; i < 3; i++) {
+            v[i].x = (int32_t)(rnd() % ((TEST_W + 20) * GFX_MESH_FRAC_ONE)) - 10 * GFX_MESH_FRAC_ONE;
+            v[i].y = (int32_t)(rnd() % ((TEST_H + 20) * GFX_MESH_FRAC_ONE)) - 10 * GFX_MESH_FRAC_ONE;
+            v[i].u = (gfx_coord_t)(rnd() % TEST_TEX_W);
+            v[i].v = (gfx_coord_t)(rnd() % TEST_TEX_H);
+        }
+        randomize();
+        for (size_t i = 0; i < TEST_TEX_W * TEST_TEX_H; i++) {
+            s_tex[i] = s_tex[0];
+            s_tex_mask[i] = s_tex_mask[0];
+        }
+        memcpy(s_dst_ref, s_dst_init, sizeof(s_dst_ref));
+        memcpy(s_dst_out, s_dst_init, sizeof(s_dst_out));
+        gfx_sw_blend_img_triangle_draw((gfx_color_t *)s_dst_out, TEST_W, &buf_area, &buf_area,
+                                       (const gfx_color_t *)s_tex, TEST_TEX_W, TEST_TEX_H, tex_mask, TEST_TEX_W,
+                                       opa, &v[0], &v[1], &v[2], edges, xaa, xaa_n, swap);
+        for (gfx_coord_t y = 0; y < TEST_H; y++) {
+            for (gfx_coord_t x = 0; x < TEST_W; x++) {
+                gfx_area_t px = {x, y, (gfx_coord_t)(x + 1), (gfx_coord_t)(y + 1)};
+                gfx_sw_blend_img_triangle_draw((gfx_color_t *)s_dst_ref, TEST_W, &buf_area, &px,
+                                               (const gfx_color_t *)s_tex, TEST_TEX_W, TEST_TEX_H, tex_mask, TEST_TEX_W,
+                                               opa, &v[0], &v[1], &v[2], edges, xaa, xaa_n, swap);
+            }
+        }
+        if (memcmp(s_dst_ref, s_dst_out, sizeof(s_dst_ref)) != 0) {
+            fprintf(stderr, "triangle blocks differ from per-pixel draw (round %d)\n", round);
+            return 1;
+        }
+    }
+
+    /* Covers most of the buffer: far fewer pixels than the bounding box need the per-pixel path */
+    {
+        gfx_sw_blend_img_vertex_t v[3] = {
+            {2 * GFX_MESH_FRAC_ONE, 2 * GFX_MESH_FRAC_ONE, 0, 0},
+            {(TEST_W - 2) * GFX_MESH_FRAC_ONE, 4 * GFX_MESH_FRAC_ONE, TEST_TEX_W - 1, 0},
+            {TEST_W / 2 * GFX_MESH_FRAC_ONE, (TEST_H - 2) * GFX_MESH_FRAC_ONE, TEST_TEX_W / 2, TEST_TEX_H - 1},
+        };
+
+        gfx_sw_blend_perf_reset(&stats);
+        gfx_sw_blend_perf_bind(&stats);
+        gfx_sw_blend_img_triangle_draw((gfx_color_t *)s_dst_out, TEST_W, &buf_area, &buf_area,
+                                       (const gfx_color_t *)s_tex, TEST_TEX_W, TEST_TEX_H, NULL, TEST_TEX_W,
+                                       0xFF, &v[0], &v[1], &v[2], GFX_BLEND_TRI_AA_INWARD, NULL, 0, false);
+        gfx_sw_blend_perf_unbind();
+        TEST_CHECK(stats.triangle_draw.calls == 1);
+        TEST_CHECK(stats.triangle_covered_pixels < stats.triangle_draw.pixels);
+        TEST_CHECK(stats.triangle_aa_pixels * 2 < stats.triangle_covered_pixels);
+    }
+    return 0;
+}
+
+/* Winding number of the polygon around (px, py), both in mesh subpixels */
+static int poly_winding(const int32_t *vx, const int32_t *vy, int n, int32_t px, int32_t py)
+{
+    int wn = 0;
+
+    for (int i = 0; i < n; i++) {
+        int j = (i + 1 < n) ? i + 1 : 0;
+        int64_t side = (int64_t)(vx[j] - vx[i]) * (py - vy[i]) - (int64_t)(px - vx[i]) * (vy[j] - vy[i]);
+        if (vy[i] <= py && vy[j] > py && side > 0) {
+            wn++;
+        } else if (vy[j] <= py && vy[i] > py && side < 0) {
+            wn--;
+        }
+    }
+    return wn;
+}
+
+/*
+ * Polygon coverage against 16x16 supersampling. Each shape is a star-shaped
+ * outer ring joined by a bridge to a smaller inner ring, wound the same way
+ * (a hole only for even-odd) or the other way (a hole for both rules). Only
+ * the green channel of a white-on-black draw is compared, with room for the
+ * sampling error; pixels near half coverage are skipped since inward AA may
+ * drop them.
+ */
+static int test_polygon_coverage(void)
+{
+    /* cos/sin of 0, 30, ... 330 degrees, x1000 */
+    static const int16_t dir_x[12] = {1000, 866, 500, 0, -500, -866, -1000, -866, -500, 0, 500, 866};
+    static const int16_t dir_y[12] = {0, 500, 866, 1000, 866, 500, 0, -500, -866, -1000, -866, -500};
+    const int ss = 16;
+    const gfx_opa_t opa = 200;
+    gfx_area_t buf_area = {0, 0, TEST_W, TEST_H};
+
+    for (int round = 0; round < 40; round++) {
+        gfx_sw_blend_fill_rule_t rule = (gfx_sw_blend_fill_rule_t)(round & 1);
+        bool inner_reversed = (round & 2) != 0;
+        int32_t cx = 36 * GFX_MESH_FRAC_ONE + (int32_t)(rnd() % GFX_MESH_FRAC_ONE);
+        int32_t cy = 28 * GFX_MESH_FRAC_ONE + (int32_t)(rnd() % GFX_MESH_FRAC_ONE);
+        int32_t vx[26], vy[26];
+        int n = 0;
+
+        for (int i = 0; i <= 12; i++) {
+            int32_t r = (16 + (int32_t)(rnd() % 14)) * GFX_MESH_FRAC_ONE;
+            vx[n] = cx + r * dir_x[i % 12] / 1000;
+            vy[n++] = cy + r * dir_y[i % 12] / 1000;
+        }
+        vx[12] = vx[0];
+        vy[12] = vy[0];
+        for (int i = 0; i <= 12; i++) {
+            int k = inner_reversed ? (12 - i) % 12 : i % 12;
+            int32_t r = (4 + (int32_t)(rnd() % 8)) * GFX_MESH_FRAC_ONE;
+            vx[n] = cx + r * dir_x[k] / 1000;
+            vy[n++] = cy + r * dir_y[k] / 1000;
+        }
+        vx[25] = vx[13];
+        vy[25] = vy[13];
+        memset(s_dst_out, 0, sizeof(s_dst_out));
+        gfx_sw_blend_polygon_fill((gfx_color_t *)s_dst_out, TEST_W, &buf_area, &buf_area,
+                                  (gfx_color_t) {
+            .full = 0xFFFF
+        }, opa, vx, vy, n, rule, false);
+
+        for (int32_t y = 0; y < 56; y++) {
+            for (int32_t x = 0; x < 72; x++) {
+                int inside = 0;
+                for (int sy = 0; sy < ss; sy++) {
+                    for (int sx = 0; sx < ss; sx++) {
+                        int wn = poly_winding(vx, vy, n, x * GFX_MESH_FRAC_ONE + (2 * sx + 1) * GFX_MESH_FRAC_ONE / (2 * ss),
+                                              y * GFX_MESH_FRAC_ONE + (2 * sy + 1) * GFX_MESH_FRAC_ONE / (2 * ss));
+                        inside += (rule == GFX_SW_BLEND_FILL_EVEN_ODD) ? (wn & 1) : (wn != 0);
+                    }
+                }
+                int32_t a = ((inside * 255 + ss * ss / 2) / (ss * ss) * opa + 128) >> 8;
+                int32_t g_exp = (63 * ((a + 4) >> 3)) >> 5;
+                int32_t g = (s_dst_out[y * TEST_W + x] >> 5) & 0x3F;
+                int32_t tol = (inside == 0 || inside == ss * ss) ? 2 : 6;
+
+                if (inside > ss * ss * 2 / 5 && inside < ss * ss * 3 / 5) {
+                    continue;
+                }
+                if (inside < ss * ss * 2 / 5 && g > tol) {
+                    fprintf(stderr, "polygon pixel %d,%d: %d/%d covered but drawn (rule %d)\n",
+                            (int)x, (int)y, inside, ss * ss, (int)rule);
+                    return 1;
+                }
+                if (inside > ss * ss * 3 / 5 && abs(g - g_exp) > tol) {
+                    fprintf(stderr, "polygon pixel %d,%d: %d/%d covered, green %d expected %d (rule %d)\n",
+                            (int)x, (int)y, inside, ss * ss, (int)g, (int)g_exp, (int)rule);
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+ * Clipping must not change coverage: a many-vertex polygon (heap scratch)
+ * drawn through narrow clip strips gives the same image as one full draw.
+ * Odd rounds draw the strips from a bound scratch, which must stay allocated.
+ */
+static int test_polygon_clip(void)
+{
+    static int32_t vx[300], vy[300];
+    gfx_area_t buf_area = {0, 0, TEST_W, TEST_H};
+    gfx_blend_scratch_t scratch = {0};
+
+    for (int round = 0; round < 8; round++) {
+        gfx_sw_blend_fill_rule_t rule = (gfx_sw_blend_fill_rule_t)(round & 1);
+        gfx_opa_t opa = random_opa();
+        bool swap = (rnd() & 1) != 0;
+        uint16_t color = (uint16_t)rnd();
+
+        /* Star-ish outline winding around the centre several times */
+        for (int i = 0; i < 300; i++) {
+            int32_t r = (int32_t)(rnd() % (TEST_H * GFX_MESH_FRAC_ONE / 2));
+            int32_t k = (i * 7) % 300;
+            /* Crude sin/cos from a parabola keeps the test free of libm */
+            int32_t t = (k % 75) * 1000 / 75;
+            int32_t s = t * (1000 - t) * 4 / 1000;
+            int32_t c = 1000 - s;
+            int q = k / 75;
+            int32_t dx = (q == 0 || q == 3) ? c : -c;
+            int32_t dy = (q < 2) ? s : -s;
+            vx[i] = TEST_W * GFX_MESH_FRAC_ONE / 2 + (int32_t)((int64_t)r * dx / 1000) * 3 / 2;
+            vy[i] = TEST_H * GFX_MESH_FRAC_ONE / 2 + (int32_t)((int64_t)r * dy / 1000);
+        }
+
+        randomize();
+        memcpy(s_dst_ref, s_dst_init, sizeof(s_dst_ref));
+        memcpy(s_dst_out, s_dst_init, sizeof(s_dst_out));
+        gfx_sw_blend_polygon_fill((gfx_color_t *)s_dst_ref, TEST_W, &buf_area, &buf_area,
+                                  (gfx_color_t) {
+            .full = color
+        }, opa, vx, vy, 300, rule, swap);
+        gfx_sw_blend_scratch_bind((round & 1) ? &scratch : NULL);
+        for (gfx_coord_t x = 0; x < TEST_W;) {
+            gfx_coord_t w = (gfx_coord_t)(1 + rnd() % 23);
+            gfx_coord_t y = (gfx_coord_t)(rnd() % 16);
+            gfx_area_t strip = {x, 0, (gfx_coord_t)MIN(x + w, TEST_W), y};
+
+            /* Two bands per strip so the top/bottom clip is exercised too */
+            gfx_sw_blend_polygon_fill((gfx_color_t *)s_dst_out, TEST_W, &buf_area, &strip,
+                                      (gfx_color_t) {
+                .full = color
+            }, opa, vx, vy, 300, rule, swap);
+            strip.y1 = y;
+            strip.y2 = TEST_H;
+            gfx_sw_blend_polygon_fill((gfx_color_t *)s_dst_out, TEST_W, &buf_area, &strip,
+                                      (gfx_color_t) {
+                .full = color
+            }, opa, vx, vy, 300, rule, swap);
+            x = strip.x2;
+        }
+        gfx_sw_blend_scratch_bind(NULL);
+        if (memcmp(s_dst_ref, s_dst_out, sizeof(s_dst_ref)) != 0) {
+            fprintf(stderr, "clipped polygon differs from full draw (round %d)\n", round);
+            gfx_sw_blend_scratch_free(&scratch);
+            return 1;
+        }
+    }
+    TEST_CHECK(scratch.buf != NULL && scratch.size > 0);
+    gfx_sw_blend_scratch_free(&scratch);
+    TEST_CHECK(scratch.buf == NULL && scratch.size == 0);
+    return 0;
+}
+
+/*
+ * A premultiplied copy of the straight-alpha texture must look the same as
+ * the straight draw: alpha 0 and 255 exactly, anything else within rounding.
+ */
+static int test_premul_image(void)
+{
+    static uint16_t premul[TEST_TEX_W * TEST_TEX_H];
+    int max_diff[3] = {0};
+
+    for (int round = 0; round < 64; round++) {
+        bool swap = (rnd() & 1) != 0;
+        gfx_area_t clip = {0, 0, TEST_TEX_W, TEST_TEX_H};
+
+        randomize();
+        for (size_t i = 0; i < TEST_TEX_W * TEST_TEX_H; i++) {
+            premul[i] = premultiply_rgb565(s_tex[i], s_tex_mask[i], swap);
+        }
+        memcpy(s_dst_ref, s_dst_init, sizeof(s_dst_ref));
+        memcpy(s_dst_out, s_dst_init, sizeof(s_dst_out));
+        gfx_sw_blend_img_draw((gfx_color_t *)s_dst_ref, TEST_W, (const gfx_color_t *)s_tex, TEST_TEX_W,
+                              s_tex_mask, TEST_TEX_W, &clip, swap);
+        gfx_sw_blend_img_premul_draw((gfx_color_t *)s_dst_out, TEST_W, (const gfx_color_t *)premul, TEST_TEX_W,
+                                     s_tex_mask, TEST_TEX_W, &clip, swap);
+
+        for (int y = 0; y < TEST_TEX_H; y++) {
+            for (int x = 0; x < TEST_TEX_W; x++) {
+                uint8_t a = s_tex_mask[y * TEST_TEX_W + x];
+                uint16_t ref = s_dst_ref[y * TEST_W + x];
+                uint16_t out = s_dst_out[y * TEST_W + x];
+
+                if (a == 0 || a == 255) {
+                    TEST_CHECK(out == ref);
+                    continue;
+                }
+                if (swap) {
+                    ref = (uint16_t)(ref << 8 | ref >> 8);
+                    out = (uint16_t)(out << 8 | out >> 8);
+                }
+                max_diff[0] = MAX(max_diff[0], abs((int)(ref >> 11) - (int)(out >> 11)));
+                max_diff[1] = MAX(max_diff[1], abs((int)((ref >> 5) & 0x3F) - (int)((out >> 5) & 0x3F)));
+                max_diff[2] = MAX(max_diff[2], abs((int)(ref & 0x1F) - (int)(out & 0x1F)));
+            }
+        }
+        /* Outside the image nothing is touched */
+        TEST_CHECK(memcmp(s_dst_out + TEST_TEX_H * TEST_W, s_dst_init + TEST_TEX_H * TEST_W,
+                          sizeof(uint16_t) * (TEST_H - TEST_TEX_H) * TEST_W) == 0);
+    }
+    /* Both paths quantize the weight to 5 bits, rounding differently */
+    TEST_CHECK(max_diff[0] <= 2 && max_diff[1] <= 2 && max_diff[2] <= 2);
+    return 0;
+}
+
+static int test_registry(void)
+{
+    gfx_blend_backend_t partial = gfx_blend_backend_scalar;
+
+    TEST_CHECK(gfx_blend_backend_count() >= 1);
+    TEST_CHECK(gfx_blend_backend_at(0) == &gfx_blend_backend_scalar);
+    TEST_CHECK(gfx_blend_backend_at(gfx_blend_backend_count()) == NULL);
+    TEST_CHECK(gfx_blend_backend_get() == gfx_blend_backend_at(gfx_blend_backend_count() - 1));
+
+    partial.premul_draw = NULL;
+    TEST_CHECK(gfx_blend_backend_set(&partial) == ESP_ERR_INVALID_ARG);
+    partial.premul_draw = gfx_blend_backend_scalar.premul_draw;
+    partial.poly_span = NULL;
+    TEST_CHECK(gfx_blend_backend_set(&partial) == ESP_ERR_INVALID_ARG);
+    TEST_CHECK(gfx_blend_backend_get() == gfx_blend_backend_at(gfx_blend_backend_count() - 1));
+    return 0;
+}
+
+static int64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static double bench_kernel(const gfx_blend_backend_t *be, test_kernel_t k)
+{
+    static uint16_t dst[TEST_W * TEST_H];
+    int32_t w = TEST_W;
+    int32_t h = TEST_H;
+    int64_t start = now_ns();
+    int64_t elapsed;
+    uint64_t pixels = 0;
+
+    memcpy(dst, s_dst_init, sizeof(dst));
+    do {
+        for (int i = 0; i < 16; i++) {
+            gfx_opa_t opa = (k == KERNEL_COLOR_DRAW_OPA) ? 180 : 255;
+            run_kernel(be, k, dst, 0, 0, w, h, 0x1234, opa, true, true, 0x9E3779B9U);
+            pixels += (uint64_t)((k == KERNEL_IMAGE_DRAW || k == KERNEL_PREMUL_DRAW) ? MIN(w, TEST_TEX_W) * MIN(h, TEST_TEX_H) : w * h);
+        }
+        elapsed = now_ns() - start;
+    } while (elapsed < BENCH_MIN_NS);
+
+    return (double)pixels * 1000.0 / (double)elapsed;
+}
+
+static void bench_report(void)
+{
+    size_t count = gfx_blend_backend_count();
+
+    randomize();
+    printf("%-16s", "kernel Mpix/s");
+    for (size_t b = 0; b < count; b++) {
+        printf("%12s", gfx_blend_backend_at(b)->name);
+    }
+    printf("\n");
+    for (int k = 0; k < KERNEL_COUNT; k++) {
+        double scalar = bench_kernel(gfx_blend_backend_at(0), (test_kernel_t)k);
+
+        printf("%-16s%12.1f", s_kernel_names[k], scalar);
+        for (size_t b = 1; b < count; b++) {
+            double mpix = bench_kernel(gfx_blend_backend_at(b), (test_kernel_t)k);
+            printf("%8.1f x%.2f", mpix, mpix / scalar);
+        }
+        printf("\n");
+    }
+}
+
+int main(void)
+{
+    int fails = 0;
+
+    fails += test_registry();
+    fails += test_triangle_blocks();
+    fails += test_polygon_coverage();
+    fails += test_polygon_clip();
+    fails += test_premul_image();
+    for (size_t b = 0; b < gfx_blend_backend_count(); b++) {
+        const gfx_blend_backend_t *be = gfx_blend_backend_at(b);
+
+        fails += test_kernels(be);
+        fails += test_entry_points(be);
+        printf("backend %-8s %s\n", be->name, fails ? "FAILED" : "matches scalar");
+    }
+    if (fails == 0) {
+        bench_report();
+    }
+
+    printf("%s\n", fails ? "FAILED" : "OK");
+    return fails ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,528 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host test of the options the default host config leaves off, linked
+ * against esp_emote_gfx_opt (see host/CMakeLists.txt). Checks that stripe
+ * workers render the same pixels as the render task alone, the ordering
+ * and per-class sums of the per-object perf counters, and that a traced frame
+ * dumps as well-formed trace-event JSON with balanced B/E spans.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gfx.h"
+#include "gfx_host_fb.h"
+
+#define TEST_H_RES      128
+#define TEST_V_RES      96
+#define TEST_IMG_W      32
+#define TEST_IMG_H      24
+#define TEST_TIMEOUT_MS 2000
+
+/* A partial buffer this short never splits into stripes */
+#define TEST_SINGLE_ROWS    CONFIG_GFX_RENDER_STRIPE_MIN_ROWS
+
+#define TEST_PERF_FRAMES    4
+
+#define TEST_TRACE_MAX_TIDS 8
+#define TEST_TRACE_MAX_DEPTH 16
+
+#define TEST_FONT_BOX_W     6
+#define TEST_FONT_BOX_H     10
+
+#define TEST_CHECK(cond) do {                                               \
+        if (!(cond)) {                                                      \
+            fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                       \
+        }                                                                   \
+    } while (0)
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t cap;
+} test_text_t;
+
+typedef struct {
+    unsigned tid;
+    unsigned depth;
+    char names[TEST_TRACE_MAX_DEPTH][32];
+} test_trace_stack_t;
+
+static uint16_t s_img_pixels[TEST_IMG_W * TEST_IMG_H];
+
+/* 8 bpp font whose printable ASCII all map to one graded box, enough to drive the label path */
+static uint8_t s_font_bitmap[TEST_FONT_BOX_W * TEST_FONT_BOX_H];
+static const uint8_t s_font_gid_ofs['~' - ' ' + 1];
+static const lv_font_fmt_txt_glyph_dsc_t s_font_glyphs[] = {
+    {0},
+    {.bitmap_index = 0, .adv_w = (TEST_FONT_BOX_W + 1) * 16, .box_w = TEST_FONT_BOX_W, .box_h = TEST_FONT_BOX_H},
+};
+static const lv_font_fmt_txt_cmap_t s_font_cmaps[] = {
+    {
+        .range_start = ' ',
+        .range_length = sizeof(s_font_gid_ofs),
+        .glyph_id_start = 1,
+        .glyph_id_ofs_list = s_font_gid_ofs,
+        .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL,
+    },
+};
+static const lv_font_fmt_txt_dsc_t s_font_dsc = {
+    .glyph_bitmap = s_font_bitmap,
+    .glyph_dsc = s_font_glyphs,
+    .cmaps = s_font_cmaps,
+    .cmap_num = 1,
+    .bpp = 8,
+};
+static const lv_font_t s_font = {
+    .line_height = TEST_FONT_BOX_H + 2,
+    .base_line = 2,
+    .dsc = &s_font_dsc,
+};
+
+static void test_assets_init(void)
+{
+    for (size_t i = 0; i < TEST_IMG_W * TEST_IMG_H; i++) {
+        s_img_pixels[i] = (uint16_t)(0xF800 | (i & 0x07FF));
+    }
+    for (size_t i = 0; i < sizeof(s_font_bitmap); i++) {
+        s_font_bitmap[i] = (uint8_t)(64 + (i * 37) % 192);
+    }
+}
+
+/**
+ * Render a scene of aligned, nested and overlapping widgets for two frames and
+ * return the panel checksum after each. A full-frame buffer is split into
+ * stripes; a TEST_SINGLE_ROWS partial buffer is drawn by the render task alone.
+ */
+static int test_stripe_scene(bool striped, uint32_t checksum[2])
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    disp_cfg.flags.double_buffer = 1;
+    disp_cfg.flags.full_frame = striped;
+    disp_cfg.buffers.buf_pixels = (size_t)TEST_H_RES * (striped ? TEST_V_RES : TEST_SINGLE_ROWS);
+    fb.full_frame = striped;
+
+    gfx_image_dsc_t img_dsc = {
+        .header = {
+            .magic = C_ARRAY_HEADER_MAGIC,
+            .cf = GFX_COLOR_FORMAT_RGB565,
+            .w = TEST_IMG_W,
+            .h = TEST_IMG_H,
+            .stride = TEST_IMG_W * 2,
+        },
+        .data_size = sizeof(s_img_pixels),
+        .data = (const uint8_t *)s_img_pixels,
+    };
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    gfx_disp_set_bg_color(disp, GFX_COLOR_HEX(0x0000FF));
+
+    gfx_obj_t *cont = gfx_cont_create(disp);
+    TEST_CHECK(cont != NULL);
+    TEST_CHECK(gfx_cont_set_bg_color(cont, GFX_COLOR_HEX(0x00FF00)) == ESP_OK);
+    TEST_CHECK(gfx_cont_set_bg_enable(cont, true) == ESP_OK);
+    gfx_obj_set_size(cont, 60, 50);
+    gfx_obj_align(cont, GFX_ALIGN_CENTER, 0, 0);
+
+    gfx_obj_t *img = gfx_img_create(disp);
+    TEST_CHECK(img != NULL);
+    TEST_CHECK(gfx_img_set_src(img, &img_dsc) == ESP_OK);
+    TEST_CHECK(gfx_obj_set_parent(img, cont) == ESP_OK);
+    gfx_obj_align(img, GFX_ALIGN_BOTTOM_RIGHT, 8, 6);
+
+    gfx_obj_t *qr = gfx_qrcode_create(disp);
+    TEST_CHECK(qr != NULL);
+    TEST_CHECK(gfx_qrcode_set_data(qr, "esp_emote_gfx") == ESP_OK);
+    TEST_CHECK(gfx_qrcode_set_size(qr, 40) == ESP_OK);
+    gfx_obj_align_to(qr, cont, GFX_ALIGN_OUT_TOP_LEFT, -4, 20);
+
+    gfx_obj_t *label = gfx_label_create(disp);
+    TEST_CHECK(label != NULL);
+    TEST_CHECK(gfx_label_set_font(label, (gfx_font_t)&s_font) == ESP_OK);
+    TEST_CHECK(gfx_label_set_color(label, GFX_COLOR_HEX(0xFFFF00)) == ESP_OK);
+    gfx_obj_set_size(label, 90, 30);
+    TEST_CHECK(gfx_label_set_text(label, "stripe workers") == ESP_OK);
+    gfx_obj_align(label, GFX_ALIGN_BOTTOM_MID, 0, -2);
+
+    uint32_t frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    /* Moving the container re-resolves every position that depends on it */
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    checksum[0] = gfx_host_fb_checksum(&fb);
+    frames = gfx_host_fb_frame_count(&fb);
+    gfx_obj_align(cont, GFX_ALIGN_CENTER, 13, -9);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    checksum[1] = gfx_host_fb_checksum(&fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+/** Stripe workers must produce the same pixels as the single-threaded render */
+static int test_stripes(void)
+{
+    uint32_t single[2];
+    uint32_t striped[2];
+
+    TEST_CHECK(test_stripe_scene(false, single) == 0);
+    TEST_CHECK(test_stripe_scene(true, striped) == 0);
+    printf("stripes: single %08x/%08x, %d workers %08x/%08x\n",
+           (unsigned)single[0], (unsigned)single[1], CONFIG_GFX_RENDER_STRIPE_WORKERS,
+           (unsigned)striped[0], (unsigned)striped[1]);
+    TEST_CHECK(single[0] == striped[0]);
+    TEST_CHECK(single[1] == striped[1]);
+    TEST_CHECK(single[0] != single[1]);
+    return 0;
+}
+
+static uint64_t test_obj_cost(const gfx_obj_perf_stats_t *stats)
+{
+    return stats->draw.time_us + stats->update.time_us;
+}
+
+/** Top-N is sorted by cost and a prefix of the full list; classes sum their objects */
+static int test_obj_perf(void)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    disp_cfg.flags.double_buffer = 1;
+    disp_cfg.flags.full_frame = true;
+    disp_cfg.buffers.buf_pixels = TEST_H_RES * TEST_V_RES;
+    fb.full_frame = true;
+
+    gfx_image_dsc_t img_dsc = {
+        .header = {
+            .magic = C_ARRAY_HEADER_MAGIC,
+            .cf = GFX_COLOR_FORMAT_RGB565,
+            .w = TEST_IMG_W,
+            .h = TEST_IMG_H,
+            .stride = TEST_IMG_W * 2,
+        },
+        .data_size = sizeof(s_img_pixels),
+        .data = (const uint8_t *)s_img_pixels,
+    };
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+
+    /* Two images, one half off screen, and a container: two classes, three objects */
+    gfx_obj_t *img_a = gfx_img_create(disp);
+    gfx_obj_t *img_b = gfx_img_create(disp);
+    gfx_obj_t *cont = gfx_cont_create(disp);
+    TEST_CHECK(img_a != NULL && img_b != NULL && cont != NULL);
+    TEST_CHECK(gfx_img_set_src(img_a, &img_dsc) == ESP_OK);
+    TEST_CHECK(gfx_img_set_src(img_b, &img_dsc) == ESP_OK);
+    gfx_obj_set_pos(img_a, 4, 4);
+    gfx_obj_set_pos(img_b, TEST_H_RES - TEST_IMG_W / 2, 40);
+    TEST_CHECK(gfx_cont_set_bg_enable(cont, true) == ESP_OK);
+    gfx_obj_set_size(cont, TEST_H_RES, TEST_V_RES);
+    TEST_CHECK(gfx_obj_move_to_back(cont) == ESP_OK);
+    TEST_CHECK(gfx_disp_reset_obj_perf_stats(disp) == ESP_OK);
+
+    gfx_refr_batch_config_t batch_cfg = {
+        .frames = TEST_PERF_FRAMES,
+        .invalidate_all = true,
+        .flush = GFX_REFR_BATCH_FLUSH_NONE,
+    };
+    gfx_refr_batch_stats_t batch;
+    TEST_CHECK(gfx_refr_batch(handle, &batch_cfg, &batch) == ESP_OK);
+    TEST_CHECK(batch.rendered_frames == TEST_PERF_FRAMES);
+
+    gfx_obj_perf_stats_t objs[4];
+    size_t obj_count;
+    TEST_CHECK(gfx_disp_get_obj_perf_stats(disp, objs, 4, &obj_count) == ESP_OK);
+    TEST_CHECK(obj_count == 3);
+    for (size_t i = 1; i < obj_count; i++) {
+        TEST_CHECK(test_obj_cost(&objs[i - 1]) >= test_obj_cost(&objs[i]));
+    }
+
+    /* Covered pixels are exact even when stripes split the draws */
+    uint64_t img_pixels = 0;
+    uint64_t img_calls = 0;
+    for (size_t i = 0; i < obj_count; i++) {
+        uint64_t expect;
+        if (objs[i].trace_id == gfx_obj_get_trace_id(img_a)) {
+            expect = (uint64_t)TEST_IMG_W * TEST_IMG_H;
+        } else if (objs[i].trace_id == gfx_obj_get_trace_id(img_b)) {
+            expect = (uint64_t)(TEST_IMG_W / 2) * TEST_IMG_H;
+        } else {
+            TEST_CHECK(objs[i].trace_id == gfx_obj_get_trace_id(cont));
+            expect = (uint64_t)TEST_H_RES * TEST_V_RES;
+        }
+        TEST_CHECK(objs[i].draw.pixels == expect * TEST_PERF_FRAMES);
+        TEST_CHECK(objs[i].draw.calls >= TEST_PERF_FRAMES);
+        if (objs[i].trace_id != gfx_obj_get_trace_id(cont)) {
+            img_pixels += objs[i].draw.pixels;
+            img_calls += objs[i].draw.calls;
+        }
+    }
+
+    gfx_obj_perf_stats_t top[2];
+    size_t top_count;
+    TEST_CHECK(gfx_disp_get_obj_perf_stats(disp, top, 2, &top_count) == ESP_OK);
+    TEST_CHECK(top_count == 2);
+    TEST_CHECK(test_obj_cost(&top[0]) == test_obj_cost(&objs[0]));
+    TEST_CHECK(test_obj_cost(&top[1]) == test_obj_cost(&objs[1]));
+
+    gfx_class_perf_stats_t classes[4];
+    size_t class_count;
+    TEST_CHECK(gfx_disp_get_class_perf_stats(disp, classes, 4, &class_count) == ESP_OK);
+    TEST_CHECK(class_count == 2);
+    TEST_CHECK(classes[0].draw.time_us + classes[0].update.time_us >=
+               classes[1].draw.time_us + classes[1].update.time_us);
+    for (size_t i = 0; i < class_count; i++) {
+        if (strcmp(classes[i].class_name, "image") == 0) {
+            TEST_CHECK(classes[i].obj_count == 2);
+            TEST_CHECK(classes[i].draw.pixels == img_pixels);
+            TEST_CHECK(classes[i].draw.calls == img_calls);
+        } else {
+            TEST_CHECK(strcmp(classes[i].class_name, "container") == 0);
+            TEST_CHECK(classes[i].obj_count == 1);
+        }
+    }
+
+    /* Deleted objects drop out of both views */
+    TEST_CHECK(gfx_obj_delete(img_b) == ESP_OK);
+    TEST_CHECK(gfx_disp_get_class_perf_stats(disp, classes, 1, &class_count) == ESP_OK);
+    TEST_CHECK(class_count == 1);
+    TEST_CHECK(gfx_disp_get_obj_perf_stats(disp, objs, 4, &obj_count) == ESP_OK);
+    TEST_CHECK(obj_count == 2);
+
+    TEST_CHECK(gfx_disp_reset_obj_perf_stats(disp) == ESP_OK);
+    TEST_CHECK(gfx_disp_get_obj_perf_stats(disp, objs, 4, &obj_count) == ESP_OK);
+    TEST_CHECK(objs[0].draw.calls == 0 && objs[0].draw.pixels == 0 && test_obj_cost(&objs[0]) == 0);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+static void test_text_write(const char *data, size_t len, void *user_data)
+{
+    test_text_t *text = (test_text_t *)user_data;
+
+    if (text->len + len + 1 > text->cap) {
+        size_t cap = (text->cap + len + 1) * 2;
+        char *grown = realloc(text->data, cap);
+        if (grown == NULL) {
+            return;
+        }
+        text->data = grown;
+        text->cap = cap;
+    }
+    memcpy(text->data + text->len, data, len);
+    text->len += len;
+    text->data[text->len] = '\0';
+}
+
+/** Brackets nest, strings close and no comma precedes a closing bracket */
+static bool test_json_well_formed(const char *json)
+{
+    char stack[8];
+    size_t depth = 0;
+    char prev = 0;
+
+    for (const char *p = json; *p != '\0'; p++) {
+        char c = *p;
+
+        if (c == '"') {
+            for (p++; *p != '"'; p++) {
+                if (*p == '\0' || *p == '\n') {
+                    return false;
+                }
+                if (*p == '\\' && p[1] != '\0') {
+                    p++;
+                }
+            }
+        } else if (c == '{' || c == '[') {
+            if (depth == sizeof(stack)) {
+                return false;
+            }
+            stack[depth++] = (c == '{') ? '}' : ']';
+        } else if (c == '}' || c == ']') {
+            if (depth == 0 || stack[--depth] != c || prev == ',') {
+                return false;
+            }
+        } else if (c == ' ' || c == '\n') {
+            continue;
+        }
+        prev = c;
+    }
+    return depth == 0 && prev == '}';
+}
+
+/** Every E closes the innermost open B of the same name on its task, and nothing stays open */
+static int test_trace_balanced(const char *json, size_t *out_spans)
+{
+    test_trace_stack_t stacks[TEST_TRACE_MAX_TIDS];
+    size_t stack_count = 0;
+    size_t spans = 0;
+
+    for (const char *line = strstr(json, "{\"name\""); line != NULL; line = strstr(line + 1, "\n{\"name\"")) {
+        char name[32];
+        char phase;
+        long long ts;
+        unsigned tid;
+
+        if (*line == '\n') {
+            line++;
+        }
+        TEST_CHECK(sscanf(line, "{\"name\":\"%31[^\"]\",\"cat\":\"gfx\",\"ph\":\"%c\",\"ts\":%lld,\"pid\":1,\"tid\":%u",
+                          name, &phase, &ts, &tid) == 4);
+        TEST_CHECK(phase == 'B' || phase == 'E');
+
+        size_t i = 0;
+        while (i < stack_count && stacks[i].tid != tid) {
+            i++;
+        }
+        if (i == stack_count) {
+            TEST_CHECK(stack_count < TEST_TRACE_MAX_TIDS);
+            stacks[stack_count].tid = tid;
+            stacks[stack_count].depth = 0;
+            stack_count++;
+        }
+
+        test_trace_stack_t *st = &stacks[i];
+        if (phase == 'B') {
+            TEST_CHECK(st->depth < TEST_TRACE_MAX_DEPTH);
+            snprintf(st->names[st->depth++], sizeof(st->names[0]), "%s", name);
+        } else {
+            TEST_CHECK(st->depth > 0);
+            TEST_CHECK(strcmp(st->names[--st->depth], name) == 0);
+            spans++;
+        }
+    }
+    for (size_t i = 0; i < stack_count; i++) {
+        TEST_CHECK(stacks[i].depth == 0);
+    }
+    *out_spans = spans;
+    return 0;
+}
+
+/** A frame recorded between clear and stop dumps as balanced trace-event JSON */
+static int test_trace(void)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    disp_cfg.flags.double_buffer = 1;
+
+    gfx_image_dsc_t img_dsc = {
+        .header = {
+            .magic = C_ARRAY_HEADER_MAGIC,
+            .cf = GFX_COLOR_FORMAT_RGB565,
+            .w = TEST_IMG_W,
+            .h = TEST_IMG_H,
+            .stride = TEST_IMG_W * 2,
+        },
+        .data_size = sizeof(s_img_pixels),
+        .data = (const uint8_t *)s_img_pixels,
+    };
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    gfx_obj_t *img = gfx_img_create(disp);
+    TEST_CHECK(img != NULL);
+    TEST_CHECK(gfx_img_set_src(img, &img_dsc) == ESP_OK);
+    gfx_obj_set_pos(img, 8, 8);
+    gfx_obj_t *label = gfx_label_create(disp);
+    TEST_CHECK(label != NULL);
+    TEST_CHECK(gfx_label_set_font(label, (gfx_font_t)&s_font) == ESP_OK);
+    gfx_obj_set_size(label, 80, 16);
+    TEST_CHECK(gfx_label_set_text(label, "trace") == ESP_OK);
+    gfx_obj_align(label, GFX_ALIGN_BOTTOM_MID, 0, 0);
+
+    /* The render task is parked on the lock, so no span is open when recording stops */
+    TEST_CHECK(gfx_trace_start() == ESP_OK);
+    TEST_CHECK(gfx_trace_clear() == ESP_OK);
+    gfx_refr_batch_config_t batch_cfg = {
+        .frames = 1,
+        .invalidate_all = true,
+        .flush = GFX_REFR_BATCH_FLUSH_DISPLAY,
+    };
+    gfx_refr_batch_stats_t batch;
+    TEST_CHECK(gfx_refr_batch(handle, &batch_cfg, &batch) == ESP_OK);
+    TEST_CHECK(gfx_trace_stop() == ESP_OK);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    test_text_t text = {0};
+    TEST_CHECK(gfx_trace_dump(test_text_write, &text) == ESP_OK);
+    TEST_CHECK(text.data != NULL);
+    TEST_CHECK(strncmp(text.data, "{\"traceEvents\":[", 16) == 0);
+    TEST_CHECK(test_json_well_formed(text.data));
+    size_t spans = 0;
+    TEST_CHECK(test_trace_balanced(text.data, &spans) == 0);
+    TEST_CHECK(spans > 0);
+    TEST_CHECK(strstr(text.data, "\"name\":\"chunk\"") != NULL);
+    printf("trace: %u bytes, %u spans\n", (unsigned)text.len, (unsigned)spans);
+
+    /* Cleared, the dump is an empty but still valid document */
+    TEST_CHECK(gfx_trace_clear() == ESP_OK);
+    text.len = 0;
+    TEST_CHECK(gfx_trace_dump(test_text_write, &text) == ESP_OK);
+    TEST_CHECK(test_json_well_formed(text.data));
+    TEST_CHECK(strstr(text.data, "\"ph\"") == NULL);
+    free(text.data);
+
+    TEST_CHECK(gfx_trace_start() == ESP_OK);
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+int main(void)
+{
+    int fails = 0;
+
+    gfx_log_set_level_all(GFX_LOG_LEVEL_WARN);
+    test_assets_init();
+    fails += test_stripes();
+    fails += test_obj_perf();
+    fails += test_trace();
+
+    printf("%s\n", fails ? "FAILED" : "OK");
+    return fails ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,1263 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host smoke test: render an image and a QR code into the RAM framebuffer
+ * with partial and full-frame buffers and check pixels where they must be.
+ * Also checks headless batch rendering, that timers on the virtual clock
+ * only fire when it is stepped, the cross-task command queue, that an idle
+ * render task sleeps until an invalidation or a new timer wakes it, the
+ * frame scheduler's period and late-timer reporting, that containers
+ * clip, move, hide and delete their children, that restacking objects
+ * changes which one is drawn on top, that a rebuilt bitmap cache
+ * follows its object's alignment, that copy-on-move blits a lone opaque
+ * image (and refuses when another object is in its path) with the same
+ * result as a full redraw, that pipelined flush statistics
+ * report the transfer time of a slow panel, and that many small
+ * invalidations flush disjoint rectangles and leave the same image as a
+ * software reference. Also built against the dirty-tile engine
+ * (host_render_tiles).
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_timer.h"
+
+#include "gfx.h"
+#include "gfx_host_fb.h"
+#include "core/display/gfx_refr_priv.h"
+#include "core/object/gfx_obj_priv.h"
+
+#define TEST_H_RES      128
+#define TEST_V_RES      96
+#define TEST_IMG_W      32
+#define TEST_IMG_H      24
+#define TEST_TIMEOUT_MS 2000
+
+#define TEST_CMD_RING_LEN       32      /* CONFIG_GFX_CMD_QUEUE_LEN on the host */
+#define TEST_CMD_PRODUCERS      2
+#define TEST_CMD_PER_PRODUCER   500
+
+#define TEST_COVER_W            16
+#define TEST_COVER_H            16
+
+#define TEST_DIRTY_OBJS         12
+#define TEST_DIRTY_OBJ_W        7
+#define TEST_DIRTY_OBJ_H        5
+#define TEST_DIRTY_FRAMES       24
+#define TEST_DIRTY_MAX_FLUSHES  256
+
+#define TEST_SLOW_OBJ_TYPE      0xF0
+#define TEST_SLOW_DRAW_US       8000    /* Every chunk takes this long to draw ... */
+#define TEST_SLOW_FLUSH_US      2000    /* ... and this long to transfer, so transfers hide behind draws */
+#define TEST_SLOW_SLACK_US      2000    /* Scheduling jitter allowed per transfer */
+
+#define TEST_CHECK(cond) do {                                               \
+        if (!(cond)) {                                                      \
+            fprintf(stderr, "FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                       \
+        }                                                                   \
+    } while (0)
+
+static uint16_t s_img_pixels[TEST_IMG_W * TEST_IMG_H];
+
+static int test_render(bool full_frame)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    disp_cfg.flags.double_buffer = 1;
+    disp_cfg.flags.full_frame = full_frame;
+    if (full_frame) {
+        disp_cfg.buffers.buf_pixels = TEST_H_RES * TEST_V_RES;
+    }
+    fb.full_frame = full_frame;
+
+    for (size_t i = 0; i < TEST_IMG_W * TEST_IMG_H; i++) {
+        s_img_pixels[i] = 0xF800;
+    }
+    gfx_image_dsc_t img_dsc = {
+        .header = {
+            .magic = C_ARRAY_HEADER_MAGIC,
+            .cf = GFX_COLOR_FORMAT_RGB565,
+            .w = TEST_IMG_W,
+            .h = TEST_IMG_H,
+            .stride = TEST_IMG_W * 2,
+        },
+        .data_size = sizeof(s_img_pixels),
+        .data = (const uint8_t *)s_img_pixels,
+    };
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    gfx_disp_set_bg_color(disp, GFX_COLOR_HEX(0x0000FF));
+
+    gfx_obj_t *img = gfx_img_create(disp);
+    TEST_CHECK(img != NULL);
+    TEST_CHECK(gfx_img_set_src(img, &img_dsc) == ESP_OK);
+    gfx_obj_set_pos(img, 8, 8);
+
+    gfx_obj_t *qr = gfx_qrcode_create(disp);
+    TEST_CHECK(qr != NULL);
+    TEST_CHECK(gfx_qrcode_set_data(qr, "esp_emote_gfx") == ESP_OK);
+    TEST_CHECK(gfx_qrcode_set_size(qr, 48) == ESP_OK);
+    gfx_obj_set_pos(qr, 64, 40);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 0, 0) == 0x001F);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 8, 8) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 8 + TEST_IMG_W - 1, 8 + TEST_IMG_H - 1) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 8 + TEST_IMG_W, 8) == 0x001F);
+
+    uint32_t qr_dark = 0;
+    for (uint32_t y = 40; y < 40 + 48; y++) {
+        for (uint32_t x = 64; x < 64 + 48; x++) {
+            qr_dark += (gfx_host_fb_get_pixel(&fb, x, y) == 0x0000);
+        }
+    }
+    TEST_CHECK(qr_dark > 0);
+
+    /* Moving the image must uncover the background and show it at the new place */
+    uint32_t frames = gfx_host_fb_frame_count(&fb);
+    gfx_obj_set_pos(img, 16, 12);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 8, 8) == 0x001F);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 16, 12) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 16 + TEST_IMG_W - 1, 12 + TEST_IMG_H - 1) == 0xF800);
+
+    /* Both frames land in the histograms; the move was timed from its invalidation */
+    gfx_disp_frame_stats_t frame_stats;
+    TEST_CHECK(gfx_disp_get_frame_stats(disp, &frame_stats) == ESP_OK);
+    TEST_CHECK(frame_stats.frame_us.count >= 2);
+    TEST_CHECK(frame_stats.latency_us.count >= 1);
+    TEST_CHECK(frame_stats.frame_us.p50 <= frame_stats.frame_us.p90);
+    TEST_CHECK(frame_stats.frame_us.p90 <= frame_stats.frame_us.p99);
+    TEST_CHECK(frame_stats.frame_us.p99 <= frame_stats.frame_us.max);
+    TEST_CHECK(gfx_disp_reset_frame_stats(disp) == ESP_OK);
+    TEST_CHECK(gfx_disp_get_frame_stats(disp, &frame_stats) == ESP_OK);
+    TEST_CHECK(frame_stats.frame_us.count == 0 && frame_stats.latency_us.max == 0);
+
+    /* Headless batches redraw everything without reaching the panel, then restore its flush_cb */
+    gfx_refr_batch_config_t batch_cfg = {
+        .frames = 4,
+        .invalidate_all = true,
+        .flush = GFX_REFR_BATCH_FLUSH_NONE,
+    };
+    gfx_refr_batch_stats_t batch;
+    frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_refr_batch(handle, &batch_cfg, &batch) == ESP_OK);
+    TEST_CHECK(batch.frames == 4 && batch.rendered_frames == 4);
+    TEST_CHECK(batch.pixels == 4ULL * TEST_H_RES * TEST_V_RES);
+    TEST_CHECK(batch.fps > 0);
+    batch_cfg.flush = GFX_REFR_BATCH_FLUSH_MEMCPY;
+    TEST_CHECK(gfx_refr_batch(handle, &batch_cfg, &batch) == ESP_OK);
+    TEST_CHECK(batch.rendered_frames == 4);
+    TEST_CHECK(gfx_host_fb_frame_count(&fb) == frames);
+    batch_cfg.flush = GFX_REFR_BATCH_FLUSH_DISPLAY;
+    TEST_CHECK(gfx_refr_batch(handle, &batch_cfg, &batch) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_frame_count(&fb) == frames + 4);
+    batch_cfg.step_ms = 10;
+    TEST_CHECK(gfx_refr_batch(handle, &batch_cfg, &batch) == ESP_ERR_INVALID_STATE);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    printf("%s: %u frames, %u flushes, checksum %08x\n", full_frame ? "full_frame" : "partial",
+           (unsigned)gfx_host_fb_frame_count(&fb), (unsigned)gfx_host_fb_flush_count(&fb), (unsigned)gfx_host_fb_checksum(&fb));
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+/** A container clips, moves, hides and deletes its children as one */
+static int test_container(void)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    disp_cfg.flags.double_buffer = 1;
+    disp_cfg.flags.full_frame = true;
+    disp_cfg.buffers.buf_pixels = TEST_H_RES * TEST_V_RES;
+    fb.full_frame = true;
+
+    for (size_t i = 0; i < TEST_IMG_W * TEST_IMG_H; i++) {
+        s_img_pixels[i] = 0xF800;
+    }
+    gfx_image_dsc_t img_dsc = {
+        .header = {
+            .magic = C_ARRAY_HEADER_MAGIC,
+            .cf = GFX_COLOR_FORMAT_RGB565,
+            .w = TEST_IMG_W,
+            .h = TEST_IMG_H,
+            .stride = TEST_IMG_W * 2,
+        },
+        .data_size = sizeof(s_img_pixels),
+        .data = (const uint8_t *)s_img_pixels,
+    };
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    gfx_disp_set_bg_color(disp, GFX_COLOR_HEX(0x0000FF));
+
+    gfx_obj_t *cont = gfx_cont_create(disp);
+    TEST_CHECK(cont != NULL);
+    TEST_CHECK(gfx_cont_set_bg_color(cont, GFX_COLOR_HEX(0x00FF00)) == ESP_OK);
+    TEST_CHECK(gfx_cont_set_bg_enable(cont, true) == ESP_OK);
+    gfx_obj_set_size(cont, 40, 30);
+    gfx_obj_set_pos(cont, 20, 20);
+
+    /* The image overhangs the container's right and bottom edges */
+    gfx_obj_t *img = gfx_img_create(disp);
+    TEST_CHECK(img != NULL);
+    TEST_CHECK(gfx_img_set_src(img, &img_dsc) == ESP_OK);
+    TEST_CHECK(gfx_obj_set_parent(img, cont) == ESP_OK);
+    gfx_obj_set_pos(img, 24, 20);
+    TEST_CHECK(gfx_obj_get_parent(img) == cont);
+    TEST_CHECK(gfx_obj_set_parent(cont, cont) == ESP_ERR_INVALID_ARG);
+    TEST_CHECK(gfx_obj_set_parent(cont, img) == ESP_ERR_INVALID_ARG);
+
+    gfx_coord_t x;
+    gfx_coord_t y;
+    TEST_CHECK(gfx_obj_get_pos(img, &x, &y) == ESP_OK);
+    TEST_CHECK(x == 24 && y == 20);
+
+    uint32_t frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 20, 20) == 0x07E0);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 44, 40) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 59, 49) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 60, 40) == 0x001F);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 44, 50) == 0x001F);
+
+    /* Moving the container carries the image along */
+    frames = gfx_host_fb_frame_count(&fb);
+    gfx_obj_set_pos(cont, 30, 30);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 20, 20) == 0x001F);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 30, 30) == 0x07E0);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 54, 50) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 69, 59) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 70, 50) == 0x001F);
+    TEST_CHECK(gfx_obj_get_pos(img, &x, &y) == ESP_OK);
+    TEST_CHECK(x == 24 && y == 20);
+
+    /* Hiding the container hides the image */
+    frames = gfx_host_fb_frame_count(&fb);
+    gfx_obj_set_visible(cont, false);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 30, 30) == 0x001F);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 54, 50) == 0x001F);
+
+    /* Detaching keeps the relative coordinates, now on the screen */
+    frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_obj_set_parent(img, NULL) == ESP_OK);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 24, 20) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 24 + TEST_IMG_W - 1, 20 + TEST_IMG_H - 1) == 0xF800);
+
+    /* Deleting the container deletes what it still holds */
+    TEST_CHECK(gfx_obj_set_parent(img, cont) == ESP_OK);
+    gfx_obj_set_visible(cont, true);
+    frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_obj_delete(cont) == ESP_OK);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 24, 20) == 0x001F);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 54, 50) == 0x001F);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+/** Restacking overlapping objects changes which one shows, at the top level and inside a container */
+static int test_zorder(void)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    disp_cfg.flags.double_buffer = 1;
+
+    for (size_t i = 0; i < TEST_IMG_W * TEST_IMG_H; i++) {
+        s_img_pixels[i] = 0xF800;
+    }
+    gfx_image_dsc_t img_dsc = {
+        .header = {
+            .magic = C_ARRAY_HEADER_MAGIC,
+            .cf = GFX_COLOR_FORMAT_RGB565,
+            .w = TEST_IMG_W,
+            .h = TEST_IMG_H,
+            .stride = TEST_IMG_W * 2,
+        },
+        .data_size = sizeof(s_img_pixels),
+        .data = (const uint8_t *)s_img_pixels,
+    };
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    gfx_disp_set_bg_color(disp, GFX_COLOR_HEX(0x0000FF));
+
+    gfx_obj_t *img = gfx_img_create(disp);
+    TEST_CHECK(img != NULL);
+    TEST_CHECK(gfx_img_set_src(img, &img_dsc) == ESP_OK);
+    gfx_obj_set_pos(img, 8, 8);
+
+    gfx_obj_t *cont = gfx_cont_create(disp);
+    TEST_CHECK(cont != NULL);
+    TEST_CHECK(gfx_cont_set_bg_color(cont, GFX_COLOR_HEX(0x00FF00)) == ESP_OK);
+    TEST_CHECK(gfx_cont_set_bg_enable(cont, true) == ESP_OK);
+    gfx_obj_set_size(cont, 16, 16);
+    gfx_obj_set_pos(cont, 4, 4);
+    TEST_CHECK(gfx_obj_get_index(img) == 0 && gfx_obj_get_index(cont) == 1);
+
+    uint32_t frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 10, 10) == 0x07E0);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 24, 24) == 0xF800);
+
+    frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_obj_move_to_front(img) == ESP_OK);
+    TEST_CHECK(gfx_obj_get_index(img) == 1 && gfx_obj_get_index(cont) == 0);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 10, 10) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 5, 5) == 0x07E0);
+
+    /* Inside the container the index counts its children only */
+    gfx_obj_t *inner_bg = gfx_cont_create(disp);
+    TEST_CHECK(inner_bg != NULL);
+    TEST_CHECK(gfx_cont_set_bg_color(inner_bg, GFX_COLOR_HEX(0xFFFF00)) == ESP_OK);
+    TEST_CHECK(gfx_cont_set_bg_enable(inner_bg, true) == ESP_OK);
+    TEST_CHECK(gfx_obj_set_parent(inner_bg, cont) == ESP_OK);
+    gfx_obj_set_size(inner_bg, 4, 4);
+    gfx_obj_set_pos(inner_bg, 0, 0);
+    TEST_CHECK(gfx_obj_set_parent(img, cont) == ESP_OK);
+    gfx_obj_set_pos(img, 0, 0);
+    TEST_CHECK(gfx_obj_get_index(inner_bg) == 0 && gfx_obj_get_index(img) == 1);
+    TEST_CHECK(gfx_obj_get_index(cont) == 0);
+
+    frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_obj_move_to_back(img) == ESP_OK);
+    TEST_CHECK(gfx_obj_get_index(img) == 0 && gfx_obj_get_index(inner_bg) == 1);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 5, 5) == 0xFFE0);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 10, 10) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 24, 24) == 0x001F);
+
+    frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_obj_set_index(img, 1) == ESP_OK);
+    TEST_CHECK(gfx_obj_get_index(img) == 1);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 5, 5) == 0xF800);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+/** A bitmap cache rebuilt in the same frame as a realign is drawn at the new place */
+static int test_cache_align(void)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    disp_cfg.flags.double_buffer = 1;
+
+    for (size_t i = 0; i < TEST_IMG_W * TEST_IMG_H; i++) {
+        s_img_pixels[i] = 0xF800;
+    }
+    gfx_image_dsc_t img_dsc = {
+        .header = {
+            .magic = C_ARRAY_HEADER_MAGIC,
+            .cf = GFX_COLOR_FORMAT_RGB565,
+            .w = TEST_IMG_W,
+            .h = TEST_IMG_H,
+            .stride = TEST_IMG_W * 2,
+        },
+        .data_size = sizeof(s_img_pixels),
+        .data = (const uint8_t *)s_img_pixels,
+    };
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    gfx_disp_set_bg_color(disp, GFX_COLOR_HEX(0x0000FF));
+
+    gfx_obj_t *img = gfx_img_create(disp);
+    TEST_CHECK(img != NULL);
+    TEST_CHECK(gfx_img_set_src(img, &img_dsc) == ESP_OK);
+    TEST_CHECK(gfx_obj_set_cache_as_bitmap(img, true) == ESP_OK);
+    gfx_obj_align(img, GFX_ALIGN_TOP_LEFT, 4, 4);
+
+    uint32_t frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 4, 4) == 0xF800);
+
+    frames = gfx_host_fb_frame_count(&fb);
+    gfx_obj_align(img, GFX_ALIGN_BOTTOM_RIGHT, -4, -4);
+    TEST_CHECK(gfx_img_set_src(img, &img_dsc) == ESP_OK);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 4, 4) == 0x001F);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, TEST_H_RES - 4 - TEST_IMG_W, TEST_V_RES - 4 - TEST_IMG_H) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, TEST_H_RES - 5, TEST_V_RES - 5) == 0xF800);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, TEST_H_RES - 4, TEST_V_RES - 4) == 0x001F);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+/* Paints w x h RGB565 pixels at x, y of a TEST_H_RES-wide reference frame */
+static void test_ref_paint(uint16_t *frame, int x, int y, int w, int h, const uint16_t *src)
+{
+    for (int r = 0; r < h; r++) {
+        memcpy(&frame[(size_t)(y + r) * TEST_H_RES + (size_t)x], &src[(size_t)r * w], (size_t)w * sizeof(uint16_t));
+    }
+}
+
+static bool test_ref_match(const gfx_host_fb_t *fb, const uint16_t *frame, const char *step)
+{
+    for (uint32_t y = 0; y < TEST_V_RES; y++) {
+        for (uint32_t x = 0; x < TEST_H_RES; x++) {
+            if (gfx_host_fb_get_pixel(fb, x, y) != frame[y * TEST_H_RES + x]) {
+                fprintf(stderr, "%s: pixel %u,%u is %04x, expected %04x\n", step, (unsigned)x, (unsigned)y,
+                        (unsigned)gfx_host_fb_get_pixel(fb, x, y), (unsigned)frame[y * TEST_H_RES + x]);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Copy-on-move on a full_frame panel: a lone opaque image is shifted in the
+ * frame buffer and only the strip it uncovers is rendered; with another
+ * object above its path the blit is refused and both rects are redrawn.
+ * Every step must match a software composite and a forced full redraw.
+ */
+static int test_copy_on_move(void)
+{
+    static uint16_t grad[TEST_IMG_W * TEST_IMG_H];
+    static uint16_t green[TEST_COVER_W * TEST_COVER_H];
+    static uint16_t bg[TEST_H_RES * TEST_V_RES];
+    static uint16_t expected[TEST_H_RES * TEST_V_RES];
+    gfx_disp_perf_stats_t stats;
+
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    disp_cfg.flags.double_buffer = 1;
+    disp_cfg.flags.full_frame = true;
+    disp_cfg.buffers.buf_pixels = TEST_H_RES * TEST_V_RES;
+    fb.full_frame = true;
+
+    /* A gradient, so a blit from the wrong place cannot pass for the right one */
+    for (size_t y = 0; y < TEST_IMG_H; y++) {
+        for (size_t x = 0; x < TEST_IMG_W; x++) {
+            grad[y * TEST_IMG_W + x] = (uint16_t)((x << 11) | (y << 5) | 0x0010);
+        }
+    }
+    for (size_t i = 0; i < TEST_COVER_W * TEST_COVER_H; i++) {
+        green[i] = 0x07E0;
+    }
+    for (size_t i = 0; i < TEST_H_RES * TEST_V_RES; i++) {
+        bg[i] = 0x001F;
+    }
+    gfx_image_dsc_t grad_dsc = {
+        .header = {
+            .magic = C_ARRAY_HEADER_MAGIC,
+            .cf = GFX_COLOR_FORMAT_RGB565,
+            .w = TEST_IMG_W,
+            .h = TEST_IMG_H,
+            .stride = TEST_IMG_W * 2,
+        },
+        .data_size = sizeof(grad),
+        .data = (const uint8_t *)grad,
+    };
+    gfx_image_dsc_t green_dsc = {
+        .header = {
+            .magic = C_ARRAY_HEADER_MAGIC,
+            .cf = GFX_COLOR_FORMAT_RGB565,
+            .w = TEST_COVER_W,
+            .h = TEST_COVER_H,
+            .stride = TEST_COVER_W * 2,
+        },
+        .data_size = sizeof(green),
+        .data = (const uint8_t *)green,
+    };
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    gfx_disp_set_bg_color(disp, GFX_COLOR_HEX(0x0000FF));
+    gfx_obj_t *img = gfx_img_create(disp);
+    TEST_CHECK(img != NULL);
+    TEST_CHECK(gfx_img_set_src(img, &grad_dsc) == ESP_OK);
+    gfx_obj_set_pos(img, 8, 8);
+    /* Created second, so it is drawn above the gradient */
+    gfx_obj_t *cover = gfx_img_create(disp);
+    TEST_CHECK(cover != NULL);
+    TEST_CHECK(gfx_img_set_src(cover, &green_dsc) == ESP_OK);
+    gfx_obj_set_pos(cover, 96, 64);
+    uint32_t frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    /* Lone move: blitted, only the uncovered L-shaped strip is rendered */
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_obj_set_pos(img, 12, 10);
+    frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_disp_get_perf_stats(disp, &stats) == ESP_OK);
+    uint32_t blit_dirty = stats.dirty_pixels;
+#if GFX_DISP_COPY_ON_MOVE
+    TEST_CHECK(blit_dirty > 0 && blit_dirty < TEST_IMG_W * TEST_IMG_H);
+#endif
+    memcpy(expected, bg, sizeof(expected));
+    test_ref_paint(expected, 12, 10, TEST_IMG_W, TEST_IMG_H, grad);
+    test_ref_paint(expected, 96, 64, TEST_COVER_W, TEST_COVER_H, green);
+    TEST_CHECK(test_ref_match(&fb, expected, "copy_on_move blit"));
+    /* The strip left behind shows the background again */
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 8, 8) == 0x001F);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 11, 31) == 0x001F);
+    TEST_CHECK(gfx_host_fb_get_pixel(&fb, 39, 9) == 0x001F);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    /* An object above the path: no blit, old and new rects are both rendered */
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_obj_set_pos(cover, 36, 28);
+    frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_obj_set_pos(img, 14, 12);
+    frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_disp_get_perf_stats(disp, &stats) == ESP_OK);
+    TEST_CHECK(stats.dirty_pixels >= (TEST_IMG_W + 2) * (TEST_IMG_H + 2));
+    memcpy(expected, bg, sizeof(expected));
+    test_ref_paint(expected, 14, 12, TEST_IMG_W, TEST_IMG_H, grad);
+    test_ref_paint(expected, 36, 28, TEST_COVER_W, TEST_COVER_H, green);
+    TEST_CHECK(test_ref_match(&fb, expected, "copy_on_move refused"));
+    uint32_t moved_sum = gfx_host_fb_checksum(&fb);
+
+    /* Whatever was blitted, a full redraw of the same scene is identical */
+    gfx_disp_refresh_all(disp);
+    frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_disp_get_perf_stats(disp, &stats) == ESP_OK);
+    TEST_CHECK(stats.dirty_pixels == TEST_H_RES * TEST_V_RES);
+    TEST_CHECK(gfx_host_fb_checksum(&fb) == moved_sum);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    printf("copy_on_move: %u dirty px after the blit, checksum %08x\n", (unsigned)blit_dirty, (unsigned)moved_sum);
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+/* Records every flushed rectangle of the current frame in front of the usual RAM panel */
+typedef struct {
+    gfx_host_fb_t fb;           /* First: gfx_host_fb_flush_cb() reads the user data as a gfx_host_fb_t */
+    gfx_area_t rects[TEST_DIRTY_MAX_FLUSHES];
+    uint32_t rect_count;
+} test_flush_log_t;
+
+static void test_flush_log_cb(gfx_disp_t *disp, int x1, int y1, int x2, int y2, const void *data)
+{
+    test_flush_log_t *log = (test_flush_log_t *)gfx_disp_get_user_data(disp);
+
+    if (log->rect_count < TEST_DIRTY_MAX_FLUSHES) {
+        log->rects[log->rect_count] = (gfx_area_t) {
+            x1, y1, x2, y2
+        };
+    }
+    log->rect_count++;
+    gfx_host_fb_flush_cb(disp, x1, y1, x2, y2, data);
+}
+
+static gfx_coord_t test_clamp(int v, int max)
+{
+    return (gfx_coord_t)(v < 0 ? 0 : (v > max ? max : v));
+}
+
+/**
+ * Many small moves per frame: with dirty tiles every frame's flushes must
+ * be disjoint (a band drawn twice is a wasted transfer), and whichever way
+ * the dirty areas are tracked the panel ends up matching a software
+ * composite of the final scene.
+ */
+static int test_dirty_rects(void)
+{
+    static const uint16_t colors[4] = {0xF800, 0x07E0, 0xFFE0, 0xF81F};
+    static uint16_t pixels[4][TEST_DIRTY_OBJ_W * TEST_DIRTY_OBJ_H];
+    static uint16_t expected[TEST_H_RES * TEST_V_RES];
+    gfx_image_dsc_t dscs[4];
+    gfx_obj_t *objs[TEST_DIRTY_OBJS];
+    gfx_coord_t pos[TEST_DIRTY_OBJS][2];
+    uint32_t rng = 0x1234567U;
+
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    static test_flush_log_t log;
+    gfx_disp_config_t disp_cfg;
+    memset(&log, 0, sizeof(log));
+    TEST_CHECK(gfx_host_fb_init(&log.fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    disp_cfg.flush_cb = test_flush_log_cb;
+    disp_cfg.user_data = &log;
+    disp_cfg.flags.double_buffer = 1;
+
+    for (int c = 0; c < 4; c++) {
+        for (size_t i = 0; i < TEST_DIRTY_OBJ_W * TEST_DIRTY_OBJ_H; i++) {
+            pixels[c][i] = colors[c];
+        }
+        dscs[c] = (gfx_image_dsc_t) {
+            .header = {
+                .magic = C_ARRAY_HEADER_MAGIC,
+                .cf = GFX_COLOR_FORMAT_RGB565,
+                .w = TEST_DIRTY_OBJ_W,
+                .h = TEST_DIRTY_OBJ_H,
+                .stride = TEST_DIRTY_OBJ_W * 2,
+            },
+            .data_size = sizeof(pixels[c]),
+            .data = (const uint8_t *)pixels[c],
+        };
+    }
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    gfx_disp_set_bg_color(disp, GFX_COLOR_HEX(0x0000FF));
+    for (int i = 0; i < TEST_DIRTY_OBJS; i++) {
+        objs[i] = gfx_img_create(disp);
+        TEST_CHECK(objs[i] != NULL);
+        TEST_CHECK(gfx_img_set_src(objs[i], &dscs[i % 4]) == ESP_OK);
+        pos[i][0] = (gfx_coord_t)(8 + (i % 4) * 28);
+        pos[i][1] = (gfx_coord_t)(8 + (i / 4) * 28);
+        gfx_obj_set_pos(objs[i], pos[i][0], pos[i][1]);
+    }
+    uint32_t frames = gfx_host_fb_frame_count(&log.fb);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&log.fb, frames + 1, TEST_TIMEOUT_MS));
+
+    uint32_t flushes = 0;
+    for (int f = 0; f < TEST_DIRTY_FRAMES; f++) {
+        TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+        for (int i = 0; i < TEST_DIRTY_OBJS; i++) {
+            rng = rng * 1103515245U + 12345U;
+            pos[i][0] = test_clamp(pos[i][0] + (int)((rng >> 16) % 7) - 3, TEST_H_RES - TEST_DIRTY_OBJ_W);
+            pos[i][1] = test_clamp(pos[i][1] + (int)((rng >> 24) % 7) - 3, TEST_V_RES - TEST_DIRTY_OBJ_H);
+            gfx_obj_set_pos(objs[i], pos[i][0], pos[i][1]);
+        }
+        log.rect_count = 0;
+        frames = gfx_host_fb_frame_count(&log.fb);
+        TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+        TEST_CHECK(gfx_host_fb_wait_frames(&log.fb, frames + 1, TEST_TIMEOUT_MS));
+
+        TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+        TEST_CHECK(log.rect_count > 0 && log.rect_count <= TEST_DIRTY_MAX_FLUSHES);
+        flushes += log.rect_count;
+#ifdef CONFIG_GFX_DISP_DIRTY_TILES
+        for (uint32_t a = 0; a < log.rect_count; a++) {
+            for (uint32_t b = a + 1; b < log.rect_count; b++) {
+                gfx_area_t inter;
+                if (gfx_area_intersect_exclusive(&inter, &log.rects[a], &log.rects[b])) {
+                    fprintf(stderr, "frame %d: flush %u (%d,%d)-(%d,%d) overlaps flush %u (%d,%d)-(%d,%d)\n", f,
+                            (unsigned)a, log.rects[a].x1, log.rects[a].y1, log.rects[a].x2, log.rects[a].y2,
+                            (unsigned)b, log.rects[b].x1, log.rects[b].y1, log.rects[b].x2, log.rects[b].y2);
+                    return 1;
+                }
+            }
+        }
+#endif
+        TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    }
+
+    /* Software composite: background, then the images in creation (z) order */
+    for (size_t i = 0; i < TEST_H_RES * TEST_V_RES; i++) {
+        expected[i] = 0x001F;
+    }
+    for (int i = 0; i < TEST_DIRTY_OBJS; i++) {
+        for (int y = 0; y < TEST_DIRTY_OBJ_H; y++) {
+            for (int x = 0; x < TEST_DIRTY_OBJ_W; x++) {
+                expected[(size_t)(pos[i][1] + y) * TEST_H_RES + (size_t)(pos[i][0] + x)] = colors[i % 4];
+            }
+        }
+    }
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    for (uint32_t y = 0; y < TEST_V_RES; y++) {
+        for (uint32_t x = 0; x < TEST_H_RES; x++) {
+            if (gfx_host_fb_get_pixel(&log.fb, x, y) != expected[y * TEST_H_RES + x]) {
+                fprintf(stderr, "dirty_rects: pixel %u,%u is %04x, expected %04x\n", (unsigned)x, (unsigned)y,
+                        (unsigned)gfx_host_fb_get_pixel(&log.fb, x, y), (unsigned)expected[y * TEST_H_RES + x]);
+                return 1;
+            }
+        }
+    }
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    printf("dirty_rects: %u flushes over %d frames, checksum %08x\n", (unsigned)flushes, TEST_DIRTY_FRAMES,
+           (unsigned)gfx_host_fb_checksum(&log.fb));
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&log.fb);
+    return 0;
+}
+
+/* Emulated panel: flush_cb hands the chunk to a "DMA" thread that completes it TEST_SLOW_FLUSH_US later */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    gfx_disp_t *disp;
+    uint32_t pending;
+    uint32_t frames;
+    bool exit;
+} test_slow_panel_t;
+
+static void *test_slow_panel_dma(void *arg)
+{
+    test_slow_panel_t *panel = (test_slow_panel_t *)arg;
+
+    pthread_mutex_lock(&panel->lock);
+    for (;;) {
+        while (panel->pending == 0 && !panel->exit) {
+            pthread_cond_wait(&panel->cond, &panel->lock);
+        }
+        if (panel->pending == 0) {
+            break;
+        }
+        panel->pending--;
+        pthread_mutex_unlock(&panel->lock);
+        usleep(TEST_SLOW_FLUSH_US);
+        gfx_disp_flush_ready(panel->disp, true);
+        pthread_mutex_lock(&panel->lock);
+    }
+    pthread_mutex_unlock(&panel->lock);
+    return NULL;
+}
+
+static void test_slow_panel_flush_cb(gfx_disp_t *disp, int x1, int y1, int x2, int y2, const void *data)
+{
+    test_slow_panel_t *panel = (test_slow_panel_t *)gfx_disp_get_user_data(disp);
+
+    (void)x1;
+    (void)y1;
+    (void)x2;
+    (void)y2;
+    (void)data;
+    pthread_mutex_lock(&panel->lock);
+    panel->disp = disp;
+    panel->pending++;
+    if (gfx_disp_is_flushing_last(disp)) {
+        __atomic_fetch_add(&panel->frames, 1, __ATOMIC_RELEASE);
+    }
+    pthread_cond_signal(&panel->cond);
+    pthread_mutex_unlock(&panel->lock);
+}
+
+/** Full-screen widget whose draw busy-waits, standing in for an expensive scene */
+static esp_err_t test_slow_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
+{
+    int64_t until_us = esp_timer_get_time() + TEST_SLOW_DRAW_US;
+
+    (void)obj;
+    (void)ctx;
+    while (esp_timer_get_time() < until_us) {
+    }
+    return ESP_OK;
+}
+
+static esp_err_t test_slow_delete(gfx_obj_t *obj)
+{
+    obj->src = NULL;
+    return ESP_OK;
+}
+
+static const gfx_widget_class_t s_test_slow_class = {
+    .type = TEST_SLOW_OBJ_TYPE,
+    .name = "test_slow",
+    .draw = test_slow_draw,
+    .delete = test_slow_delete,
+};
+
+/**
+ * Pipelined flush on a double-buffered partial display: every transfer but
+ * the last one runs while the next chunk is drawn, so flush time is the
+ * transfer delay per chunk and nearly all of it overlaps rendering.
+ */
+static int test_flush_overlap(void)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    static uint8_t slow_src;
+    test_slow_panel_t panel = {
+        .lock = PTHREAD_MUTEX_INITIALIZER,
+        .cond = PTHREAD_COND_INITIALIZER,
+    };
+    pthread_t dma;
+    TEST_CHECK(pthread_create(&dma, NULL, test_slow_panel_dma, &panel) == 0);
+
+    gfx_disp_config_t disp_cfg = {
+        .h_res = TEST_H_RES,
+        .v_res = TEST_V_RES,
+        .flush_cb = test_slow_panel_flush_cb,
+        .user_data = &panel,
+        .flags.double_buffer = 1,
+        .buffers.buf_pixels = TEST_H_RES * 16,
+    };
+    gfx_obj_t *slow = NULL;
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    TEST_CHECK(gfx_obj_create_class_instance(disp, &s_test_slow_class, &slow_src, TEST_H_RES, TEST_V_RES,
+                                             "test_flush_overlap", &slow) == ESP_OK);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    for (int ms = 0; ms < TEST_TIMEOUT_MS && __atomic_load_n(&panel.frames, __ATOMIC_ACQUIRE) < 1; ms++) {
+        usleep(1000);
+    }
+    TEST_CHECK(panel.frames >= 1);
+
+    gfx_disp_perf_stats_t stats;
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_disp_get_perf_stats(disp, &stats) == ESP_OK);
+    TEST_CHECK(gfx_obj_delete(slow) == ESP_OK);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    printf("flush_overlap: %u flushes, flush %u us, wait %u us, overlap %u us (%u%%)\n",
+           (unsigned)stats.flush_count, (unsigned)stats.flush_time_us, (unsigned)stats.flush_wait_us,
+           (unsigned)stats.overlap_time_us, (unsigned)stats.overlap_pct);
+
+    /* Transfer time only: drawing the next chunk (4x longer) must not leak into it */
+    TEST_CHECK(stats.flush_count >= 2);
+    TEST_CHECK(stats.flush_time_us >= (uint64_t)stats.flush_count * TEST_SLOW_FLUSH_US);
+    TEST_CHECK(stats.flush_time_us <= (uint64_t)stats.flush_count * (TEST_SLOW_FLUSH_US + TEST_SLOW_SLACK_US));
+    /* All transfers but the last hide behind the next chunk's draw */
+    TEST_CHECK(stats.flush_time_us - stats.overlap_time_us <= TEST_SLOW_FLUSH_US + 2 * TEST_SLOW_SLACK_US);
+    TEST_CHECK(stats.overlap_pct + 15U >= (stats.flush_count - 1U) * 100U / stats.flush_count);
+    TEST_CHECK(stats.flush_wait_us < stats.flush_time_us);
+
+    gfx_emote_deinit(handle);
+    pthread_mutex_lock(&panel.lock);
+    panel.exit = true;
+    pthread_cond_signal(&panel.cond);
+    pthread_mutex_unlock(&panel.lock);
+    pthread_join(dma, NULL);
+    return 0;
+}
+
+static void test_timer_count_cb(void *user_data)
+{
+    (*(uint32_t *)user_data)++;
+}
+
+static int test_virtual_clock(void)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    uint32_t fired = 0;
+    TEST_CHECK(gfx_timer_step(handle, 10) == ESP_ERR_INVALID_STATE);
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_timer_set_virtual_clock(handle, true) == ESP_OK);
+    gfx_timer_handle_t timer = gfx_timer_create(handle, test_timer_count_cb, 10, &fired);
+    TEST_CHECK(timer != NULL);
+    uint32_t start = gfx_timer_clock_get(handle);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    /* The render task keeps running but sees no time pass */
+    usleep(30 * 1000);
+    TEST_CHECK(fired == 0);
+
+    /* One step across several periods fires once per period */
+    TEST_CHECK(gfx_timer_step(handle, 35) == ESP_OK);
+    TEST_CHECK(fired == 3);
+    TEST_CHECK(gfx_timer_step(handle, 5) == ESP_OK);
+    TEST_CHECK(fired == 4);
+    TEST_CHECK(gfx_timer_clock_get(handle) == start + 40);
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_timer_delete(handle, timer);
+    TEST_CHECK(gfx_timer_set_virtual_clock(handle, false) == ESP_OK);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    gfx_emote_deinit(handle);
+    return 0;
+}
+
+static int test_idle_wake(void)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, 1, TEST_TIMEOUT_MS));
+    usleep(20 * 1000);
+
+    /* No timer and nothing dirty: the render task does not wake at all */
+    gfx_wake_stats_t stats;
+    TEST_CHECK(gfx_emote_reset_wake_stats(handle) == ESP_OK);
+    usleep(100 * 1000);
+    TEST_CHECK(gfx_emote_get_wake_stats(handle, &stats) == ESP_OK);
+    TEST_CHECK(stats.wakeups == 0);
+
+    /* An invalidation wakes it at once and its wake latency is recorded */
+    uint32_t frames = gfx_host_fb_frame_count(&fb);
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_refresh_all(disp);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, frames + 1, TEST_TIMEOUT_MS));
+    TEST_CHECK(gfx_emote_get_wake_stats(handle, &stats) == ESP_OK);
+    TEST_CHECK(stats.wakeups >= 1 && stats.render_wakeups >= 1 && stats.idle_blocks >= 1);
+    TEST_CHECK(stats.latency_us.count >= 1 && stats.latency_us.max < TEST_TIMEOUT_MS * 1000U);
+
+    /* A timer created while idle gets the task running again */
+    uint32_t fired = 0;
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_timer_handle_t timer = gfx_timer_create(handle, test_timer_count_cb, 10, &fired);
+    TEST_CHECK(timer != NULL);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    for (int ms = 0; ms < TEST_TIMEOUT_MS && __atomic_load_n(&fired, __ATOMIC_RELAXED) < 3; ms++) {
+        usleep(1000);
+    }
+    TEST_CHECK(fired >= 3);
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_timer_delete(handle, timer);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    printf("idle_wake: %u wakeups, %u rendered, %u idle blocks, latency p50 %u us\n", (unsigned)stats.wakeups,
+           (unsigned)stats.render_wakeups, (unsigned)stats.idle_blocks, (unsigned)stats.latency_us.p50);
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+typedef struct {
+    gfx_timer_handle_t timer;
+    uint32_t fired;
+    uint32_t periods;
+} test_sched_timer_t;
+
+static uint32_t test_manual_clock(void *user_data)
+{
+    return __atomic_load_n((uint32_t *)user_data, __ATOMIC_RELAXED);
+}
+
+static void test_sched_timer_cb(void *user_data)
+{
+    test_sched_timer_t *t = (test_sched_timer_t *)user_data;
+
+    t->periods = gfx_timer_get_elapsed_periods(t->timer);
+    __atomic_add_fetch(&t->fired, 1, __ATOMIC_RELAXED);
+}
+
+static int test_frame_sched(void)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 50,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    uint32_t clock_ms = 1000;
+    test_sched_timer_t t = {0};
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_timer_set_clock(handle, test_manual_clock, &clock_ms) == ESP_OK);
+    TEST_CHECK(gfx_disp_add(handle, &disp_cfg) != NULL);
+    t.timer = gfx_timer_create(handle, test_sched_timer_cb, 10, &t);
+    TEST_CHECK(t.timer != NULL);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(gfx_host_fb_wait_frames(&fb, 1, TEST_TIMEOUT_MS));
+
+    gfx_timer_sched_stats_t stats;
+    TEST_CHECK(gfx_timer_get_sched_stats(handle, &stats) == ESP_OK);
+    TEST_CHECK(stats.period_us == 20000 && stats.frames >= 1);
+
+    /* Held back 35 ms, a 10 ms timer fires once and reports three periods */
+    TEST_CHECK(t.fired == 0);
+    __atomic_store_n(&clock_ms, 1035, __ATOMIC_RELAXED);
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_timer_set_period(t.timer, 10);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    for (int ms = 0; ms < TEST_TIMEOUT_MS && __atomic_load_n(&t.fired, __ATOMIC_RELAXED) == 0; ms++) {
+        usleep(1000);
+    }
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(t.fired == 1 && t.periods == 3);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    /* With a vsync period the frame period snaps to the nearest multiple of it */
+    TEST_CHECK(gfx_timer_set_vsync(handle, 16667) == ESP_OK);
+    TEST_CHECK(gfx_timer_get_sched_stats(handle, &stats) == ESP_OK);
+    TEST_CHECK(stats.period_us == 16667);
+    TEST_CHECK(gfx_timer_set_vsync(handle, 8000) == ESP_OK);
+    TEST_CHECK(gfx_timer_get_sched_stats(handle, &stats) == ESP_OK);
+    TEST_CHECK(stats.period_us == 24000);
+    TEST_CHECK(gfx_timer_set_vsync(handle, 0) == ESP_OK);
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_timer_delete(handle, t.timer);
+    TEST_CHECK(gfx_timer_set_clock(handle, NULL, NULL) == ESP_OK);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+static void test_cmd_done_cb(void *user_data)
+{
+    __atomic_store_n((bool *)user_data, true, __ATOMIC_RELEASE);
+}
+
+/** Queue a marker behind everything posted so far and wait for the render task to run it */
+static bool test_cmd_sync(gfx_handle_t handle)
+{
+    bool done = false;
+
+    if (gfx_cmd_call(handle, test_cmd_done_cb, &done) != ESP_OK) {
+        return false;
+    }
+    for (int ms = 0; ms < TEST_TIMEOUT_MS; ms++) {
+        if (__atomic_load_n(&done, __ATOMIC_ACQUIRE)) {
+            return true;
+        }
+        usleep(1000);
+    }
+    return false;
+}
+
+static void *test_cmd_producer(void *arg)
+{
+    gfx_obj_t *obj = (gfx_obj_t *)arg;
+
+    for (int i = 0; i < TEST_CMD_PER_PRODUCER; i++) {
+        while (gfx_cmd_set_pos(obj, i, i) == ESP_ERR_NO_MEM) {
+            usleep(100);
+        }
+    }
+    return NULL;
+}
+
+static int test_cmd_queue(void)
+{
+    gfx_core_config_t gfx_cfg = {
+        .fps = 60,
+        .task = GFX_EMOTE_INIT_CONFIG(),
+    };
+    gfx_handle_t handle = gfx_emote_init(&gfx_cfg);
+    TEST_CHECK(handle != NULL);
+
+    gfx_host_fb_t fb;
+    gfx_disp_config_t disp_cfg;
+    TEST_CHECK(gfx_host_fb_init(&fb, TEST_H_RES, TEST_V_RES, &disp_cfg) == ESP_OK);
+
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    gfx_disp_t *disp = gfx_disp_add(handle, &disp_cfg);
+    TEST_CHECK(disp != NULL);
+    gfx_obj_t *img = gfx_img_create(disp);
+    gfx_obj_t *label = gfx_label_create(disp);
+    TEST_CHECK(img != NULL && label != NULL);
+
+    /* With the render task held off the ring fills up; repeated moves collapse into the last one */
+    for (int i = 0; i < TEST_CMD_RING_LEN - 1; i++) {
+        TEST_CHECK(gfx_cmd_set_pos(img, i, i) == ESP_OK);
+    }
+    bool done = false;
+    TEST_CHECK(gfx_cmd_call(handle, test_cmd_done_cb, &done) == ESP_OK);
+    TEST_CHECK(gfx_cmd_set_pos(img, 0, 0) == ESP_ERR_NO_MEM);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    for (int ms = 0; ms < TEST_TIMEOUT_MS && !__atomic_load_n(&done, __ATOMIC_ACQUIRE); ms++) {
+        usleep(1000);
+    }
+    TEST_CHECK(done);
+
+    gfx_coord_t x;
+    gfx_coord_t y;
+    gfx_cmd_stats_t stats;
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_obj_get_pos(img, &x, &y) == ESP_OK);
+    TEST_CHECK(x == TEST_CMD_RING_LEN - 2 && y == TEST_CMD_RING_LEN - 2);
+    TEST_CHECK(gfx_cmd_get_stats(handle, &stats) == ESP_OK);
+    TEST_CHECK(stats.posted == TEST_CMD_RING_LEN && stats.dropped == 1);
+    TEST_CHECK(stats.applied == 2 && stats.coalesced == TEST_CMD_RING_LEN - 2);
+
+    /* Deleting an object drops its pending commands */
+    TEST_CHECK(gfx_cmd_set_text(label, "pending") == ESP_OK);
+    TEST_CHECK(gfx_obj_delete(label) == ESP_OK);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+    TEST_CHECK(test_cmd_sync(handle));
+    gfx_cmd_stats_t after;
+    TEST_CHECK(gfx_cmd_get_stats(handle, &after) == ESP_OK);
+    TEST_CHECK(after.applied == stats.applied + 1 && after.coalesced == stats.coalesced);
+
+    /* Concurrent producers: every accepted command is either applied or coalesced */
+    pthread_t producers[TEST_CMD_PRODUCERS];
+    for (int i = 0; i < TEST_CMD_PRODUCERS; i++) {
+        TEST_CHECK(pthread_create(&producers[i], NULL, test_cmd_producer, img) == 0);
+    }
+    for (int i = 0; i < TEST_CMD_PRODUCERS; i++) {
+        pthread_join(producers[i], NULL);
+    }
+    TEST_CHECK(test_cmd_sync(handle));
+    stats = after;
+    TEST_CHECK(gfx_cmd_get_stats(handle, &after) == ESP_OK);
+    TEST_CHECK(after.posted - stats.posted == TEST_CMD_PRODUCERS * TEST_CMD_PER_PRODUCER + 1);
+    TEST_CHECK((after.applied + after.coalesced) - (stats.applied + stats.coalesced) ==
+               TEST_CMD_PRODUCERS * TEST_CMD_PER_PRODUCER + 1);
+    TEST_CHECK(gfx_emote_lock(handle) == ESP_OK);
+    TEST_CHECK(gfx_obj_get_pos(img, &x, &y) == ESP_OK);
+    TEST_CHECK(x == TEST_CMD_PER_PRODUCER - 1 && y == TEST_CMD_PER_PRODUCER - 1);
+    TEST_CHECK(gfx_emote_unlock(handle) == ESP_OK);
+
+    printf("cmd_queue: %u posted, %u applied, %u coalesced, %u dropped\n", (unsigned)after.posted,
+           (unsigned)after.applied, (unsigned)after.coalesced, (unsigned)after.dropped);
+
+    gfx_emote_deinit(handle);
+    gfx_host_fb_deinit(&fb);
+    return 0;
+}
+
+int main(void)
+{
+    int fails = 0;
+
+    gfx_log_set_level_all(GFX_LOG_LEVEL_WARN);
+    fails += test_render(false);
+    fails += test_render(true);
+    fails += test_virtual_clock();
+    fails += test_cmd_queue();
+    fails += test_idle_wake();
+    fails += test_frame_sched();
+    fails += test_container();
+    fails += test_zorder();
+    fails += test_cache_align();
+    fails += test_copy_on_move();
+    fails += test_dirty_rects();
+    fails += test_flush_overlap();
+
+    printf("%s\n", fails ? "FAILED" : "OK");
+    return fails ? EXIT_FAILURE : EXIT_SUCCESS;
+}
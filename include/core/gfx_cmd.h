@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "core/gfx_core.h"
+#include "core/gfx_obj.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Command queue: post widget updates from any task without taking the render
+ * lock (gfx_emote_lock). Commands go into a bounded lock-free ring and are
+ * applied by the render task at the top of its next frame, in posting order.
+ * Repeated commands of the same kind on the same object are coalesced so only
+ * the last one is applied. Not callable from ISRs.
+ *
+ * The target object must stay alive until the command is applied;
+ * gfx_obj_delete() drops commands still pending for the object it deletes.
+ */
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Function run on the render task by gfx_cmd_call(), with the render lock held */
+typedef void (*gfx_cmd_cb_t)(void *user_data);
+
+/** Counters since gfx_emote_init() */
+typedef struct {
+    uint32_t posted;            /**< Commands accepted into the ring */
+    uint32_t dropped;           /**< Commands rejected because the ring was full */
+    uint32_t applied;           /**< Commands run on the render task */
+    uint32_t coalesced;         /**< Commands skipped because a later one superseded them */
+} gfx_cmd_stats_t;
+
+/**********************
+ *   PUBLIC API
+ **********************/
+
+/**
+ * @brief Queue gfx_obj_set_pos()
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if obj is not on a display, ESP_ERR_NO_MEM if the ring is full
+ */
+esp_err_t gfx_cmd_set_pos(gfx_obj_t *obj, gfx_coord_t x, gfx_coord_t y);
+
+/**
+ * @brief Queue gfx_obj_set_size()
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if obj is not on a display, ESP_ERR_NO_MEM if the ring is full
+ */
+esp_err_t gfx_cmd_set_size(gfx_obj_t *obj, uint16_t w, uint16_t h);
+
+/**
+ * @brief Queue gfx_obj_set_visible()
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if obj is not on a display, ESP_ERR_NO_MEM if the ring is full
+ */
+esp_err_t gfx_cmd_set_visible(gfx_obj_t *obj, bool visible);
+
+/**
+ * @brief Queue gfx_label_set_text()
+ *
+ * The text is copied, so the caller's buffer may be reused at once.
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if obj is not on a display or text is NULL,
+ *         ESP_ERR_NO_MEM if the copy cannot be allocated or the ring is full
+ */
+esp_err_t gfx_cmd_set_text(gfx_obj_t *obj, const char *text);
+
+/**
+ * @brief Queue gfx_anim_start(); coalesces with gfx_cmd_anim_stop() on the same object
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if obj is not on a display, ESP_ERR_NO_MEM if the ring is full
+ */
+esp_err_t gfx_cmd_anim_start(gfx_obj_t *obj);
+
+/**
+ * @brief Queue gfx_anim_stop(); coalesces with gfx_cmd_anim_start() on the same object
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if obj is not on a display, ESP_ERR_NO_MEM if the ring is full
+ */
+esp_err_t gfx_cmd_anim_stop(gfx_obj_t *obj);
+
+/**
+ * @brief Queue an arbitrary function to run on the render task
+ *
+ * Never coalesced; commands before and after it are not merged across it.
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if handle or cb is NULL, ESP_ERR_NO_MEM if the ring is full
+ */
+esp_err_t gfx_cmd_call(gfx_handle_t handle, gfx_cmd_cb_t cb, void *user_data);
+
+/**
+ * @brief Read the queue counters
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if handle or out is NULL
+ */
+esp_err_t gfx_cmd_get_stats(gfx_handle_t handle, gfx_cmd_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
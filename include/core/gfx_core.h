@@ -10,6 +10,7 @@
 #include "esp_err.h"
 #include "esp_heap_caps.h"
 #include "gfx_types.h"
+#include "gfx_disp.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,6 +42,42 @@ typedef struct {
     } task;
 } gfx_core_config_t;
 
+/** How gfx_refr_batch() completes flushes */
+typedef enum {
+    GFX_REFR_BATCH_FLUSH_DISPLAY = 0,           /**< Keep each display's own flush_cb */
+    GFX_REFR_BATCH_FLUSH_NONE,                  /**< Complete every flush at once without touching the pixels */
+    GFX_REFR_BATCH_FLUSH_MEMCPY,                /**< Copy flushed chunks into a RAM frame (memory-bound panel stand-in) */
+} gfx_refr_batch_flush_t;
+
+/** Passed to gfx_refr_batch() */
+typedef struct {
+    uint32_t frames;                            /**< Frames to render back-to-back */
+    uint32_t step_ms;                           /**< gfx_timer_step() before each frame (needs the virtual clock); 0 = timers do not run */
+    bool invalidate_all;                        /**< Redraw every display in full each frame */
+    gfx_refr_batch_flush_t flush;               /**< Flush handling during the batch */
+} gfx_refr_batch_config_t;
+
+/** Aggregate timings of one gfx_refr_batch() call */
+typedef struct {
+    uint32_t frames;                            /**< Frames requested */
+    uint32_t rendered_frames;                   /**< Frames that drew something on at least one display */
+    uint64_t total_us;                          /**< Wall time of the whole batch, timer steps included */
+    uint64_t render_us;                         /**< Drawing time summed over displays */
+    uint64_t flush_us;                          /**< Flush transfer time summed over displays */
+    uint64_t pixels;                            /**< Dirty pixels rendered */
+    uint32_t fps;                               /**< frames per second of wall time */
+} gfx_refr_batch_stats_t;
+
+/** Render task wakeups since init or gfx_emote_reset_wake_stats() */
+typedef struct {
+    uint32_t wakeups;                           /**< Times the render task woke up */
+    uint32_t render_wakeups;                    /**< Wakeups that rendered a frame on at least one display */
+    uint32_t idle_blocks;                       /**< Times it went to sleep with no timeout (no active timer) */
+    gfx_perf_dist_t latency_us;                 /**< Wake request (invalidation, command, timer change, touch IRQ)
+                                                     or timer deadline to the task holding the render lock;
+                                                     empty without CONFIG_GFX_DISP_PERF_HIST */
+} gfx_wake_stats_t;
+
 /**********************
  *   PUBLIC API
  **********************/
@@ -88,6 +125,43 @@ esp_err_t gfx_emote_unlock(gfx_handle_t handle);
  */
 esp_err_t gfx_refr_now(gfx_handle_t handle);
 
+/**
+ * @brief Render frames back-to-back on the calling task and report aggregate timings
+ *
+ * Holds the render mutex for the whole batch, so the render task, its
+ * sleeps and the FPS pacing stay out of the measurement. Use it to find the
+ * frames/s ceiling of a scene; combine with gfx_timer_set_virtual_clock()
+ * and step_ms to let animations progress between frames.
+ *
+ * @param handle Graphics handle
+ * @param cfg Batch configuration
+ * @param out Aggregate timings (may be NULL)
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if the memcpy frame cannot be allocated,
+ *         ESP_ERR_INVALID_STATE if step_ms is set without the virtual clock
+ */
+esp_err_t gfx_refr_batch(gfx_handle_t handle, const gfx_refr_batch_config_t *cfg, gfx_refr_batch_stats_t *out);
+
+/**
+ * @brief Read render task wakeup counters and wake latency percentiles
+ *
+ * With no active timer the render task sleeps until an invalidation, a queued
+ * command, a timer change or a touch interrupt wakes it; idle_blocks counts
+ * those sleeps.
+ *
+ * @param handle Graphics handle
+ * @param out Filled with the counters
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if handle or out is NULL
+ */
+esp_err_t gfx_emote_get_wake_stats(gfx_handle_t handle, gfx_wake_stats_t *out);
+
+/**
+ * @brief Clear the counters read by gfx_emote_get_wake_stats()
+ *
+ * @param handle Graphics handle
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if handle is NULL
+ */
+esp_err_t gfx_emote_reset_wake_stats(gfx_handle_t handle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "esp_err.h"
 #include "gfx_types.h"
@@ -36,21 +37,59 @@ typedef struct {
 typedef struct {
     gfx_perf_counter_t fill;          /**< gfx_sw_blend_fill_area */
     gfx_perf_counter_t color_draw;    /**< gfx_sw_blend_draw */
-    gfx_perf_counter_t image_draw;    /**< gfx_sw_blend_img_draw */
+    gfx_perf_counter_t image_draw;    /**< gfx_sw_blend_img_draw, gfx_sw_blend_img_premul_draw */
     gfx_perf_counter_t triangle_draw; /**< gfx_sw_blend_img_triangle_draw */
-    uint64_t triangle_covered_pixels; /**< Triangle pixels blended (inside + AA) */
-    uint64_t triangle_aa_pixels;      /**< Triangle edge-AA blended pixels */
+    uint64_t triangle_covered_pixels; /**< Triangle pixels left after 8x8 block rejection */
+    uint64_t triangle_aa_pixels;      /**< Of those, pixels in edge blocks tested one by one */
 } gfx_blend_perf_stats_t;
 
 typedef struct {
+    uint32_t frame_count;             /**< Frames rendered on this display; other fields describe the latest one */
     uint32_t dirty_pixels;            /**< Dirty pixels in the latest rendered frame */
     uint64_t frame_time_us;           /**< Total frame time */
     uint64_t render_time_us;          /**< Time spent in render phase */
-    uint64_t flush_time_us;           /**< Time spent in flush callbacks */
+    uint64_t flush_time_us;           /**< Transfer time: flush_cb issue to gfx_disp_flush_ready() */
+    uint64_t flush_wait_us;           /**< Render task time blocked on an unfinished flush */
     uint32_t flush_count;             /**< Number of flush calls */
+    uint64_t overlap_time_us;         /**< Render time overlapped with an in-flight flush */
+    uint8_t overlap_pct;              /**< Share of flush time hidden behind rendering (0-100) */
     gfx_blend_perf_stats_t blend;     /**< Blend-stage details */
 } gfx_disp_perf_stats_t;
 
+/** Distribution of one timing metric over the recent frames (CONFIG_GFX_DISP_PERF_HIST) */
+typedef struct {
+    uint32_t count;                   /**< Samples in the window (older ones weigh less) */
+    uint32_t p50;                     /**< Median, microseconds */
+    uint32_t p90;
+    uint32_t p99;
+    uint32_t max;                     /**< Largest sample since the last reset */
+} gfx_perf_dist_t;
+
+/** Tail latency of the rendered frames of one display */
+typedef struct {
+    gfx_perf_dist_t frame_us;         /**< Whole frame: update, render and flush */
+    gfx_perf_dist_t render_us;        /**< Drawing into the buffer */
+    gfx_perf_dist_t flush_us;         /**< flush_cb transfers, issue to gfx_disp_flush_ready() */
+    gfx_perf_dist_t latency_us;       /**< First invalidation of the frame (e.g. in a timer callback) to its last flush done */
+} gfx_disp_frame_stats_t;
+
+/** Cumulative draw/update cost of one object (CONFIG_GFX_RENDER_OBJ_PERF) */
+typedef struct {
+    uint32_t trace_id;                /**< gfx_obj_get_trace_id() */
+    const char *class_name;           /**< gfx_obj_get_class_name() */
+    const char *tag;                  /**< gfx_obj_get_trace_tag() */
+    gfx_perf_counter_t draw;          /**< Draw calls, covered pixels and time; with stripe workers each stripe counts a call and adds its own time */
+    gfx_perf_counter_t update;        /**< Update calls (incl. bitmap cache builds) and time; pixels stay 0 */
+} gfx_obj_perf_stats_t;
+
+/** Cumulative draw/update cost of all live objects of one widget class */
+typedef struct {
+    const char *class_name;           /**< Widget class name */
+    uint32_t obj_count;               /**< Live objects of this class on the display */
+    gfx_perf_counter_t draw;          /**< Sum of the objects' draw counters */
+    gfx_perf_counter_t update;        /**< Sum of the objects' update counters */
+} gfx_class_perf_stats_t;
+
 typedef void (*gfx_disp_flush_cb_t)(gfx_disp_t *disp, int x1, int y1, int x2, int y2, const void *data);
 typedef void (*gfx_disp_update_cb_t)(gfx_disp_t *disp, gfx_disp_event_t event, const void *obj);
 
@@ -159,6 +198,69 @@ bool gfx_disp_is_flushing_last(gfx_disp_t *disp);
  */
 esp_err_t gfx_disp_get_perf_stats(gfx_disp_t *disp, gfx_disp_perf_stats_t *out_stats);
 
+/**
+ * @brief Get frame time percentiles of a display
+ *
+ * Each metric keeps a log-bucketed histogram (~19% bucket width) of the
+ * rendered frames. Once CONFIG_GFX_DISP_PERF_HIST_WINDOW samples are
+ * collected all buckets are halved, so older frames fade out. Percentiles
+ * report the upper edge of their bucket, capped at max.
+ *
+ * @param disp Display from gfx_disp_add
+ * @param out Output statistics
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED when histograms are disabled
+ */
+esp_err_t gfx_disp_get_frame_stats(gfx_disp_t *disp, gfx_disp_frame_stats_t *out);
+
+/**
+ * @brief Clear the frame time histograms of a display
+ *
+ * @param disp Display from gfx_disp_add
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED when histograms are disabled
+ */
+esp_err_t gfx_disp_reset_frame_stats(gfx_disp_t *disp);
+
+/**
+ * @brief Get the most expensive objects on a display
+ *
+ * Counters accumulate from object creation or the last
+ * gfx_disp_reset_obj_perf_stats(). Entries are sorted by draw + update time,
+ * most expensive first. With CONFIG_GFX_RENDER_STRIPE_WORKERS a chunk drawn
+ * in N stripes counts up to N draw calls per object and the time is summed
+ * over the stripes (CPU time, not wall time); covered pixels are exact.
+ * Requires CONFIG_GFX_RENDER_OBJ_PERF.
+ *
+ * @param disp Display from gfx_disp_add
+ * @param out Output array
+ * @param max Capacity of out
+ * @param out_count Number of entries written
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED when instrumentation is disabled
+ */
+esp_err_t gfx_disp_get_obj_perf_stats(gfx_disp_t *disp, gfx_obj_perf_stats_t *out, size_t max, size_t *out_count);
+
+/**
+ * @brief Get draw/update cost per widget class on a display
+ *
+ * Sums the counters of the live objects of each class; deleted objects drop
+ * out. Entries are sorted like gfx_disp_get_obj_perf_stats().
+ * Requires CONFIG_GFX_RENDER_OBJ_PERF.
+ *
+ * @param disp Display from gfx_disp_add
+ * @param out Output array
+ * @param max Capacity of out
+ * @param out_count Number of entries written
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED when instrumentation is disabled
+ */
+esp_err_t gfx_disp_get_class_perf_stats(gfx_disp_t *disp, gfx_class_perf_stats_t *out, size_t max, size_t *out_count);
+
+/**
+ * @brief Clear the per-object counters of all objects on a display
+ *
+ * @param disp Display from gfx_disp_add
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED when instrumentation is disabled
+ */
+esp_err_t gfx_disp_reset_obj_perf_stats(gfx_disp_t *disp);
+
 /**
  * @brief Set default background color for a display
  *
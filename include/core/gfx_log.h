@@ -48,6 +48,7 @@ typedef enum {
     GFX_LOG_MODULE_MOTION,
     GFX_LOG_MODULE_EAF_DEC,
     GFX_LOG_MODULE_QRCODE_LIB,
+    GFX_LOG_MODULE_CONT,
     GFX_LOG_MODULE_COUNT,
 } gfx_log_module_t;
 
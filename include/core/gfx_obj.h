@@ -32,6 +32,7 @@ extern "C" {
 #define GFX_OBJ_TYPE_LOBSTER_EMOTE 0x0A
 /* 0x0B reserved for removed lobster face emote */
 #define GFX_OBJ_TYPE_STICKMAN_EMOTE 0x0C
+#define GFX_OBJ_TYPE_CONTAINER   0x0D
 
 /* Alignment constants (similar to LVGL) */
 #define GFX_ALIGN_DEFAULT         0x00
@@ -80,8 +81,8 @@ typedef void (*gfx_obj_touch_cb_t)(gfx_obj_t *obj, const gfx_touch_event_t *even
 /**
  * @brief Set the position of an object
  * @param obj Pointer to the object
- * @param x X coordinate
- * @param y Y coordinate
+ * @param x X coordinate (relative to the parent container, if any)
+ * @param y Y coordinate (relative to the parent container, if any)
  */
 esp_err_t gfx_obj_set_pos(gfx_obj_t *obj, gfx_coord_t x, gfx_coord_t y);
 
@@ -94,7 +95,7 @@ esp_err_t gfx_obj_set_pos(gfx_obj_t *obj, gfx_coord_t x, gfx_coord_t y);
 esp_err_t gfx_obj_set_size(gfx_obj_t *obj, uint16_t w, uint16_t h);
 
 /**
- * @brief Align an object relative to the screen or another object
+ * @brief Align an object relative to the screen (or its parent container) or another object
  * @param obj Pointer to the object to align
  * @param align Alignment type (see GFX_ALIGN_* constants)
  * @param x_ofs X offset from the alignment position
@@ -127,6 +128,78 @@ esp_err_t gfx_obj_set_visible(gfx_obj_t *obj, bool visible);
  */
 bool gfx_obj_get_visible(gfx_obj_t *obj);
 
+/**
+ * @brief Cache the rendered object in an offscreen bitmap
+ *
+ * The object is drawn once into a private RGB565 buffer (plus an A8 coverage
+ * mask unless it is opaque) and later frames copy that buffer instead of
+ * calling the widget's draw function. The cache is rebuilt after the object
+ * is invalidated (text, color or size changes); moving the object keeps it.
+ * Costs up to 3 bytes per pixel of object size. Not useful for objects that
+ * change every frame (animations, mesh images).
+ *
+ * @param obj Object to cache
+ * @param enable True to enable caching, false to disable and free the cache
+ * @return ESP_OK on success
+ */
+esp_err_t gfx_obj_set_cache_as_bitmap(gfx_obj_t *obj, bool enable);
+
+/**
+ * @brief Move an object into a container, or back to the display
+ *
+ * The object's position becomes relative to the container, it is clipped to
+ * the container's bounds, and it is hidden, moved and deleted together with
+ * the container. Children stack above the container; the object is placed in
+ * front of its new siblings (see gfx_obj_set_index()).
+ *
+ * @param obj Object to move
+ * @param parent Container from gfx_cont_create() on the same display; NULL for the display
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if parent is not a container on
+ *         obj's display or is obj or one of its descendants
+ */
+esp_err_t gfx_obj_set_parent(gfx_obj_t *obj, gfx_obj_t *parent);
+
+/**
+ * @brief Get the container holding an object
+ * @param obj Object
+ * @return Parent container, NULL for top-level objects
+ */
+gfx_obj_t *gfx_obj_get_parent(gfx_obj_t *obj);
+
+/**
+ * @brief Set an object's stacking position among its siblings
+ *
+ * Siblings are the objects in the same container, or the top-level objects
+ * of the display. Index 0 is drawn first (back-most); an index past the last
+ * sibling moves the object to the front.
+ *
+ * @param obj Object to restack
+ * @param index New position among its siblings
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if obj is NULL
+ */
+esp_err_t gfx_obj_set_index(gfx_obj_t *obj, uint16_t index);
+
+/**
+ * @brief Get an object's stacking position among its siblings
+ * @param obj Object
+ * @return Index (0 = back-most), -1 if obj is NULL or not on a display
+ */
+int32_t gfx_obj_get_index(gfx_obj_t *obj);
+
+/**
+ * @brief Draw an object in front of its siblings
+ * @param obj Object to restack
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if obj is NULL
+ */
+esp_err_t gfx_obj_move_to_front(gfx_obj_t *obj);
+
+/**
+ * @brief Draw an object behind its siblings
+ * @param obj Object to restack
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if obj is NULL
+ */
+esp_err_t gfx_obj_move_to_back(gfx_obj_t *obj);
+
 /**
  * @brief Update object's layout (mark for recalculation before rendering)
  * @param obj Object to update layout
@@ -140,8 +213,8 @@ void gfx_obj_update_layout(gfx_obj_t *obj);
 /**
  * @brief Get the position of an object
  * @param obj Pointer to the object
- * @param x Pointer to store X coordinate
- * @param y Pointer to store Y coordinate
+ * @param x Pointer to store X coordinate (relative to the parent container, if any)
+ * @param y Pointer to store Y coordinate (relative to the parent container, if any)
  */
 esp_err_t gfx_obj_get_pos(gfx_obj_t *obj, gfx_coord_t *x, gfx_coord_t *y);
 
@@ -157,7 +230,7 @@ esp_err_t gfx_obj_get_size(gfx_obj_t *obj, uint16_t *w, uint16_t *h);
 
 /**
  * @brief Delete an object
- * @param obj Pointer to the object to delete
+ * @param obj Pointer to the object to delete; a container deletes its children too
  */
 esp_err_t gfx_obj_delete(gfx_obj_t *obj);
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "esp_err.h"
 #include "gfx_types.h"
 
 #ifdef __cplusplus
@@ -26,6 +27,18 @@ typedef void (*gfx_timer_cb_t)(void *);
 /* Timer handle type for external use */
 typedef void *gfx_timer_handle_t;
 
+/* Clock source: current time in milliseconds (may wrap) */
+typedef uint32_t (*gfx_timer_clock_cb_t)(void *user_data);
+
+/* Frame scheduler counters */
+typedef struct {
+    uint32_t frames;            /**< Frames rendered by the render task */
+    uint32_t dropped;           /**< Frame slots skipped because rendering fell behind */
+    uint32_t overruns;          /**< Frames whose render time exceeded the frame period */
+    uint32_t budget_us;         /**< Smoothed render time; frames start this early before a vsync edge */
+    uint32_t period_us;         /**< Current frame period */
+} gfx_timer_sched_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -91,12 +104,100 @@ void gfx_timer_set_period(gfx_timer_handle_t timer, uint32_t period);
  */
 void gfx_timer_reset(gfx_timer_handle_t timer);
 
+/**
+ * @brief Get how many periods had elapsed when the timer last fired
+ *
+ * Call it from the timer callback: 1 when the timer ran on time, more when
+ * rendering held it back. Animations advance by this many frames to keep
+ * wall-clock speed instead of playing in slow motion.
+ * @param timer Timer handle
+ * @return Elapsed periods, 0 if timer is NULL or has not fired yet
+ */
+uint32_t gfx_timer_get_elapsed_periods(gfx_timer_handle_t timer);
+
 /**
  * @brief Get current system tick
- * @return Current tick value in milliseconds
+ * @return Current tick value in milliseconds (esp_timer wall clock)
  */
 uint32_t gfx_timer_tick_get(void);
 
+/*=====================
+ * Clock functions
+ *====================*/
+
+/**
+ * @brief Replace the clock that drives timers and FPS pacing
+ *
+ * Timer periods restart from the new clock's current time.
+ * @param handle Player handle
+ * @param clock_cb Clock source, NULL for the esp_timer wall clock
+ * @param user_data Passed to clock_cb
+ * @return ESP_OK on success
+ */
+esp_err_t gfx_timer_set_clock(void *handle, gfx_timer_clock_cb_t clock_cb, void *user_data);
+
+/**
+ * @brief Switch to a virtual clock that only advances with gfx_timer_step()
+ *
+ * Animation, label scrolling and motion timers then progress the same way on
+ * every run regardless of CPU speed. The virtual clock starts at 1 ms.
+ * @param handle Player handle
+ * @param enable true for the virtual clock, false to return to the wall clock
+ * @return ESP_OK on success
+ */
+esp_err_t gfx_timer_set_virtual_clock(void *handle, bool enable);
+
+/**
+ * @brief Advance the virtual clock and run the timers that fall due
+ *
+ * Time advances from deadline to deadline, so a timer fires once per elapsed
+ * period even when ms spans several periods. Render with gfx_refr_now()
+ * afterwards.
+ * @param handle Player handle
+ * @param ms Milliseconds to advance
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if the virtual clock is not enabled
+ */
+esp_err_t gfx_timer_step(void *handle, uint32_t ms);
+
+/**
+ * @brief Get the current time of the clock driving the timers
+ * @param handle Player handle
+ * @return Current tick value in milliseconds, 0 if handle is invalid
+ */
+uint32_t gfx_timer_clock_get(void *handle);
+
+/*=====================
+ * Frame scheduler functions
+ *====================*/
+
+/**
+ * @brief Align frames to the panel refresh
+ *
+ * The frame period becomes the smallest multiple of period_us not shorter
+ * than 1000/fps ms. With gfx_timer_vsync_notify_from_isr() feeding TE edges,
+ * each frame starts the smoothed render time before the next edge.
+ * @param handle Player handle
+ * @param period_us Panel refresh period in microseconds, 0 to pace by fps only
+ * @return ESP_OK on success
+ */
+esp_err_t gfx_timer_set_vsync(void *handle, uint32_t period_us);
+
+/**
+ * @brief Record a vsync / tear-effect edge; call from the TE GPIO ISR
+ *
+ * Only used with the wall clock and a period set by gfx_timer_set_vsync().
+ * @param handle Player handle
+ */
+void gfx_timer_vsync_notify_from_isr(void *handle);
+
+/**
+ * @brief Get frame scheduler counters
+ * @param handle Player handle
+ * @param out Filled with the counters
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if handle or out is NULL
+ */
+esp_err_t gfx_timer_get_sched_stats(void *handle, gfx_timer_sched_stats_t *out);
+
 /**
  * @brief Get actual FPS from timer manager
  * @param handle Player handle
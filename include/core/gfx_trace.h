@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * @brief Output sink for gfx_trace_dump()
+ *
+ * Called repeatedly with consecutive pieces of the JSON document; data is not
+ * NUL-terminated.
+ */
+typedef void (*gfx_trace_write_cb_t)(const char *data, size_t len, void *user_data);
+
+/**********************
+ *   PUBLIC API
+ **********************/
+
+/**
+ * @brief Resume recording trace events
+ *
+ * Recording is on from startup when CONFIG_GFX_TRACE is enabled.
+ *
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED when the tracer is disabled
+ */
+esp_err_t gfx_trace_start(void);
+
+/**
+ * @brief Stop recording; the buffer keeps its events until gfx_trace_clear()
+ *
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED when the tracer is disabled
+ */
+esp_err_t gfx_trace_stop(void);
+
+/**
+ * @brief Drop all recorded events
+ *
+ * Waits for events other tasks are still writing, so none lands in the
+ * emptied buffer.
+ *
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED when the tracer is disabled
+ */
+esp_err_t gfx_trace_clear(void);
+
+/**
+ * @brief Write the recorded events as Chrome trace-event JSON
+ *
+ * Emits the last CONFIG_GFX_TRACE_BUF_EVENTS events, oldest first, as
+ * {"traceEvents": [...]} with one "B"/"E" pair per span. Load the output in
+ * chrome://tracing or ui.perfetto.dev. Recording is paused while dumping,
+ * after events already being written have landed.
+ *
+ * @param write_cb Output sink
+ * @param user_data Passed to write_cb
+ * @return ESP_OK on success, ESP_ERR_INVALID_ARG if write_cb is NULL,
+ *         ESP_ERR_NOT_SUPPORTED when the tracer is disabled
+ */
+esp_err_t gfx_trace_dump(gfx_trace_write_cb_t write_cb, void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
@@ -8,9 +8,11 @@
 
 #include "core/gfx_types.h"
 #include "core/gfx_core.h"
+#include "core/gfx_cmd.h"
 #include "core/gfx_disp.h"
 #include "core/gfx_log.h"
 #include "core/gfx_timer.h"
+#include "core/gfx_trace.h"
 #include "core/gfx_touch.h"
 #include "core/gfx_obj.h"
 #include "widget/gfx_img.h"
@@ -20,6 +22,7 @@
 #include "widget/gfx_qrcode.h"
 #include "widget/gfx_label.h"
 #include "widget/gfx_button.h"
+#include "widget/gfx_cont.h"
 #include "widget/gfx_anim.h"
 #include "widget/gfx_font_lvgl.h"
 
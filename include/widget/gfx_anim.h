@@ -194,6 +194,19 @@ esp_err_t gfx_anim_set_mirror(gfx_obj_t *obj, bool enabled, int16_t offset);
  */
 esp_err_t gfx_anim_set_auto_mirror(gfx_obj_t *obj, bool enabled);
 
+/**
+ * @brief Skip frames to keep playback at wall-clock speed under load
+ *
+ * When rendering holds the animation timer back by several periods, the
+ * animation jumps ahead by that many frames instead of playing in slow
+ * motion. Enabled by default; disable it to show every frame.
+ *
+ * @param obj Animation object
+ * @param enabled Whether to skip frames
+ * @return ESP_OK on success, ESP_ERR_* otherwise
+ */
+esp_err_t gfx_anim_set_frame_skip(gfx_obj_t *obj, bool enabled);
+
 #ifdef __cplusplus
 }
 #endif
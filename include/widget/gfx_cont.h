@@ -0,0 +1,54 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+
+#include "esp_err.h"
+#include "core/gfx_disp.h"
+#include "core/gfx_obj.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Container: groups objects added with gfx_obj_set_parent(). Children are
+ * positioned relative to the container, clipped to its bounds, hidden with it
+ * and deleted with it. Moving the container redraws its old and new bounds
+ * once instead of invalidating each child.
+ */
+
+/**
+ * @brief Create a container object on a display
+ * @param disp Display from gfx_disp_add()
+ * @return Pointer to the created container (full display size, no background), NULL on failure
+ */
+gfx_obj_t *gfx_cont_create(gfx_disp_t *disp);
+
+/**
+ * @brief Set the container background color
+ * @param obj Container object
+ * @param color Background color
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t gfx_cont_set_bg_color(gfx_obj_t *obj, gfx_color_t color);
+
+/**
+ * @brief Enable or disable the container background fill
+ *
+ * With the background on, the container is opaque and hides whatever lies
+ * below it.
+ * @param obj Container object
+ * @param enable true to fill the bounds with the background color
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t gfx_cont_set_bg_enable(gfx_obj_t *obj, bool enable);
+
+#ifdef __cplusplus
+}
+#endif
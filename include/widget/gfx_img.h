@@ -19,6 +19,9 @@ extern "C" {
 /* Magic numbers for image headers */
 #define C_ARRAY_HEADER_MAGIC    0x19
 
+/* gfx_image_header_t.flags */
+#define GFX_IMAGE_FLAGS_PREMULTIPLIED   0x0001  /**< RGB565A8 colors are already multiplied by their alpha */
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -32,7 +35,7 @@ typedef enum {
 typedef struct {
     uint32_t magic: 8;          /**< Magic number. Must be GFX_IMAGE_HEADER_MAGIC */
     uint32_t cf : 8;            /**< Color format: See `gfx_color_format_t` */
-    uint32_t flags: 16;         /**< Image flags */
+    uint32_t flags: 16;         /**< Image flags: GFX_IMAGE_FLAGS_* */
     uint32_t w: 16;             /**< Width of the image */
     uint32_t h: 16;             /**< Height of the image */
     uint32_t stride: 16;        /**< Number of bytes in a row */
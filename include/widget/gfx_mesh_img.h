@@ -60,7 +60,8 @@ gfx_obj_t *gfx_mesh_img_create(gfx_disp_t *disp);
  * @brief Set a typed image source descriptor for the mesh.
  *
  * This is the preferred source setter for new code. It keeps the source type
- * explicit and aligned with the image widget API.
+ * explicit and aligned with the image widget API. Premultiplied
+ * RGB565A8 sources are rejected with ESP_ERR_NOT_SUPPORTED.
  *
  * @param obj Mesh-image object
  * @param src Typed image source descriptor
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+# SPDX-License-Identifier: Apache-2.0
+"""
+Compare two frame-time benchmark reports (test_apps [bench] case or host gfx_bench).
+
+Inputs are either the JSON report itself or a monitor log containing it between
+BENCH_REPORT_BEGIN / BENCH_REPORT_END. Exits with 1 when any scene's mean or p50
+frame time regresses by more than --threshold percent.
+
+    python3 bench_compare.py baseline.json current.json [--threshold 10]
+"""
+
+import argparse
+import json
+import sys
+
+BEGIN = 'BENCH_REPORT_BEGIN'
+END = 'BENCH_REPORT_END'
+GATED_KEYS = ('mean', 'p50')
+
+
+def load_report(path):
+    with open(path, 'r', encoding='utf-8', errors='replace') as f:
+        text = f.read()
+    if BEGIN in text:
+        text = text.split(BEGIN, 1)[1].split(END, 1)[0]
+    return json.loads(text)
+
+
+def pct(base, cur):
+    if base == 0:
+        return 0.0
+    return (cur - base) * 100.0 / base
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare frame-time benchmark reports')
+    parser.add_argument('baseline', help='Baseline report (JSON or monitor log)')
+    parser.add_argument('current', help='Current report (JSON or monitor log)')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='Allowed frame-time regression in percent (default: 10)')
+    args = parser.parse_args()
+
+    base = load_report(args.baseline)
+    cur = load_report(args.current)
+
+    if (base.get('target'), base.get('h_res'), base.get('v_res')) != \
+            (cur.get('target'), cur.get('h_res'), cur.get('v_res')):
+        print('warning: reports come from different targets or resolutions', file=sys.stderr)
+
+    base_scenes = {s['name']: s for s in base['scenes']}
+    failed = []
+
+    print(f"{'scene':<16} {'metric':<22} {'baseline':>10} {'current':>10} {'delta':>8}")
+    for scene in cur['scenes']:
+        name = scene['name']
+        ref = base_scenes.get(name)
+        if ref is None:
+            print(f'{name:<16} (not in baseline)')
+            continue
+
+        for key in ('mean', 'p50', 'p99'):
+            b = ref['frame_us'][key]
+            c = scene['frame_us'][key]
+            d = pct(b, c)
+            mark = ''
+            if key in GATED_KEYS and d > args.threshold:
+                mark = ' !'
+                failed.append(f'{name} frame_us.{key} {d:+.1f}%')
+            print(f"{name:<16} {'frame_us.' + key:<22} {b:>10} {c:>10} {d:>+7.1f}%{mark}")
+
+        for counter, stats in scene['blend'].items():
+            ref_stats = ref['blend'].get(counter, {})
+            if stats['pixels'] == 0 and ref_stats.get('pixels', 0) == 0:
+                continue
+            b = ref_stats.get('mpix_s', 0.0)
+            c = stats['mpix_s']
+            print(f"{name:<16} {counter + ' Mpix/s':<22} {b:>10.2f} {c:>10.2f} {pct(b, c):>+7.1f}%")
+
+        b = ref['heap_high_water']
+        c = scene['heap_high_water']
+        print(f"{name:<16} {'heap_high_water':<22} {b:>10} {c:>10} {pct(b, c):>+7.1f}%")
+
+    if failed:
+        print('\nRegressions over {:.1f}%:'.format(args.threshold))
+        for item in failed:
+            print('  ' + item)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -5,7 +5,7 @@
 PNG to RGB565/RGB565A8 C file converter
 Converts PNG images to RGB565 or RGB565A8 format with optional byte swapping
 RGB565: Pure RGB565 format without alpha channel
-RGB565A8: RGB565 with separate alpha channel
+RGB565A8: RGB565 with separate alpha channel, optionally premultiplied by alpha
 Supports both C file and binary output formats
 Can process single files or batch process all PNG files in a directory
 """
@@ -25,6 +25,10 @@ def rgb888_to_rgb565(r, g, b):
     b = (b >> 3) & 0x1F
     return (r << 11) | (g << 5) | b
 
+def premultiply_rgb(r, g, b, a):
+    """Scale RGB888 by alpha (0-255) with rounding"""
+    return ((r * a + 127) // 255, (g * a + 127) // 255, (b * a + 127) // 255)
+
 def rgb565_to_bytes(rgb565, swap16=False):
     """Convert RGB565 to bytes, optionally swapping byte order"""
     high_byte = (rgb565 >> 8) & 0xFF
@@ -43,7 +47,7 @@ def format_array(data, indent=4, per_line=130):
         lines.append(' ' * indent + line + ',')
     return '\n'.join(lines)
 
-def generate_c_file(image_path, output_path, var_name, swap16=False, use_alpha=True):
+def generate_c_file(image_path, output_path, var_name, swap16=False, use_alpha=True, premultiply=False):
     """Generate C file from PNG image
 
     Args:
@@ -52,6 +56,7 @@ def generate_c_file(image_path, output_path, var_name, swap16=False, use_alpha=T
         var_name: Variable name for the C array
         swap16: Enable byte swapping for RGB565
         use_alpha: True for RGB565A8, False for RGB565
+        premultiply: Store RGB565A8 colors multiplied by alpha (GFX_IMAGE_FLAGS_PREMULTIPLIED)
     """
 
     # Open and convert image
@@ -72,6 +77,8 @@ def generate_c_file(image_path, output_path, var_name, swap16=False, use_alpha=T
 
     for pixel in pixels:
         r, g, b, a = pixel
+        if premultiply:
+            r, g, b = premultiply_rgb(r, g, b, a)
 
         # Convert RGB to RGB565
         rgb565 = rgb888_to_rgb565(r, g, b)
@@ -89,13 +96,15 @@ def generate_c_file(image_path, output_path, var_name, swap16=False, use_alpha=T
         # RGB565A8: RGB565 first, then Alpha
         final_data = rgb565_data + alpha_data
         color_format = 'GFX_COLOR_FORMAT_RGB565A8'
-        format_name = 'RGB565A8'
+        format_name = 'RGB565A8 (premultiplied)' if premultiply else 'RGB565A8'
     else:
         # RGB565: Only RGB565 data
         final_data = rgb565_data
         color_format = 'GFX_COLOR_FORMAT_RGB565'
         format_name = 'RGB565'
 
+    flags_line = '    .header.flags = GFX_IMAGE_FLAGS_PREMULTIPLIED,\n' if use_alpha and premultiply else ''
+
     # Generate C file content
     c_content = f"""#include "gfx.h"
 
@@ -106,7 +115,7 @@ const uint8_t {var_name}_map[] = {{
 const gfx_image_dsc_t {var_name} = {{
     .header.cf = {color_format},
     .header.magic = C_ARRAY_HEADER_MAGIC,
-    .header.w = {width},
+{flags_line}    .header.w = {width},
     .header.h = {height},
     .data_size = {len(final_data)},
     .data = {var_name}_map,
@@ -130,7 +139,7 @@ const gfx_image_dsc_t {var_name} = {{
         print(f'Error writing file {output_path}: {e}')
         return False
 
-def generate_bin_file(image_path, output_path, swap16=False, use_alpha=True):
+def generate_bin_file(image_path, output_path, swap16=False, use_alpha=True, premultiply=False):
     """Generate binary file from PNG image with header compatible with gfx_image_header_t structure
 
     Args:
@@ -138,6 +147,7 @@ def generate_bin_file(image_path, output_path, swap16=False, use_alpha=True):
         output_path: Output binary file path
         swap16: Enable byte swapping for RGB565
         use_alpha: True for RGB565A8, False for RGB565
+        premultiply: Store RGB565A8 colors multiplied by alpha (GFX_IMAGE_FLAGS_PREMULTIPLIED)
     """
 
     # Open and convert image
@@ -158,6 +168,8 @@ def generate_bin_file(image_path, output_path, swap16=False, use_alpha=True):
 
     for pixel in pixels:
         r, g, b, a = pixel
+        if premultiply:
+            r, g, b = premultiply_rgb(r, g, b, a)
 
         # Convert RGB to RGB565
         rgb565 = rgb888_to_rgb565(r, g, b)
@@ -176,7 +188,7 @@ def generate_bin_file(image_path, output_path, swap16=False, use_alpha=True):
         final_data = rgb565_data + alpha_data
         cf = 0x0A  # GFX_COLOR_FORMAT_RGB565A8
         stride = width * 2  # Stride is only for RGB565 data
-        format_name = 'RGB565A8'
+        format_name = 'RGB565A8 (premultiplied)' if premultiply else 'RGB565A8'
     else:
         # RGB565: Only RGB565 data
         final_data = rgb565_data
@@ -186,7 +198,7 @@ def generate_bin_file(image_path, output_path, swap16=False, use_alpha=True):
 
     # Create gfx_image_header_t structure (12 bytes total)
     magic = 0x19  # C_ARRAY_HEADER_MAGIC
-    flags = 0x0000  # No special flags
+    flags = 0x0001 if use_alpha and premultiply else 0x0000  # GFX_IMAGE_FLAGS_PREMULTIPLIED
     reserved = 0x0000  # Reserved field
 
     # Pack gfx_image_header_t as bit fields in 3 uint32_t values
@@ -226,7 +238,7 @@ def generate_bin_file(image_path, output_path, swap16=False, use_alpha=True):
         print(f'Error writing file {output_path}: {e}')
         return False
 
-def process_single_file(input_file, output_dir, bin_format, swap16, use_alpha):
+def process_single_file(input_file, output_dir, bin_format, swap16, use_alpha, premultiply=False):
     """Process a single PNG file"""
     # Determine output path and variable name from input filename
     base_name = os.path.splitext(os.path.basename(input_file))[0]
@@ -234,7 +246,7 @@ def process_single_file(input_file, output_dir, bin_format, swap16, use_alpha):
     if bin_format:
         # Output binary file
         output_path = os.path.join(output_dir, f'{base_name}.bin')
-        return generate_bin_file(input_file, output_path, swap16, use_alpha)
+        return generate_bin_file(input_file, output_path, swap16, use_alpha, premultiply)
     else:
         # Output C file
         output_path = os.path.join(output_dir, f'{base_name}.c')
@@ -242,7 +254,7 @@ def process_single_file(input_file, output_dir, bin_format, swap16, use_alpha):
         var_name = re.sub(r'[^a-zA-Z0-9_]', '_', base_name)
         if var_name[0].isdigit():
             var_name = 'img_' + var_name
-        return generate_c_file(input_file, output_path, var_name, swap16, use_alpha)
+        return generate_c_file(input_file, output_path, var_name, swap16, use_alpha, premultiply)
 
 def find_png_files(input_path):
     """Find all PNG files in the given path"""
@@ -281,6 +293,9 @@ Examples:
   # Convert to RGB565 (without alpha) C file
   %(prog)s image.png --format rgb565
 
+  # Convert to premultiplied RGB565A8 (faster alpha blending)
+  %(prog)s image.png --premultiply
+
   # Convert to binary format with byte swapping
   %(prog)s image.png --bin --swap16
 
@@ -294,6 +309,8 @@ Examples:
     parser.add_argument('--swap16', action='store_true', help='Enable byte swapping for RGB565')
     parser.add_argument('--format', '-f', choices=['rgb565', 'rgb565a8'], default='rgb565a8',
                         help='Output format: rgb565 (no alpha) or rgb565a8 (with alpha, default)')
+    parser.add_argument('--premultiply', action='store_true',
+                        help='Store rgb565a8 colors premultiplied by alpha and set GFX_IMAGE_FLAGS_PREMULTIPLIED')
 
     args = parser.parse_args()
 
@@ -309,6 +326,9 @@ Examples:
 
     # Determine if alpha channel should be included
     use_alpha = (args.format == 'rgb565a8')
+    if args.premultiply and not use_alpha:
+        print('Error: --premultiply requires --format rgb565a8')
+        return 1
 
     # Find all PNG files
     png_files = find_png_files(args.input)
@@ -323,13 +343,14 @@ Examples:
     print(f'Output format: {args.format.upper()}')
     print(f'Output type: {"Binary" if args.bin else "C file"}')
     print(f'Byte swap: {"Enabled" if args.swap16 else "Disabled"}')
+    print(f'Premultiplied alpha: {"Enabled" if args.premultiply else "Disabled"}')
     print()
 
     # Process each PNG file
     success_count = 0
     for png_file in png_files:
         print(f'Processing: {png_file}')
-        if process_single_file(png_file, output_dir, args.bin, args.swap16, use_alpha):
+        if process_single_file(png_file, output_dir, args.bin, args.swap16, use_alpha, args.premultiply):
             success_count += 1
         print()  # Add blank line between files
 
@@ -18,31 +18,115 @@
 #endif
 
 /*********************
- *  Software Blend
+ *  Render
  *********************/
 
-#ifdef CONFIG_GFX_MESH_IMG_SCANLINE_MAX_VERTS
-#define GFX_MESH_IMG_SCANLINE_MAX_VERTS CONFIG_GFX_MESH_IMG_SCANLINE_MAX_VERTS
+#ifdef CONFIG_GFX_DISP_DIRTY_TILES
+#define GFX_DISP_DIRTY_TILES 1
 #else
-#define GFX_MESH_IMG_SCANLINE_MAX_VERTS 512U
+#define GFX_DISP_DIRTY_TILES 0
+#endif
+
+#ifdef CONFIG_GFX_DISP_DIRTY_TILE_W
+#define GFX_DISP_DIRTY_TILE_W CONFIG_GFX_DISP_DIRTY_TILE_W
+#else
+#define GFX_DISP_DIRTY_TILE_W 16
+#endif
+
+#ifdef CONFIG_GFX_DISP_DIRTY_TILE_H
+#define GFX_DISP_DIRTY_TILE_H CONFIG_GFX_DISP_DIRTY_TILE_H
+#else
+#define GFX_DISP_DIRTY_TILE_H 16
+#endif
+
+#ifdef CONFIG_GFX_DISP_COPY_ON_MOVE
+#define GFX_DISP_COPY_ON_MOVE 1
+#elif GFX_CONFIG_HAS_SDKCONFIG
+#define GFX_DISP_COPY_ON_MOVE 0
+#else
+#define GFX_DISP_COPY_ON_MOVE 1
+#endif
+
+#ifdef CONFIG_GFX_RENDER_PIPELINED_FLUSH
+#define GFX_RENDER_PIPELINED_FLUSH 1
+#elif GFX_CONFIG_HAS_SDKCONFIG
+#define GFX_RENDER_PIPELINED_FLUSH 0
+#else
+#define GFX_RENDER_PIPELINED_FLUSH 1
+#endif
+
+#ifdef CONFIG_GFX_RENDER_ADAPTIVE_CHUNK
+#define GFX_RENDER_ADAPTIVE_CHUNK 1
+#elif GFX_CONFIG_HAS_SDKCONFIG
+#define GFX_RENDER_ADAPTIVE_CHUNK 0
+#else
+#define GFX_RENDER_ADAPTIVE_CHUNK 1
+#endif
+
+#ifdef CONFIG_GFX_RENDER_FIRST_CHUNK_ROWS
+#define GFX_RENDER_FIRST_CHUNK_ROWS CONFIG_GFX_RENDER_FIRST_CHUNK_ROWS
+#else
+#define GFX_RENDER_FIRST_CHUNK_ROWS 16
+#endif
+
+#ifdef CONFIG_GFX_RENDER_STRIPE_WORKERS
+#define GFX_RENDER_STRIPE_WORKERS CONFIG_GFX_RENDER_STRIPE_WORKERS
+#else
+#define GFX_RENDER_STRIPE_WORKERS 0
+#endif
+
+#ifdef CONFIG_GFX_RENDER_STRIPE_MIN_ROWS
+#define GFX_RENDER_STRIPE_MIN_ROWS CONFIG_GFX_RENDER_STRIPE_MIN_ROWS
+#else
+#define GFX_RENDER_STRIPE_MIN_ROWS 8
+#endif
+
+#ifdef CONFIG_GFX_RENDER_OBJ_PERF
+#define GFX_RENDER_OBJ_PERF 1
+#else
+#define GFX_RENDER_OBJ_PERF 0
+#endif
+
+#ifdef CONFIG_GFX_DISP_PERF_HIST
+#define GFX_DISP_PERF_HIST 1
+#elif GFX_CONFIG_HAS_SDKCONFIG
+#define GFX_DISP_PERF_HIST 0
+#else
+#define GFX_DISP_PERF_HIST 1
+#endif
+
+#ifdef CONFIG_GFX_DISP_PERF_HIST_WINDOW
+#define GFX_DISP_PERF_HIST_WINDOW CONFIG_GFX_DISP_PERF_HIST_WINDOW
+#else
+#define GFX_DISP_PERF_HIST_WINDOW 1024
 #endif
 
-#ifdef CONFIG_GFX_BLEND_POLYGON_MAX_INTERSECTIONS
-#define GFX_BLEND_POLYGON_MAX_INTERSECTIONS CONFIG_GFX_BLEND_POLYGON_MAX_INTERSECTIONS
+#ifdef CONFIG_GFX_TRACE
+#define GFX_TRACE 1
 #else
-#define GFX_BLEND_POLYGON_MAX_INTERSECTIONS 64
+#define GFX_TRACE 0
 #endif
 
-#ifdef CONFIG_GFX_BLEND_POLYGON_SUB_SAMPLES
-#define GFX_BLEND_POLYGON_SUB_SAMPLES CONFIG_GFX_BLEND_POLYGON_SUB_SAMPLES
+#ifdef CONFIG_GFX_TRACE_BUF_EVENTS
+#define GFX_TRACE_BUF_EVENTS CONFIG_GFX_TRACE_BUF_EVENTS
 #else
-#define GFX_BLEND_POLYGON_SUB_SAMPLES 8
+#define GFX_TRACE_BUF_EVENTS 1024
 #endif
 
-#ifdef CONFIG_GFX_BLEND_POLYGON_COVERAGE_MAX_WIDTH
-#define GFX_BLEND_POLYGON_COVERAGE_MAX_WIDTH CONFIG_GFX_BLEND_POLYGON_COVERAGE_MAX_WIDTH
+#ifdef CONFIG_GFX_CMD_QUEUE_LEN
+#define GFX_CMD_QUEUE_LEN CONFIG_GFX_CMD_QUEUE_LEN
 #else
-#define GFX_BLEND_POLYGON_COVERAGE_MAX_WIDTH 512
+#define GFX_CMD_QUEUE_LEN 32
+#endif
+
+/*********************
+ *  Software Blend
+ *********************/
+
+#ifdef CONFIG_GFX_MESH_IMG_SCANLINE_MAX_VERTS
+#define GFX_MESH_IMG_SCANLINE_MAX_VERTS CONFIG_GFX_MESH_IMG_SCANLINE_MAX_VERTS
+#else
+#define GFX_MESH_IMG_SCANLINE_MAX_VERTS 512U
 #endif
 
 #ifdef CONFIG_GFX_BLEND_POLYGON_INWARD_AA
@@ -61,6 +145,12 @@
 #define GFX_BLEND_POLYGON_SOLID_HARD_EDGE 1
 #endif
 
+#ifdef CONFIG_GFX_BLEND_VECTOR
+#define GFX_BLEND_VECTOR 1
+#else
+#define GFX_BLEND_VECTOR 0
+#endif
+
 /*********************
  *  Motion Widget
  *********************/
@@ -0,0 +1,32 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "common/gfx_config_internal.h"
+#include "core/gfx_trace.h"
+
+/*
+ * Span markers for the ring-buffer tracer. name must point to static storage
+ * (string literal or class name); it is only dereferenced at dump time.
+ * Both macros compile to nothing unless CONFIG_GFX_TRACE is set.
+ */
+
+#if GFX_TRACE
+
+void gfx_trace_record(const char *name, char phase, uint32_t arg);
+
+#define GFX_TRACE_BEGIN(name, arg) gfx_trace_record((name), 'B', (uint32_t)(arg))
+#define GFX_TRACE_END(name)        gfx_trace_record((name), 'E', 0)
+
+#else
+
+#define GFX_TRACE_BEGIN(name, arg) do { } while (0)
+#define GFX_TRACE_END(name)        do { } while (0)
+
+#endif
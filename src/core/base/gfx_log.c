@@ -41,6 +41,7 @@ static const char *s_module_names[GFX_LOG_MODULE_COUNT] = {
     [GFX_LOG_MODULE_MOTION] = "motion",
     [GFX_LOG_MODULE_EAF_DEC] = "eaf_dec",
     [GFX_LOG_MODULE_QRCODE_LIB] = "qrcode_lib",
+    [GFX_LOG_MODULE_CONT] = "cont",
 };
 
 static gfx_log_level_t s_module_levels[GFX_LOG_MODULE_COUNT];
@@ -0,0 +1,214 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "common/gfx_trace_priv.h"
+
+#if GFX_TRACE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/* Distinct tasks tracked when dropping end events whose begin was overwritten */
+#define GFX_TRACE_DUMP_MAX_TIDS  16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    int64_t ts_us;
+    const char *name;
+    uint32_t arg;
+    uint32_t tid;
+    char phase;
+} gfx_trace_event_t;
+
+typedef struct {
+    uint32_t tid;
+    uint32_t depth;
+} gfx_trace_tid_depth_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static gfx_trace_event_t s_events[GFX_TRACE_BUF_EVENTS];
+static uint32_t s_write_idx;
+static uint32_t s_writers;      /**< gfx_trace_record() calls past the recording check */
+static bool s_recording = true;
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/** Stop recording and wait for producers still writing an event; returns the previous state */
+static bool gfx_trace_pause(void)
+{
+    bool was_recording = __atomic_exchange_n(&s_recording, false, __ATOMIC_SEQ_CST);
+
+    while (__atomic_load_n(&s_writers, __ATOMIC_SEQ_CST) != 0) {
+        vTaskDelay(1);
+    }
+    return was_recording;
+}
+
+/** Returns false for an end event with no recorded begin on the same task */
+static bool gfx_trace_balance(gfx_trace_tid_depth_t *tids, size_t *tid_count, const gfx_trace_event_t *ev)
+{
+    size_t i = 0;
+
+    while (i < *tid_count && tids[i].tid != ev->tid) {
+        i++;
+    }
+    if (i == *tid_count) {
+        if (*tid_count == GFX_TRACE_DUMP_MAX_TIDS) {
+            return true;
+        }
+        tids[i].tid = ev->tid;
+        tids[i].depth = 0;
+        (*tid_count)++;
+    }
+
+    if (ev->phase == 'B') {
+        tids[i].depth++;
+        return true;
+    }
+    if (tids[i].depth == 0) {
+        return false;
+    }
+    tids[i].depth--;
+    return true;
+}
+
+/**********************
+ *   PUBLIC FUNCTIONS
+ **********************/
+
+void gfx_trace_record(const char *name, char phase, uint32_t arg)
+{
+    /* Announce the write before checking, so gfx_trace_pause() either stops us or waits for us */
+    __atomic_fetch_add(&s_writers, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&s_recording, __ATOMIC_SEQ_CST)) {
+        uint32_t idx = __atomic_fetch_add(&s_write_idx, 1, __ATOMIC_RELAXED);
+        gfx_trace_event_t *ev = &s_events[idx % GFX_TRACE_BUF_EVENTS];
+
+        ev->ts_us = esp_timer_get_time();
+        ev->name = name;
+        ev->arg = arg;
+        ev->tid = (uint32_t)(uintptr_t)xTaskGetCurrentTaskHandle();
+        ev->phase = phase;
+    }
+    __atomic_fetch_sub(&s_writers, 1, __ATOMIC_RELEASE);
+}
+
+esp_err_t gfx_trace_start(void)
+{
+    __atomic_store_n(&s_recording, true, __ATOMIC_RELAXED);
+    return ESP_OK;
+}
+
+esp_err_t gfx_trace_stop(void)
+{
+    __atomic_store_n(&s_recording, false, __ATOMIC_RELAXED);
+    return ESP_OK;
+}
+
+esp_err_t gfx_trace_clear(void)
+{
+    bool was_recording = gfx_trace_pause();
+
+    __atomic_store_n(&s_write_idx, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&s_recording, was_recording, __ATOMIC_RELAXED);
+    return ESP_OK;
+}
+
+esp_err_t gfx_trace_dump(gfx_trace_write_cb_t write_cb, void *user_data)
+{
+    gfx_trace_tid_depth_t tids[GFX_TRACE_DUMP_MAX_TIDS];
+    size_t tid_count = 0;
+    char line[160];
+    bool first = true;
+
+    if (write_cb == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    bool was_recording = gfx_trace_pause();
+    uint32_t total = __atomic_load_n(&s_write_idx, __ATOMIC_RELAXED);
+    uint32_t count = (total > GFX_TRACE_BUF_EVENTS) ? GFX_TRACE_BUF_EVENTS : total;
+
+    static const char head[] = "{\"traceEvents\":[\n";
+    write_cb(head, sizeof(head) - 1, user_data);
+
+    for (uint32_t i = total - count; i != total; i++) {
+        const gfx_trace_event_t *ev = &s_events[i % GFX_TRACE_BUF_EVENTS];
+        int len;
+
+        if (!gfx_trace_balance(tids, &tid_count, ev)) {
+            continue;
+        }
+
+        if (ev->phase == 'B') {
+            len = snprintf(line, sizeof(line),
+                           "%s{\"name\":\"%s\",\"cat\":\"gfx\",\"ph\":\"B\",\"ts\":%" PRId64
+                           ",\"pid\":1,\"tid\":%" PRIu32 ",\"args\":{\"arg\":%" PRIu32 "}}",
+                           first ? "" : ",\n", ev->name ? ev->name : "?", ev->ts_us, ev->tid, ev->arg);
+        } else {
+            len = snprintf(line, sizeof(line),
+                           "%s{\"name\":\"%s\",\"cat\":\"gfx\",\"ph\":\"E\",\"ts\":%" PRId64
+                           ",\"pid\":1,\"tid\":%" PRIu32 "}",
+                           first ? "" : ",\n", ev->name ? ev->name : "?", ev->ts_us, ev->tid);
+        }
+        if (len > 0) {
+            write_cb(line, ((size_t)len < sizeof(line)) ? (size_t)len : sizeof(line) - 1, user_data);
+            first = false;
+        }
+    }
+
+    static const char tail[] = "\n],\"displayTimeUnit\":\"ms\"}\n";
+    write_cb(tail, sizeof(tail) - 1, user_data);
+
+    __atomic_store_n(&s_recording, was_recording, __ATOMIC_RELAXED);
+    return ESP_OK;
+}
+
+#else
+
+esp_err_t gfx_trace_start(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t gfx_trace_stop(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t gfx_trace_clear(void)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t gfx_trace_dump(gfx_trace_write_cb_t write_cb, void *user_data)
+{
+    (void)write_cb;
+    (void)user_data;
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#endif
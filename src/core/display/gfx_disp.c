@@ -7,21 +7,25 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <stdlib.h>
 #include <string.h>
 #define GFX_LOG_MODULE GFX_LOG_MODULE_DISP
 #include "common/gfx_log_priv.h"
 #include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
 #include "soc/soc_caps.h"
 
 #include "core/display/gfx_disp_priv.h"
 #include "core/display/gfx_refr_priv.h"
+#include "core/display/gfx_render_priv.h"
 #include "core/runtime/gfx_core_priv.h"
 
 /*********************
  *      DEFINES
  *********************/
+#define GFX_DISP_PERF_CLASS_MAX 16
 
 /**********************
  *      TYPEDEFS
@@ -38,6 +42,9 @@ static const char *TAG = "disp";
  **********************/
 
 static void gfx_disp_init_default_state(gfx_disp_t *disp);
+#if GFX_RENDER_OBJ_PERF
+static void gfx_disp_perf_counter_add(gfx_perf_counter_t *dst, const gfx_perf_counter_t *src);
+#endif
 
 /**********************
  *   STATIC FUNCTIONS
@@ -45,13 +52,22 @@ static void gfx_disp_init_default_state(gfx_disp_t *disp);
 
 static void gfx_disp_init_default_state(gfx_disp_t *disp)
 {
-    disp->child_list = NULL;
+    memset(&disp->children, 0, sizeof(disp->children));
     disp->next = NULL;
     disp->buf.buf_act = disp->buf.buf1;
     disp->style.bg_color.full = 0x0000;
     disp->style.bg_enable = true;
 }
 
+#if GFX_RENDER_OBJ_PERF
+static void gfx_disp_perf_counter_add(gfx_perf_counter_t *dst, const gfx_perf_counter_t *src)
+{
+    dst->calls += src->calls;
+    dst->pixels += src->pixels;
+    dst->time_us += src->time_us;
+}
+#endif
+
 /**********************
  *   PUBLIC FUNCTIONS
  **********************/
@@ -155,13 +171,8 @@ void gfx_disp_del(gfx_disp_t *disp)
         }
     }
 
-    gfx_obj_child_t *child_node = disp->child_list;
-    while (child_node != NULL) {
-        gfx_obj_child_t *next_child = child_node->next;
-        free(child_node);
-        child_node = next_child;
-    }
-    disp->child_list = NULL;
+    free(disp->children.objs);
+    memset(&disp->children, 0, sizeof(disp->children));
 
     if (disp->sync.event_group) {
         vEventGroupDelete(disp->sync.event_group);
@@ -169,6 +180,9 @@ void gfx_disp_del(gfx_disp_t *disp)
     }
 
     gfx_disp_buf_free(disp);
+    gfx_render_bin_free(disp);
+    gfx_sw_blend_scratch_free(&disp->render.scratch);
+    gfx_refr_tiles_deinit(disp);
     disp->ctx = NULL;
     disp->next = NULL;
 }
@@ -230,6 +244,10 @@ gfx_disp_t *gfx_disp_add(gfx_handle_t handle, const gfx_disp_config_t *cfg)
         }
     }
 
+    if (gfx_refr_tiles_init(new_disp) != ESP_OK) {
+        GFX_LOGW(TAG, "create display: dirty tiles unavailable, using rectangle list");
+    }
+
     if (ctx->disp == NULL) {
         ctx->disp = new_disp;
     } else {
@@ -254,25 +272,28 @@ esp_err_t gfx_disp_add_child(gfx_disp_t *disp, void *src)
     if (ctx == NULL) {
         return ESP_ERR_INVALID_STATE;
     }
-    ((gfx_obj_t *)src)->disp = disp;
 
-    gfx_obj_child_t *new_child = (gfx_obj_child_t *)malloc(sizeof(gfx_obj_child_t));
-    if (new_child == NULL) {
-        GFX_LOGE(TAG, "add display child: allocate child node failed");
-        return ESP_ERR_NO_MEM;
-    }
-    new_child->src = src;
-    new_child->next = NULL;
+    if (disp->children.count == disp->children.capacity) {
+        uint32_t capacity = disp->children.capacity ? (uint32_t)disp->children.capacity * 2U : 8U;
+        if (capacity > UINT16_MAX) {
+            capacity = UINT16_MAX;
+        }
+        if (capacity == disp->children.count) {
+            GFX_LOGE(TAG, "add display child: %u objects already on display", (unsigned)capacity);
+            return ESP_ERR_NO_MEM;
+        }
 
-    if (disp->child_list == NULL) {
-        disp->child_list = new_child;
-    } else {
-        gfx_obj_child_t *current = disp->child_list;
-        while (current->next != NULL) {
-            current = current->next;
+        gfx_obj_t **objs = realloc(disp->children.objs, capacity * sizeof(gfx_obj_t *));
+        if (objs == NULL) {
+            GFX_LOGE(TAG, "add display child: grow object array to %u failed", (unsigned)capacity);
+            return ESP_ERR_NO_MEM;
         }
-        current->next = new_child;
+        disp->children.objs = objs;
+        disp->children.capacity = (uint16_t)capacity;
     }
+
+    ((gfx_obj_t *)src)->disp = disp;
+    disp->children.objs[disp->children.count++] = (gfx_obj_t *)src;
     return ESP_OK;
 }
 
@@ -283,24 +304,39 @@ esp_err_t gfx_disp_remove_child(gfx_disp_t *disp, void *src)
         return ESP_ERR_INVALID_ARG;
     }
 
-    gfx_obj_child_t *current = disp->child_list;
-    gfx_obj_child_t *prev = NULL;
+    int32_t idx = gfx_disp_find_child(disp, (gfx_obj_t *)src);
+    if (idx < 0) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    disp->children.count--;
+    memmove(&disp->children.objs[idx], &disp->children.objs[idx + 1],
+            (disp->children.count - (uint32_t)idx) * sizeof(gfx_obj_t *));
+    return ESP_OK;
+}
 
-    while (current != NULL) {
-        if (current->src == src) {
-            if (prev == NULL) {
-                disp->child_list = current->next;
-            } else {
-                prev->next = current->next;
-            }
-            free(current);
-            return ESP_OK;
+int32_t gfx_disp_find_child(const gfx_disp_t *disp, const gfx_obj_t *obj)
+{
+    /* Walk topmost first (end of the array): recently created objects are the ones most often deleted or restacked */
+    for (int32_t i = (int32_t)disp->children.count - 1; i >= 0; i--) {
+        if (disp->children.objs[i] == obj) {
+            return i;
         }
-        prev = current;
-        current = current->next;
     }
+    return -1;
+}
 
-    return ESP_ERR_NOT_FOUND;
+void gfx_disp_move_child(gfx_disp_t *disp, uint16_t from, uint16_t to)
+{
+    gfx_obj_t **objs = disp->children.objs;
+    gfx_obj_t *obj = objs[from];
+
+    if (from < to) {
+        memmove(&objs[from], &objs[from + 1], (size_t)(to - from) * sizeof(gfx_obj_t *));
+    } else if (from > to) {
+        memmove(&objs[to + 1], &objs[to], (size_t)(from - to) * sizeof(gfx_obj_t *));
+    }
+    objs[to] = obj;
 }
 
 esp_err_t gfx_disp_delete_children(gfx_disp_t *disp)
@@ -309,16 +345,9 @@ esp_err_t gfx_disp_delete_children(gfx_disp_t *disp)
         return ESP_ERR_INVALID_ARG;
     }
 
-    while (disp->child_list != NULL) {
-        gfx_obj_t *obj = (gfx_obj_t *)disp->child_list->src;
-        if (obj == NULL) {
-            gfx_obj_child_t *node = disp->child_list;
-            disp->child_list = node->next;
-            free(node);
-            continue;
-        }
-
-        esp_err_t ret = gfx_obj_delete(obj);
+    /* Front to back: removing the last slot moves nothing */
+    while (disp->children.count > 0) {
+        esp_err_t ret = gfx_obj_delete(disp->children.objs[disp->children.count - 1]);
         if (ret != ESP_OK) {
             return ret;
         }
@@ -351,6 +380,7 @@ bool gfx_disp_flush_ready(gfx_disp_t *disp, bool swap_act_buf)
         return false;
     }
     disp->render.swap_act_buf = swap_act_buf;
+    disp->render.flush_done_us = esp_timer_get_time();
     if (xPortInIsrContext()) {
         BaseType_t pxHigherPriorityTaskWoken = pdFALSE;
         bool result = xEventGroupSetBitsFromISR(disp->sync.event_group, WAIT_FLUSH_DONE, &pxHigherPriorityTaskWoken);
@@ -426,11 +456,164 @@ esp_err_t gfx_disp_get_perf_stats(gfx_disp_t *disp, gfx_disp_perf_stats_t *out_s
         return ESP_ERR_INVALID_ARG;
     }
 
+    out_stats->frame_count = disp->render.frame_count;
     out_stats->dirty_pixels = disp->render.dirty_pixels;
     out_stats->frame_time_us = disp->render.frame_time_us;
     out_stats->render_time_us = disp->render.render_time_us;
     out_stats->flush_time_us = disp->render.flush_time_us;
+    out_stats->flush_wait_us = disp->render.flush_wait_us;
     out_stats->flush_count = disp->render.flush_count;
+    out_stats->overlap_time_us = disp->render.overlap_time_us;
+    out_stats->overlap_pct = 0;
+    if (disp->render.flush_time_us > 0) {
+        uint64_t pct = (disp->render.overlap_time_us * 100U) / disp->render.flush_time_us;
+        out_stats->overlap_pct = (uint8_t)(pct > 100U ? 100U : pct);
+    }
     out_stats->blend = disp->render.blend;
     return ESP_OK;
 }
+
+esp_err_t gfx_disp_get_frame_stats(gfx_disp_t *disp, gfx_disp_frame_stats_t *out)
+{
+    if (disp == NULL || out == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+#if GFX_DISP_PERF_HIST
+    gfx_perf_hist_summary(&disp->hist.frame, &out->frame_us);
+    gfx_perf_hist_summary(&disp->hist.render, &out->render_us);
+    gfx_perf_hist_summary(&disp->hist.flush, &out->flush_us);
+    gfx_perf_hist_summary(&disp->hist.latency, &out->latency_us);
+    return ESP_OK;
+#else
+    memset(out, 0, sizeof(*out));
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t gfx_disp_reset_frame_stats(gfx_disp_t *disp)
+{
+    if (disp == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+#if GFX_DISP_PERF_HIST
+    gfx_perf_hist_reset(&disp->hist.frame);
+    gfx_perf_hist_reset(&disp->hist.render);
+    gfx_perf_hist_reset(&disp->hist.flush);
+    gfx_perf_hist_reset(&disp->hist.latency);
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t gfx_disp_get_obj_perf_stats(gfx_disp_t *disp, gfx_obj_perf_stats_t *out, size_t max, size_t *out_count)
+{
+    if (disp == NULL || out == NULL || out_count == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *out_count = 0;
+
+#if GFX_RENDER_OBJ_PERF
+    size_t count = 0;
+
+    for (uint16_t n = 0; n < disp->children.count && max > 0; n++) {
+        gfx_obj_t *obj = disp->children.objs[n];
+        uint64_t cost = obj->perf.draw.time_us + obj->perf.update.time_us;
+        size_t pos = count;
+
+        /* Keep out[] sorted by cost, most expensive first; drop what falls off the end */
+        while (pos > 0 && out[pos - 1].draw.time_us + out[pos - 1].update.time_us < cost) {
+            pos--;
+        }
+        if (pos >= max) {
+            continue;
+        }
+        if (count < max) {
+            count++;
+        }
+        memmove(&out[pos + 1], &out[pos], (count - 1 - pos) * sizeof(out[0]));
+
+        out[pos].trace_id = obj->trace.create_seq;
+        out[pos].class_name = obj->trace.class_name;
+        out[pos].tag = obj->trace.create_tag;
+        out[pos].draw = obj->perf.draw;
+        out[pos].update = obj->perf.update;
+    }
+
+    *out_count = count;
+    return ESP_OK;
+#else
+    (void)max;
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t gfx_disp_get_class_perf_stats(gfx_disp_t *disp, gfx_class_perf_stats_t *out, size_t max, size_t *out_count)
+{
+    if (disp == NULL || out == NULL || out_count == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *out_count = 0;
+
+#if GFX_RENDER_OBJ_PERF
+    gfx_class_perf_stats_t classes[GFX_DISP_PERF_CLASS_MAX];
+    size_t class_count = 0;
+
+    memset(classes, 0, sizeof(classes));
+    for (uint16_t n = 0; n < disp->children.count; n++) {
+        gfx_obj_t *obj = disp->children.objs[n];
+        size_t i = 0;
+
+        while (i < class_count && classes[i].class_name != obj->trace.class_name) {
+            i++;
+        }
+        if (i == class_count) {
+            if (class_count == GFX_DISP_PERF_CLASS_MAX) {
+                continue;
+            }
+            classes[class_count++].class_name = obj->trace.class_name;
+        }
+        classes[i].obj_count++;
+        gfx_disp_perf_counter_add(&classes[i].draw, &obj->perf.draw);
+        gfx_disp_perf_counter_add(&classes[i].update, &obj->perf.update);
+    }
+
+    /* Selection sort: a handful of classes at most */
+    for (size_t i = 0; i < class_count && i < max; i++) {
+        size_t best = i;
+        for (size_t j = i + 1; j < class_count; j++) {
+            if (classes[j].draw.time_us + classes[j].update.time_us >
+                    classes[best].draw.time_us + classes[best].update.time_us) {
+                best = j;
+            }
+        }
+        gfx_class_perf_stats_t tmp = classes[i];
+        classes[i] = classes[best];
+        classes[best] = tmp;
+        out[i] = classes[i];
+        (*out_count)++;
+    }
+    return ESP_OK;
+#else
+    (void)max;
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t gfx_disp_reset_obj_perf_stats(gfx_disp_t *disp)
+{
+    if (disp == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+#if GFX_RENDER_OBJ_PERF
+    for (uint16_t n = 0; n < disp->children.count; n++) {
+        memset(&disp->children.objs[n]->perf, 0, sizeof(disp->children.objs[n]->perf));
+    }
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
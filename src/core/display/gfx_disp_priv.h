@@ -9,6 +9,8 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
 #include "core/gfx_disp.h"
+#include "core/display/gfx_perf_hist_priv.h"
+#include "core/draw/gfx_blend_priv.h"
 #include "core/object/gfx_obj_priv.h"
 
 #ifdef __cplusplus
@@ -29,9 +31,30 @@ struct gfx_core_context;
 #define GFX_DISP_INV_BUF_SIZE  64
 #endif
 
+#define GFX_DISP_MOVE_MAX       4       /**< Moved objects tracked per frame for copy-on-move */
+#define GFX_DISP_MOVE_LOG_SIZE  32      /**< Invalidated rects remembered per frame for copy-on-move */
+#define GFX_DISP_MOVE_NO_OWNER  0xFF
+
+#define GFX_RENDER_BIN_OPAQUE   0x01    /**< Draw overwrites every pixel of bounds (vfunc.is_opaque) */
+#define GFX_RENDER_BIN_CLIPPED  0x02    /**< bounds were cut by an ancestor container; clip drawing to them */
+
 /*********************
  *   INTERNAL STRUCTS
  *********************/
+/** One object invalidated this frame (copy-on-move bookkeeping) */
+typedef struct {
+    gfx_obj_t *obj;
+    gfx_area_t from;            /**< Inclusive screen rect before its first move this frame */
+    bool moved;
+    bool redraw;                /**< Also invalidated for anything other than a move */
+} gfx_refr_move_entry_t;
+
+/** One invalidated rect and the tracked object that caused it */
+typedef struct {
+    gfx_area_t area;            /**< Inclusive, clipped to the screen */
+    uint8_t owner;              /**< Index into move.entries, GFX_DISP_MOVE_NO_OWNER if untracked */
+} gfx_refr_move_log_t;
+
 /** Per-display state; one per screen, linked list for multi-display. Fields grouped by category. */
 struct gfx_disp {
     struct gfx_disp *next;
@@ -61,8 +84,12 @@ struct gfx_disp {
         EventGroupHandle_t event_group;
     } sync;
 
-    /** Child object list */
-    gfx_obj_child_t *child_list;
+    /** Objects in z-order, back to front; containers draw their children right after themselves */
+    struct {
+        gfx_obj_t **objs;
+        uint16_t count;
+        uint16_t capacity;
+    } children;
 
     /** Frame buffers */
     struct {
@@ -83,24 +110,81 @@ struct gfx_disp {
     struct {
         bool flushing_last;
         bool swap_act_buf;
+        uint32_t frame_count;
         uint32_t dirty_pixels;
         uint64_t frame_time_us;
         uint64_t render_time_us;
-        uint64_t flush_time_us;
+        uint64_t flush_time_us;     /**< flush_cb issue to gfx_disp_flush_ready(), summed over chunks */
+        uint64_t flush_wait_us;     /**< Render task blocked on WAIT_FLUSH_DONE */
         uint32_t flush_count;
+        uint64_t overlap_time_us;   /**< Render time spent while a flush was in flight */
+        int64_t flush_start_us;     /**< Issue time of the in-flight flush */
+        bool flush_inflight;        /**< flush_cb issued, WAIT_FLUSH_DONE not yet consumed */
+        uint32_t flush_px;          /**< Pixels in the in-flight flush */
+        volatile int64_t flush_done_us; /**< Stamped by gfx_disp_flush_ready() */
+        uint32_t chunk_px_last;     /**< Pixels in the previous chunk of this frame (0 = none yet) */
+        uint32_t render_ns_per_px;  /**< Running average of chunk draw cost (0 = unknown) */
+        uint32_t flush_ns_per_px;   /**< Running average of chunk transfer cost (0 = unknown) */
         gfx_blend_perf_stats_t blend;
+        gfx_blend_scratch_t scratch; /**< Polygon scratch for fills that outgrow the stack */
     } render;
 
+#if GFX_DISP_PERF_HIST
+    /** Rolling per-frame timing histograms, see gfx_disp_get_frame_stats() */
+    struct {
+        gfx_perf_hist_t frame;
+        gfx_perf_hist_t render;
+        gfx_perf_hist_t flush;
+        gfx_perf_hist_t latency;
+    } hist;
+#endif
+
     /** Dirty / invalidation state */
     struct {
         gfx_area_t areas[GFX_DISP_INV_BUF_SIZE];
         uint8_t merged[GFX_DISP_INV_BUF_SIZE];
         uint8_t count;
+        /** Tile bitmap (CONFIG_GFX_DISP_DIRTY_TILES); NULL = rectangle list mode */
+        uint32_t *tiles;
+        uint16_t tile_cols;
+        uint16_t tile_rows;
+        uint16_t tile_words;    /**< uint32_t words per tile row */
+        bool tiles_any;         /**< At least one bit set since the last collect */
+        int64_t first_inv_us;   /**< First invalidation since the last rendered frame (0 = none) */
     } dirty;
 
+    /**
+     * Per-frame object bins: built once per frame, narrowed per dirty area and per chunk.
+     * Parallel arrays in one allocation, indexed by bin slot (visible drawable objects in
+     * z-order), so the cull passes stream bounds and flags without touching the objects.
+     */
+    struct {
+        gfx_obj_t **objs;                 /**< Dereferenced only to draw */
+        gfx_area_t *bounds;               /**< Half-open screen bounds [x1, x2) x [y1, y2) */
+        uint16_t *subtree_end;            /**< Slot past the last descendant; slots in between are nested inside */
+        uint16_t *area_list;              /**< Slots that hit the current dirty area */
+        uint8_t *flags;                   /**< GFX_RENDER_BIN_* */
+        uint16_t count;
+        uint16_t area_count;
+        uint16_t capacity;
+        bool valid;                       /**< false = fall back to walking children */
+    } bin;
+
+    /** Copy-on-move (CONFIG_GFX_DISP_COPY_ON_MOVE, full_frame only): per-frame invalidation log and accepted blits */
+    struct {
+        gfx_refr_move_entry_t entries[GFX_DISP_MOVE_MAX];
+        gfx_refr_move_log_t log[GFX_DISP_MOVE_LOG_SIZE];
+        gfx_area_t blit_src[GFX_DISP_MOVE_MAX];     /**< Inclusive rects already on screen */
+        gfx_area_t blit_dst[GFX_DISP_MOVE_MAX];     /**< Where blit_src lands in buf_act */
+        uint8_t entry_count;
+        uint8_t log_count;
+        uint8_t blit_count;
+        bool disabled;                              /**< Untracked invalidation or table overflow this frame */
+    } move;
+
     /** Pending sync: dirty areas from previous frame to sync into buf_act at next render start (only non-merged areas, no merged flags) */
     struct {
-        gfx_area_t areas[GFX_DISP_INV_BUF_SIZE];
+        gfx_area_t areas[GFX_DISP_INV_BUF_SIZE + GFX_DISP_MOVE_MAX];
         uint8_t count;
     } sync_pending;
 };
@@ -149,9 +233,24 @@ esp_err_t gfx_disp_add_child(gfx_disp_t *disp, void *src);
  */
 esp_err_t gfx_disp_remove_child(gfx_disp_t *disp, void *src);
 
+/**
+ * @brief Find a child's slot in the z-order array, searching from the topmost object down
+ * @return Slot index, -1 if obj is not a child of disp
+ */
+int32_t gfx_disp_find_child(const gfx_disp_t *disp, const gfx_obj_t *obj);
+
+/**
+ * @brief Move a child to another slot of the z-order array, shifting the ones in between
+ * @param disp Display that owns the child
+ * @param from Current slot
+ * @param to New slot (< children.count)
+ * @internal Used by gfx_obj_set_index; the caller invalidates.
+ */
+void gfx_disp_move_child(gfx_disp_t *disp, uint16_t from, uint16_t to);
+
 /**
  * @brief Delete and detach every child object owned by a display.
- * @param disp Display that owns the child list
+ * @param disp Display that owns the children
  * @return ESP_OK on success
  * @internal Used during display/core teardown to ensure widget destructors run.
  */
@@ -0,0 +1,103 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <string.h>
+
+#include "core/display/gfx_perf_hist_priv.h"
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t gfx_perf_hist_index(uint64_t value)
+{
+    if (value < GFX_PERF_HIST_SUB_BUCKETS) {
+        return (uint32_t)value;
+    }
+    if (value >= (1ULL << GFX_PERF_HIST_MAX_EXP)) {
+        return GFX_PERF_HIST_BUCKETS - 1;
+    }
+
+    uint32_t exp = 63U - (uint32_t)__builtin_clzll(value);
+    uint32_t sub = (uint32_t)(value >> (exp - GFX_PERF_HIST_SUB_BITS)) & (GFX_PERF_HIST_SUB_BUCKETS - 1);
+    return (exp - GFX_PERF_HIST_SUB_BITS + 1) * GFX_PERF_HIST_SUB_BUCKETS + sub;
+}
+
+/** Largest value that maps to bucket idx */
+static uint32_t gfx_perf_hist_upper(uint32_t idx)
+{
+    if (idx < GFX_PERF_HIST_SUB_BUCKETS) {
+        return idx;
+    }
+
+    uint32_t shift = idx / GFX_PERF_HIST_SUB_BUCKETS - 1;
+    uint32_t sub = idx % GFX_PERF_HIST_SUB_BUCKETS;
+    uint64_t lower = (uint64_t)(GFX_PERF_HIST_SUB_BUCKETS + sub) << shift;
+    uint64_t upper = lower + (1ULL << shift) - 1;
+    return (upper > UINT32_MAX) ? UINT32_MAX : (uint32_t)upper;
+}
+
+static uint32_t gfx_perf_hist_percentile(const gfx_perf_hist_t *hist, uint32_t pct)
+{
+    uint32_t rank = (uint32_t)(((uint64_t)hist->count * pct + 99U) / 100U);
+    uint32_t seen = 0;
+
+    if (rank == 0) {
+        rank = 1;
+    }
+    for (uint32_t i = 0; i < GFX_PERF_HIST_BUCKETS; i++) {
+        seen += hist->buckets[i];
+        if (seen >= rank) {
+            uint32_t upper = gfx_perf_hist_upper(i);
+            return (upper < hist->max) ? upper : hist->max;
+        }
+    }
+    return hist->max;
+}
+
+/**********************
+ *   PUBLIC FUNCTIONS
+ **********************/
+
+void gfx_perf_hist_record(gfx_perf_hist_t *hist, uint64_t value_us)
+{
+    if (hist->count >= GFX_DISP_PERF_HIST_WINDOW) {
+        /* Age out: older samples keep half their weight each window */
+        hist->count = 0;
+        for (uint32_t i = 0; i < GFX_PERF_HIST_BUCKETS; i++) {
+            hist->buckets[i] >>= 1;
+            hist->count += hist->buckets[i];
+        }
+    }
+
+    hist->buckets[gfx_perf_hist_index(value_us)]++;
+    hist->count++;
+    if (value_us > hist->max) {
+        hist->max = (value_us > UINT32_MAX) ? UINT32_MAX : (uint32_t)value_us;
+    }
+}
+
+void gfx_perf_hist_summary(const gfx_perf_hist_t *hist, gfx_perf_dist_t *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (hist->count == 0) {
+        return;
+    }
+
+    out->count = hist->count;
+    out->p50 = gfx_perf_hist_percentile(hist, 50);
+    out->p90 = gfx_perf_hist_percentile(hist, 90);
+    out->p99 = gfx_perf_hist_percentile(hist, 99);
+    out->max = hist->max;
+}
+
+void gfx_perf_hist_reset(gfx_perf_hist_t *hist)
+{
+    memset(hist, 0, sizeof(*hist));
+}
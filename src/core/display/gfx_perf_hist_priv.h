@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "common/gfx_config_internal.h"
+#include "core/gfx_disp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*
+ * Log-linear buckets: values 0-3 us get one bucket each, every power of two
+ * above is split into GFX_PERF_HIST_SUB_BUCKETS (~19% wide). The last bucket
+ * holds everything from 2^GFX_PERF_HIST_MAX_EXP us (~67 s) up.
+ */
+#define GFX_PERF_HIST_SUB_BITS      2
+#define GFX_PERF_HIST_SUB_BUCKETS   (1U << GFX_PERF_HIST_SUB_BITS)
+#define GFX_PERF_HIST_MAX_EXP       26
+#define GFX_PERF_HIST_BUCKETS       ((GFX_PERF_HIST_MAX_EXP - 1) * GFX_PERF_HIST_SUB_BUCKETS)
+
+/*********************
+ *   INTERNAL STRUCTS
+ *********************/
+
+/** Rolling histogram of one timing metric; buckets are halved when count reaches GFX_DISP_PERF_HIST_WINDOW */
+typedef struct {
+    uint16_t buckets[GFX_PERF_HIST_BUCKETS];
+    uint32_t count;             /**< Samples currently weighted in buckets */
+    uint32_t max;               /**< Largest sample since the last reset */
+} gfx_perf_hist_t;
+
+/*********************
+ *   INTERNAL API
+ *********************/
+
+/**
+ * @brief Add one sample (microseconds) to a histogram
+ */
+void gfx_perf_hist_record(gfx_perf_hist_t *hist, uint64_t value_us);
+
+/**
+ * @brief Summarize a histogram as p50/p90/p99/max
+ *
+ * Percentiles report the upper edge of the bucket holding the nearest-rank
+ * sample, capped at max.
+ */
+void gfx_perf_hist_summary(const gfx_perf_hist_t *hist, gfx_perf_dist_t *out);
+
+/**
+ * @brief Drop all samples
+ */
+void gfx_perf_hist_reset(gfx_perf_hist_t *hist);
+
+#ifdef __cplusplus
+}
+#endif
@@ -7,6 +7,7 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
 
@@ -14,7 +15,10 @@
 #include "common/gfx_log_priv.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
+#include "esp_timer.h"
 
+#include "common/gfx_comm.h"
+#include "common/gfx_config_internal.h"
 #include "core/display/gfx_refr_priv.h"
 #include "core/runtime/gfx_core_priv.h"
 
@@ -36,14 +40,400 @@ static const char *TAG = "refr";
  *  STATIC PROTOTYPES
  **********************/
 
+static void gfx_refr_add_area(gfx_disp_t *disp, const gfx_area_t *clipped_area, const gfx_area_t *screen_area);
+static void gfx_refr_mark_tiles(gfx_disp_t *disp, const gfx_area_t *area);
+static uint32_t gfx_refr_tile_row_next(const gfx_disp_t *disp, const uint32_t *row, uint32_t col, bool set);
+static bool gfx_refr_tiles_to_areas(gfx_disp_t *disp, bool bands_only);
+static void gfx_refr_add_dirty(gfx_disp_t *disp, const gfx_area_t *clipped_area);
+static void gfx_refr_clear_dirty(gfx_disp_t *disp);
+static bool gfx_refr_invalidate(gfx_disp_t *disp, const gfx_area_t *area, gfx_area_t *clipped_area);
+static bool gfx_refr_move_active(const gfx_disp_t *disp);
+static void gfx_refr_move_reset(gfx_disp_t *disp);
+static uint8_t gfx_refr_move_entry(gfx_disp_t *disp, gfx_obj_t *obj);
+static void gfx_refr_move_log(gfx_disp_t *disp, const gfx_area_t *area, uint8_t owner);
+static bool gfx_refr_move_span_clear(gfx_disp_t *disp, const gfx_obj_t *obj, uint8_t owner, const gfx_area_t *span);
+static uint8_t gfx_refr_area_subtract(gfx_area_t out[4], const gfx_area_t *a, const gfx_area_t *b);
+static void gfx_refr_invalidate_clipped(gfx_disp_t *disp, const gfx_obj_t *obj, const gfx_area_t *from,
+                                        const gfx_area_t *clip);
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static void gfx_refr_mark_tiles(gfx_disp_t *disp, const gfx_area_t *area)
+{
+    uint32_t c1 = (uint32_t)area->x1 / GFX_DISP_DIRTY_TILE_W;
+    uint32_t c2 = (uint32_t)area->x2 / GFX_DISP_DIRTY_TILE_W;
+    uint32_t r1 = (uint32_t)area->y1 / GFX_DISP_DIRTY_TILE_H;
+    uint32_t r2 = (uint32_t)area->y2 / GFX_DISP_DIRTY_TILE_H;
+    uint32_t w1 = c1 >> 5;
+    uint32_t w2 = c2 >> 5;
+
+    for (uint32_t r = r1; r <= r2; r++) {
+        uint32_t *row = disp->dirty.tiles + r * disp->dirty.tile_words;
+        for (uint32_t w = w1; w <= w2; w++) {
+            uint32_t mask = UINT32_MAX;
+            if (w == w1) {
+                mask &= UINT32_MAX << (c1 & 31U);
+            }
+            if (w == w2) {
+                mask &= UINT32_MAX >> (31U - (c2 & 31U));
+            }
+            row[w] |= mask;
+        }
+    }
+    disp->dirty.tiles_any = true;
+}
+
+/* Find the first set bit at or after col in one tile row; returns tile_cols when none */
+static uint32_t gfx_refr_tile_row_next(const gfx_disp_t *disp, const uint32_t *row, uint32_t col, bool set)
+{
+    while (col < disp->dirty.tile_cols) {
+        uint32_t word = set ? row[col >> 5] : ~row[col >> 5];
+        word &= UINT32_MAX << (col & 31U);
+        if (word != 0) {
+            col = (col & ~31U) + (uint32_t)__builtin_ctz(word);
+            return (col < disp->dirty.tile_cols) ? col : disp->dirty.tile_cols;
+        }
+        col = (col & ~31U) + 32U;
+    }
+    return disp->dirty.tile_cols;
+}
+
+static bool gfx_refr_tiles_to_areas(gfx_disp_t *disp, bool bands_only)
+{
+    const uint8_t base = disp->dirty.count;
+    const gfx_coord_t x_max = (gfx_coord_t)disp->res.h_res - 1;
+    const gfx_coord_t y_max = (gfx_coord_t)disp->res.v_res - 1;
+
+    for (uint32_t r = 0; r < disp->dirty.tile_rows; r++) {
+        const uint32_t *row = disp->dirty.tiles + r * disp->dirty.tile_words;
+        uint32_t col = gfx_refr_tile_row_next(disp, row, 0, true);
+
+        while (col < disp->dirty.tile_cols) {
+            uint32_t run_end = gfx_refr_tile_row_next(disp, row, col, false);
+            if (bands_only) {
+                /* Extend to the last set tile of the row */
+                uint32_t next = run_end;
+                while ((next = gfx_refr_tile_row_next(disp, row, next, true)) < disp->dirty.tile_cols) {
+                    run_end = gfx_refr_tile_row_next(disp, row, next, false);
+                    next = run_end;
+                }
+            }
+
+            gfx_area_t band = {
+                .x1 = (gfx_coord_t)(col * GFX_DISP_DIRTY_TILE_W),
+                .y1 = (gfx_coord_t)(r * GFX_DISP_DIRTY_TILE_H),
+                .x2 = (gfx_coord_t)(run_end * GFX_DISP_DIRTY_TILE_W - 1),
+                .y2 = (gfx_coord_t)((r + 1) * GFX_DISP_DIRTY_TILE_H - 1),
+            };
+            band.x2 = MIN(band.x2, x_max);
+            band.y2 = MIN(band.y2, y_max);
+
+            /* Stack onto an identical run that ends on the previous tile row */
+            bool stacked = false;
+            for (uint8_t i = base; i < disp->dirty.count; i++) {
+                gfx_area_t *prev = &disp->dirty.areas[i];
+                if (prev->x1 == band.x1 && prev->x2 == band.x2 && prev->y2 + 1 == band.y1) {
+                    prev->y2 = band.y2;
+                    stacked = true;
+                    break;
+                }
+            }
+
+            if (!stacked) {
+                if (disp->dirty.count >= GFX_DISP_INV_BUF_SIZE) {
+                    disp->dirty.count = base;
+                    return false;
+                }
+                disp->dirty.merged[disp->dirty.count] = 0;
+                gfx_area_copy(&disp->dirty.areas[disp->dirty.count], &band);
+                disp->dirty.count++;
+            }
+
+            col = gfx_refr_tile_row_next(disp, row, run_end, true);
+        }
+    }
+    return true;
+}
+
+static void gfx_refr_add_area(gfx_disp_t *disp, const gfx_area_t *clipped_area, const gfx_area_t *screen_area)
+{
+    for (uint8_t i = 0; i < disp->dirty.count; i++) {
+        if (gfx_area_is_in(clipped_area, &disp->dirty.areas[i])) {
+            GFX_LOGD(TAG, "invalidate area: area is already covered by dirty area %d", i);
+            return;
+        }
+    }
+
+    if (disp->dirty.count < GFX_DISP_INV_BUF_SIZE) {
+        gfx_area_copy(&disp->dirty.areas[disp->dirty.count], clipped_area);
+        disp->dirty.count++;
+        GFX_LOGD(TAG, "invalidate area: added [%d,%d,%d,%d], total=%d",
+                 clipped_area->x1, clipped_area->y1, clipped_area->x2, clipped_area->y2, disp->dirty.count);
+    } else {
+        GFX_LOGW(TAG, "invalidate area: dirty buffer is full[%d], marking full screen", disp->dirty.count);
+        disp->dirty.count = 1;
+        gfx_area_copy(&disp->dirty.areas[0], screen_area);
+    }
+}
+
+static void gfx_refr_add_dirty(gfx_disp_t *disp, const gfx_area_t *clipped_area)
+{
+    if (disp->dirty.tiles != NULL) {
+        gfx_refr_mark_tiles(disp, clipped_area);
+    } else {
+        const gfx_area_t screen_area = {
+            0, 0, (gfx_coord_t)disp->res.h_res - 1, (gfx_coord_t)disp->res.v_res - 1
+        };
+        gfx_refr_add_area(disp, clipped_area, &screen_area);
+    }
+}
+
+static void gfx_refr_clear_dirty(gfx_disp_t *disp)
+{
+    disp->dirty.count = 0;
+    memset(disp->dirty.merged, 0, sizeof(disp->dirty.merged));
+    if (disp->dirty.tiles != NULL && disp->dirty.tiles_any) {
+        memset(disp->dirty.tiles, 0, (size_t)disp->dirty.tile_rows * disp->dirty.tile_words * sizeof(uint32_t));
+        disp->dirty.tiles_any = false;
+    }
+}
+
+/* Clip area to the screen, record it and wake the render task; false when fully off screen */
+static bool gfx_refr_invalidate(gfx_disp_t *disp, const gfx_area_t *area, gfx_area_t *clipped_area)
+{
+    gfx_area_t screen_area;
+    screen_area.x1 = 0;
+    screen_area.y1 = 0;
+    screen_area.x2 = disp->res.h_res - 1;
+    screen_area.y2 = disp->res.v_res - 1;
+
+    if (!gfx_area_intersect(clipped_area, area, &screen_area)) {
+        GFX_LOGD(TAG, "invalidate area: area is out of screen bounds");
+        return false;
+    }
+
+    gfx_refr_add_dirty(disp, clipped_area);
+    if (disp->dirty.first_inv_us == 0) {
+        disp->dirty.first_inv_us = esp_timer_get_time();
+    }
+
+    /* Wake render task so it refreshes without waiting for the next timer tick */
+    gfx_core_wake((gfx_core_context_t *)disp->ctx, GFX_EVENT_INVALIDATE);
+    return true;
+}
+
+static bool gfx_refr_move_active(const gfx_disp_t *disp)
+{
+#if GFX_DISP_COPY_ON_MOVE
+    return disp->flags.full_frame && !disp->move.disabled;
+#else
+    (void)disp;
+    return false;
+#endif
+}
+
+static void gfx_refr_move_reset(gfx_disp_t *disp)
+{
+    disp->move.entry_count = 0;
+    disp->move.log_count = 0;
+    disp->move.disabled = false;
+}
+
+/* Find or add the tracking entry of obj; GFX_DISP_MOVE_NO_OWNER when tracking is off or full */
+static uint8_t gfx_refr_move_entry(gfx_disp_t *disp, gfx_obj_t *obj)
+{
+    if (!gfx_refr_move_active(disp)) {
+        return GFX_DISP_MOVE_NO_OWNER;
+    }
+
+    for (uint8_t i = 0; i < disp->move.entry_count; i++) {
+        if (disp->move.entries[i].obj == obj) {
+            return i;
+        }
+    }
+
+    if (disp->move.entry_count >= GFX_DISP_MOVE_MAX) {
+        disp->move.disabled = true;
+        return GFX_DISP_MOVE_NO_OWNER;
+    }
+
+    uint8_t idx = disp->move.entry_count++;
+    memset(&disp->move.entries[idx], 0, sizeof(disp->move.entries[idx]));
+    disp->move.entries[idx].obj = obj;
+    return idx;
+}
+
+static void gfx_refr_move_log(gfx_disp_t *disp, const gfx_area_t *area, uint8_t owner)
+{
+    if (!gfx_refr_move_active(disp)) {
+        return;
+    }
+
+    if (disp->move.log_count >= GFX_DISP_MOVE_LOG_SIZE) {
+        disp->move.disabled = true;
+        return;
+    }
+
+    gfx_refr_move_log_t *log = &disp->move.log[disp->move.log_count++];
+    gfx_area_copy(&log->area, area);
+    log->owner = owner;
+}
+
+/* A move can be blitted when nothing else was invalidated in its span and nothing is drawn above it there */
+static bool gfx_refr_move_span_clear(gfx_disp_t *disp, const gfx_obj_t *obj, uint8_t owner, const gfx_area_t *span)
+{
+    for (uint8_t i = 0; i < disp->move.log_count; i++) {
+        if (disp->move.log[i].owner != owner && gfx_area_is_on(&disp->move.log[i].area, span)) {
+            return false;
+        }
+    }
+
+    bool above = false;
+    for (uint16_t i = 0; i < disp->children.count; i++) {
+        gfx_obj_t *other = disp->children.objs[i];
+
+        if (other == obj) {
+            above = true;
+            continue;
+        }
+        /* Children move with their container; other nested objects stack with their own container, so test them all */
+        if (!other->state.is_visible || gfx_obj_is_ancestor(obj, other) ||
+                (!above && other->parent == NULL)) {
+            continue;
+        }
+
+        gfx_obj_calc_pos_in_parent(other);
+        gfx_area_t other_area = {
+            other->geometry.x, other->geometry.y,
+            other->geometry.x + other->geometry.width - 1, other->geometry.y + other->geometry.height - 1
+        };
+        if (gfx_area_is_on(&other_area, span)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Invalidate a nested object's current bounds (and from, its bounds before a
+ * move) inside clip. The rects are logged without an owner so a copy-on-move
+ * blit underneath them is refused.
+ */
+static void gfx_refr_invalidate_clipped(gfx_disp_t *disp, const gfx_obj_t *obj, const gfx_area_t *from,
+                                        const gfx_area_t *clip)
+{
+    gfx_area_t to = {
+        obj->geometry.x, obj->geometry.y,
+        obj->geometry.x + obj->geometry.width - 1, obj->geometry.y + obj->geometry.height - 1
+    };
+    const gfx_area_t *areas[2] = { &to, from };
+    gfx_area_t area;
+    gfx_area_t clipped_area;
+
+    for (size_t i = 0; i < 2; i++) {
+        if (areas[i] != NULL && gfx_area_intersect(&area, areas[i], clip) &&
+                gfx_refr_invalidate(disp, &area, &clipped_area)) {
+            gfx_refr_move_log(disp, &clipped_area, GFX_DISP_MOVE_NO_OWNER);
+        }
+    }
+}
+
+/* Split a minus b into at most four rects: full-width bands above/below b, then the sides */
+static uint8_t gfx_refr_area_subtract(gfx_area_t out[4], const gfx_area_t *a, const gfx_area_t *b)
+{
+    gfx_area_t inter;
+    uint8_t n = 0;
+
+    if (!gfx_area_intersect(&inter, a, b)) {
+        out[0] = *a;
+        return 1;
+    }
+
+    if (a->y1 < inter.y1) {
+        out[n++] = (gfx_area_t) {
+            a->x1, a->y1, a->x2, inter.y1 - 1
+        };
+    }
+    if (a->y2 > inter.y2) {
+        out[n++] = (gfx_area_t) {
+            a->x1, inter.y2 + 1, a->x2, a->y2
+        };
+    }
+    if (a->x1 < inter.x1) {
+        out[n++] = (gfx_area_t) {
+            a->x1, inter.y1, inter.x1 - 1, inter.y2
+        };
+    }
+    if (a->x2 > inter.x2) {
+        out[n++] = (gfx_area_t) {
+            inter.x2 + 1, inter.y1, a->x2, inter.y2
+        };
+    }
+    return n;
+}
+
 /**********************
  *   PUBLIC FUNCTIONS
  **********************/
 
+esp_err_t gfx_refr_tiles_init(gfx_disp_t *disp)
+{
+#if GFX_DISP_DIRTY_TILES
+    if (disp == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t cols = (disp->res.h_res + GFX_DISP_DIRTY_TILE_W - 1) / GFX_DISP_DIRTY_TILE_W;
+    uint32_t rows = (disp->res.v_res + GFX_DISP_DIRTY_TILE_H - 1) / GFX_DISP_DIRTY_TILE_H;
+    uint32_t words = (cols + 31U) / 32U;
+
+    disp->dirty.tiles = (uint32_t *)calloc(rows * words, sizeof(uint32_t));
+    if (disp->dirty.tiles == NULL) {
+        GFX_LOGW(TAG, "init dirty tiles: allocate %" PRIu32 "x%" PRIu32 " bitmap failed", cols, rows);
+        return ESP_ERR_NO_MEM;
+    }
+    disp->dirty.tile_cols = (uint16_t)cols;
+    disp->dirty.tile_rows = (uint16_t)rows;
+    disp->dirty.tile_words = (uint16_t)words;
+    disp->dirty.tiles_any = false;
+#else
+    (void)disp;
+#endif
+    return ESP_OK;
+}
+
+void gfx_refr_tiles_deinit(gfx_disp_t *disp)
+{
+    if (disp == NULL || disp->dirty.tiles == NULL) {
+        return;
+    }
+
+    free(disp->dirty.tiles);
+    disp->dirty.tiles = NULL;
+    disp->dirty.tiles_any = false;
+}
+
+void gfx_refr_collect_dirty_tiles(gfx_disp_t *disp)
+{
+    if (disp == NULL || disp->dirty.tiles == NULL || !disp->dirty.tiles_any) {
+        return;
+    }
+
+    if (!gfx_refr_tiles_to_areas(disp, false) && !gfx_refr_tiles_to_areas(disp, true)) {
+        GFX_LOGW(TAG, "collect dirty tiles: too many bands, marking full screen");
+        disp->dirty.count = 1;
+        disp->dirty.merged[0] = 0;
+        disp->dirty.areas[0] = (gfx_area_t) {
+            0, 0, (gfx_coord_t)disp->res.h_res - 1, (gfx_coord_t)disp->res.v_res - 1
+        };
+    }
+
+    memset(disp->dirty.tiles, 0, (size_t)disp->dirty.tile_rows * disp->dirty.tile_words * sizeof(uint32_t));
+    disp->dirty.tiles_any = false;
+}
+
 /* Area helpers */
 void gfx_area_copy(gfx_area_t *dest, const gfx_area_t *src)
 {
@@ -175,48 +565,18 @@ void gfx_invalidate_area_disp(gfx_disp_t *disp, const gfx_area_t *area_p)
     }
 
     if (area_p == NULL) {
-        disp->dirty.count = 0;
-        memset(disp->dirty.merged, 0, sizeof(disp->dirty.merged));
+        gfx_refr_clear_dirty(disp);
+        gfx_refr_move_reset(disp);
+        disp->dirty.first_inv_us = 0;
         GFX_LOGD(TAG, "invalidate area: cleared all dirty areas");
         return;
     }
 
-    gfx_area_t screen_area;
-    screen_area.x1 = 0;
-    screen_area.y1 = 0;
-    screen_area.x2 = disp->res.h_res - 1;
-    screen_area.y2 = disp->res.v_res - 1;
+    /* Not attributable to one object: pixels under a move may have changed */
+    disp->move.disabled = true;
 
     gfx_area_t clipped_area;
-    bool success = gfx_area_intersect(&clipped_area, area_p, &screen_area);
-    if (!success) {
-        GFX_LOGD(TAG, "invalidate area: area is out of screen bounds");
-        return;
-    }
-
-    for (uint8_t i = 0; i < disp->dirty.count; i++) {
-        if (gfx_area_is_in(&clipped_area, &disp->dirty.areas[i])) {
-            GFX_LOGD(TAG, "invalidate area: area is already covered by dirty area %d", i);
-            return;
-        }
-    }
-
-    if (disp->dirty.count < GFX_DISP_INV_BUF_SIZE) {
-        gfx_area_copy(&disp->dirty.areas[disp->dirty.count], &clipped_area);
-        disp->dirty.count++;
-        GFX_LOGD(TAG, "invalidate area: added [%d,%d,%d,%d], total=%d",
-                 clipped_area.x1, clipped_area.y1, clipped_area.x2, clipped_area.y2, disp->dirty.count);
-    } else {
-        GFX_LOGW(TAG, "invalidate area: dirty buffer is full[%d], marking full screen", disp->dirty.count);
-        disp->dirty.count = 1;
-        gfx_area_copy(&disp->dirty.areas[0], &screen_area);
-    }
-
-    /* Wake render task so it refreshes without waiting for the next timer tick */
-    gfx_core_context_t *ctx = (gfx_core_context_t *)disp->ctx;
-    if (ctx != NULL && ctx->sync.render_events != NULL) {
-        xEventGroupSetBits(ctx->sync.render_events, GFX_EVENT_INVALIDATE);
-    }
+    gfx_refr_invalidate(disp, area_p, &clipped_area);
 }
 
 void gfx_invalidate_area(gfx_handle_t handle, const gfx_area_t *area_p)
@@ -253,29 +613,170 @@ void gfx_obj_invalidate(gfx_obj_t *obj)
         return;
     }
 
+    gfx_disp_t *disp = obj->disp;
     gfx_area_t obj_area;
+    gfx_area_t clipped_area;
+
+    obj->state.dirty = true;
+    obj->cache.valid = false;
+
+    if (obj->parent != NULL) {
+        /* Only the part inside every ancestor container can show; no copy-on-move tracking */
+        gfx_area_t clip;
+        if (gfx_obj_get_ancestor_clip(obj, &clip)) {
+            gfx_refr_invalidate_clipped(disp, obj, NULL, &clip);
+        }
+        return;
+    }
+
     obj_area.x1 = obj->geometry.x;
     obj_area.y1 = obj->geometry.y;
     obj_area.x2 = obj->geometry.x + obj->geometry.width - 1;
     obj_area.y2 = obj->geometry.y + obj->geometry.height - 1;
 
+    uint8_t owner = gfx_refr_move_entry(disp, obj);
+    if (owner != GFX_DISP_MOVE_NO_OWNER) {
+        disp->move.entries[owner].redraw = true;
+    }
+
+    if (gfx_refr_invalidate(disp, &obj_area, &clipped_area)) {
+        gfx_refr_move_log(disp, &clipped_area, owner);
+    }
+}
+
+void gfx_obj_invalidate_move(gfx_obj_t *obj, gfx_coord_t old_x, gfx_coord_t old_y)
+{
+    if (obj == NULL || obj->disp == NULL) {
+        GFX_LOGE(TAG, "invalidate move: object or display is NULL");
+        return;
+    }
+
+    gfx_disp_t *disp = obj->disp;
+    gfx_area_t clipped_area;
+    gfx_area_t from = {
+        old_x, old_y, old_x + obj->geometry.width - 1, old_y + obj->geometry.height - 1
+    };
+    gfx_area_t to = {
+        obj->geometry.x, obj->geometry.y,
+        obj->geometry.x + obj->geometry.width - 1, obj->geometry.y + obj->geometry.height - 1
+    };
+
     obj->state.dirty = true;
 
-    gfx_invalidate_area_disp(obj->disp, &obj_area);
+    if (obj->parent != NULL) {
+        gfx_area_t clip;
+        if (gfx_obj_get_ancestor_clip(obj, &clip)) {
+            gfx_refr_invalidate_clipped(disp, obj, &from, &clip);
+        }
+        return;
+    }
+
+    uint8_t owner = gfx_refr_move_entry(disp, obj);
+    if (owner != GFX_DISP_MOVE_NO_OWNER) {
+        gfx_refr_move_entry_t *entry = &disp->move.entries[owner];
+        /* Several moves in one frame blit from where the object was last shown */
+        if (!entry->moved) {
+            entry->from = from;
+            entry->moved = true;
+        }
+    }
+
+    if (gfx_refr_invalidate(disp, &from, &clipped_area)) {
+        gfx_refr_move_log(disp, &clipped_area, owner);
+    }
+    if (gfx_refr_invalidate(disp, &to, &clipped_area)) {
+        gfx_refr_move_log(disp, &clipped_area, owner);
+    }
 }
 
-void gfx_refr_update_layout_dirty(gfx_disp_t *disp)
+void gfx_refr_resolve_moves(gfx_disp_t *disp)
 {
-    if (disp == NULL || disp->child_list == NULL) {
+    if (disp == NULL) {
         return;
     }
 
-    gfx_obj_child_t *child_node = disp->child_list;
+    disp->move.blit_count = 0;
+    if (!gfx_refr_move_active(disp) || disp->move.entry_count == 0) {
+        return;
+    }
+
+    const gfx_area_t screen_area = {
+        0, 0, (gfx_coord_t)disp->res.h_res - 1, (gfx_coord_t)disp->res.v_res - 1
+    };
+    bool accepted[GFX_DISP_MOVE_MAX] = {0};
 
-    while (child_node != NULL) {
-        gfx_obj_t *obj = (gfx_obj_t *)child_node->src;
+    for (uint8_t i = 0; i < disp->move.entry_count; i++) {
+        const gfx_refr_move_entry_t *entry = &disp->move.entries[i];
+        gfx_obj_t *obj = entry->obj;
 
-        if (obj != NULL && obj->state.layout_dirty && obj->align.enabled) {
+        if (!entry->moved || entry->redraw || !obj->state.is_visible ||
+                obj->vfunc.is_opaque == NULL || !obj->vfunc.is_opaque(obj)) {
+            continue;
+        }
+
+        gfx_area_t to = {
+            obj->geometry.x, obj->geometry.y,
+            obj->geometry.x + obj->geometry.width - 1, obj->geometry.y + obj->geometry.height - 1
+        };
+        if ((to.x1 == entry->from.x1 && to.y1 == entry->from.y1) ||
+                (to.x2 - to.x1) != (entry->from.x2 - entry->from.x1) ||
+                (to.y2 - to.y1) != (entry->from.y2 - entry->from.y1) ||
+                !gfx_area_is_in(&entry->from, &screen_area) || !gfx_area_is_in(&to, &screen_area)) {
+            continue;
+        }
+
+        gfx_area_t span;
+        gfx_area_join(&span, &entry->from, &to);
+        if (!gfx_refr_move_span_clear(disp, obj, i, &span)) {
+            continue;
+        }
+
+        accepted[i] = true;
+        disp->move.blit_src[disp->move.blit_count] = entry->from;
+        disp->move.blit_dst[disp->move.blit_count] = to;
+        disp->move.blit_count++;
+    }
+
+    if (disp->move.blit_count == 0) {
+        return;
+    }
+
+    /* Replay this frame's invalidations without the accepted moves, plus the strips they uncover */
+    gfx_refr_clear_dirty(disp);
+    for (uint8_t i = 0; i < disp->move.log_count; i++) {
+        const gfx_refr_move_log_t *log = &disp->move.log[i];
+        if (log->owner == GFX_DISP_MOVE_NO_OWNER || !accepted[log->owner]) {
+            gfx_refr_add_dirty(disp, &log->area);
+        }
+    }
+    for (uint8_t i = 0; i < disp->move.blit_count; i++) {
+        gfx_area_t strips[4];
+        uint8_t strip_count = gfx_refr_area_subtract(strips, &disp->move.blit_src[i], &disp->move.blit_dst[i]);
+        for (uint8_t j = 0; j < strip_count; j++) {
+            gfx_refr_add_dirty(disp, &strips[j]);
+        }
+        GFX_LOGD(TAG, "resolve moves: blit (%d,%d) -> (%d,%d), %u strip(s)",
+                 disp->move.blit_src[i].x1, disp->move.blit_src[i].y1,
+                 disp->move.blit_dst[i].x1, disp->move.blit_dst[i].y1, (unsigned)strip_count);
+    }
+
+    if (disp->dirty.tiles != NULL) {
+        gfx_refr_collect_dirty_tiles(disp);
+    } else if (disp->dirty.count > 1) {
+        gfx_refr_merge_areas(disp);
+    }
+}
+
+void gfx_refr_update_layout_dirty(gfx_disp_t *disp)
+{
+    if (disp == NULL) {
+        return;
+    }
+
+    for (uint16_t i = 0; i < disp->children.count; i++) {
+        gfx_obj_t *obj = disp->children.objs[i];
+
+        if (obj->state.layout_dirty && obj->align.enabled) {
             gfx_coord_t old_x = obj->geometry.x;
             gfx_coord_t old_y = obj->geometry.y;
 
@@ -294,7 +795,5 @@ void gfx_refr_update_layout_dirty(gfx_disp_t *disp)
 
             obj->state.layout_dirty = false;
         }
-
-        child_node = child_node->next;
     }
 }
@@ -38,12 +38,55 @@ void gfx_invalidate_area(gfx_handle_t handle, const gfx_area_t *area);
  */
 void gfx_obj_invalidate(gfx_obj_t *obj);
 
+/**
+ * @brief Invalidate the old and new rect of an object that was only translated
+ * @param obj Object whose geometry already holds the new position
+ * @param old_x Previous x position
+ * @param old_y Previous y position
+ *
+ * Same dirty areas as two gfx_obj_invalidate() calls, but lets a full_frame
+ * display blit the object instead of redrawing it (see gfx_refr_resolve_moves).
+ */
+void gfx_obj_invalidate_move(gfx_obj_t *obj, gfx_coord_t old_x, gfx_coord_t old_y);
+
+/**
+ * @brief Turn qualifying moves of this frame into blits (CONFIG_GFX_DISP_COPY_ON_MOVE)
+ *
+ * A move qualifies when the object is opaque, kept its size, stays on screen,
+ * was not otherwise invalidated, and nothing else was invalidated or is drawn
+ * above it inside the span of both rects. Accepted moves are stored in
+ * disp->move.blit_src/blit_dst and the dirty list is rebuilt with only the
+ * uncovered strips in their place.
+ */
+void gfx_refr_resolve_moves(gfx_disp_t *disp);
+
 /**
  * @brief Update layout for all objects marked as layout dirty on a display
  * @param disp Display to update
  */
 void gfx_refr_update_layout_dirty(gfx_disp_t *disp);
 
+/**
+ * @brief Allocate the dirty tile bitmap when CONFIG_GFX_DISP_DIRTY_TILES is enabled
+ * @return ESP_OK (also when tile mode is disabled), ESP_ERR_NO_MEM on allocation failure
+ */
+esp_err_t gfx_refr_tiles_init(gfx_disp_t *disp);
+
+/**
+ * @brief Free the dirty tile bitmap
+ */
+void gfx_refr_tiles_deinit(gfx_disp_t *disp);
+
+/**
+ * @brief Convert pending dirty tiles into row-band rectangles appended to disp->dirty.areas
+ *
+ * Runs of tiles on one tile row become one rectangle; identical runs on
+ * consecutive tile rows are stacked. If the list would overflow, each tile
+ * row collapses to a single band. The bitmap is cleared afterwards.
+ * No-op in rectangle list mode.
+ */
+void gfx_refr_collect_dirty_tiles(gfx_disp_t *disp);
+
 /**
  * @brief Merge overlapping/adjacent dirty areas to minimize redraw regions
  * @param disp Display containing dirty areas
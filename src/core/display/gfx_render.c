@@ -7,6 +7,7 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <stdlib.h>
 #include <string.h>
 #include <inttypes.h>
 
@@ -15,8 +16,11 @@
 #define GFX_LOG_MODULE GFX_LOG_MODULE_RENDER
 #include "common/gfx_log_priv.h"
 
+#include "common/gfx_config_internal.h"
+#include "common/gfx_trace_priv.h"
 #include "core/display/gfx_refr_priv.h"
 #include "core/display/gfx_render_priv.h"
+#include "core/display/gfx_render_stripe_priv.h"
 #include "core/draw/gfx_blend_priv.h"
 #include "core/runtime/gfx_timer_priv.h"
 
@@ -39,6 +43,24 @@ static const char *TAG = "render";
  **********************/
 
 static void gfx_render_sync_dirty_areas(gfx_disp_t *disp);
+static void gfx_render_move_blit(gfx_disp_t *disp);
+static bool gfx_render_can_pipeline(gfx_disp_t *disp);
+static void gfx_render_wait_flush(gfx_disp_t *disp);
+static uint64_t gfx_render_flush_overlap_us(gfx_disp_t *disp, int64_t start_us, int64_t end_us);
+static void gfx_render_cost_update(uint32_t *avg_ns_per_px, uint64_t elapsed_us, uint32_t px);
+static uint32_t gfx_render_next_chunk_rows(gfx_disp_t *disp, uint32_t area_w, uint32_t max_rows, bool pipelined);
+static bool gfx_render_bin_reserve(gfx_disp_t *disp, uint32_t count);
+static void gfx_render_bin_add(gfx_disp_t *disp, gfx_obj_t *obj, const gfx_area_t *clip, bool clipped);
+static void gfx_render_bin_build(gfx_disp_t *disp);
+static void gfx_render_bin_select_area(gfx_disp_t *disp, const gfx_area_t *area);
+static bool gfx_render_bin_find_occluder(gfx_disp_t *disp, const gfx_area_t *clip, uint16_t *out_first);
+static void gfx_render_cache_build(gfx_obj_t *obj);
+static void gfx_render_cache_split_alpha(gfx_obj_t *obj, const gfx_color_t *on_white, size_t pixels, bool swap);
+static void gfx_render_draw_obj_content(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx);
+static void gfx_render_draw_obj(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx);
+static void gfx_render_update_obj(gfx_obj_t *obj);
+static void gfx_render_draw_subtree(gfx_disp_t *disp, const gfx_obj_t *parent, const gfx_draw_ctx_t *ctx);
+static bool gfx_render_ancestors_visible(const gfx_obj_t *obj);
 
 /**********************
  *   STATIC FUNCTIONS
@@ -78,56 +100,612 @@ static void gfx_render_sync_dirty_areas(gfx_disp_t *disp)
     }
 }
 
+/**
+ * Copy-on-move: shift pixels of translated objects to their new place in buf_act.
+ * Runs after the buffer sync so the sync cannot overwrite the destination.
+ */
+static void gfx_render_move_blit(gfx_disp_t *disp)
+{
+    if (disp->move.blit_count == 0 || !disp->flags.full_frame) {
+        return;
+    }
+
+    uint16_t *dst_buf = disp->buf.buf_act;
+    /* The front buffer holds the frame on screen; single-buffered displays copy in place */
+    const uint16_t *src_buf = (disp->buf.buf2 == NULL) ? dst_buf :
+                              ((dst_buf == disp->buf.buf1) ? disp->buf.buf2 : disp->buf.buf1);
+    uint32_t stride = disp->res.h_res;
+
+    for (uint8_t i = 0; i < disp->move.blit_count; i++) {
+        const gfx_area_t *src = &disp->move.blit_src[i];
+        const gfx_area_t *dst = &disp->move.blit_dst[i];
+        size_t row_bytes = (size_t)(dst->x2 - dst->x1 + 1) * sizeof(uint16_t);
+        int32_t rows = dst->y2 - dst->y1 + 1;
+        /* In place, walk away from the overlap so no source row is overwritten before it is read */
+        bool bottom_up = (src_buf == dst_buf) && (dst->y1 > src->y1);
+
+        for (int32_t r = 0; r < rows; r++) {
+            int32_t row = bottom_up ? (rows - 1 - r) : r;
+            memmove(dst_buf + (size_t)(dst->y1 + row) * stride + dst->x1,
+                    src_buf + (size_t)(src->y1 + row) * stride + src->x1,
+                    row_bytes);
+        }
+    }
+}
+
+/**
+ * Pipelined flush needs a second partial buffer: the chunk in flight keeps
+ * one buffer while the next chunk is drawn into the other. Full-frame
+ * buffers are swapped once per frame, so they keep the blocking path.
+ */
+static bool gfx_render_can_pipeline(gfx_disp_t *disp)
+{
+#if GFX_RENDER_PIPELINED_FLUSH
+    return disp->buf.buf2 != NULL && !disp->flags.full_frame;
+#else
+    (void)disp;
+    return false;
+#endif
+}
+
+static void gfx_render_wait_flush(gfx_disp_t *disp)
+{
+    if (!disp->render.flush_inflight) {
+        return;
+    }
+
+    GFX_TRACE_BEGIN("flush_wait", disp->render.flush_px);
+    int64_t wait_start_us = esp_timer_get_time();
+    xEventGroupWaitBits(disp->sync.event_group, WAIT_FLUSH_DONE, pdTRUE, pdFALSE, portMAX_DELAY);
+    int64_t wait_end_us = esp_timer_get_time();
+    GFX_TRACE_END("flush_wait");
+    disp->render.flush_wait_us += (uint64_t)(wait_end_us - wait_start_us);
+    disp->render.flush_count++;
+    disp->render.flush_inflight = false;
+
+    /*
+     * Transfer time comes from the flush_ready stamp, not from when we got
+     * around to waiting: in pipelined mode that span also covers drawing the
+     * next chunk
+     */
+    int64_t transfer_us = disp->render.flush_done_us - disp->render.flush_start_us;
+    if (transfer_us < 0) {
+        transfer_us = wait_end_us - disp->render.flush_start_us;
+    }
+    disp->render.flush_time_us += (uint64_t)transfer_us;
+    gfx_render_cost_update(&disp->render.flush_ns_per_px, (uint64_t)transfer_us, disp->render.flush_px);
+}
+
+/**
+ * Part of [start_us, end_us) during which the in-flight flush was still
+ * transferring: a flush that completed early in the chunk only overlaps
+ * until its flush_ready stamp.
+ */
+static uint64_t gfx_render_flush_overlap_us(gfx_disp_t *disp, int64_t start_us, int64_t end_us)
+{
+    int64_t flush_start_us = disp->render.flush_start_us;
+    int64_t done_us = disp->render.flush_done_us;
+
+    if (done_us >= flush_start_us && done_us < end_us) {
+        end_us = done_us;
+    }
+    if (flush_start_us > start_us) {
+        start_us = flush_start_us;
+    }
+    return (end_us > start_us) ? (uint64_t)(end_us - start_us) : 0U;
+}
+
+/** Fold one sample into a running ns-per-pixel average (weight 1/4) */
+static void gfx_render_cost_update(uint32_t *avg_ns_per_px, uint64_t elapsed_us, uint32_t px)
+{
+    if (px == 0) {
+        return;
+    }
+
+    uint64_t sample = elapsed_us * 1000U / px;
+    if (sample > UINT32_MAX) {
+        sample = UINT32_MAX;
+    }
+    if (*avg_ns_per_px == 0) {
+        *avg_ns_per_px = (uint32_t)sample;
+    } else {
+        *avg_ns_per_px = (uint32_t)((int64_t)*avg_ns_per_px + ((int64_t)sample - (int64_t)*avg_ns_per_px) / 4);
+    }
+}
+
+/**
+ * Pick the next chunk height. Without pipelining the buffer limit is best (fewest round trips).
+ * With pipelining the frame starts with a short chunk so the first transfer begins early; later
+ * chunks are scaled by flush/render cost so drawing chunk N+1 roughly matches flushing chunk N.
+ */
+static uint32_t gfx_render_next_chunk_rows(gfx_disp_t *disp, uint32_t area_w, uint32_t max_rows, bool pipelined)
+{
+#if GFX_RENDER_ADAPTIVE_CHUNK
+    uint32_t render_ns = disp->render.render_ns_per_px;
+    uint32_t flush_ns = disp->render.flush_ns_per_px;
+    uint32_t rows;
+
+    if (!pipelined) {
+        return max_rows;
+    }
+
+    if (disp->render.chunk_px_last == 0) {
+        rows = GFX_RENDER_FIRST_CHUNK_ROWS;
+    } else if (render_ns != 0 && flush_ns > render_ns) {
+        /* Transfer-bound: grow until the CPU just keeps up with the DMA */
+        uint64_t px = (uint64_t)disp->render.chunk_px_last * flush_ns / render_ns;
+        rows = (uint32_t)((px / area_w < max_rows) ? px / area_w : max_rows);
+    } else {
+        /* Render-bound or no history yet: the DMA idles anyway, so minimize chunk count */
+        rows = max_rows;
+    }
+
+    if (rows < GFX_RENDER_FIRST_CHUNK_ROWS) {
+        rows = GFX_RENDER_FIRST_CHUNK_ROWS;
+    }
+    return (rows < max_rows) ? rows : max_rows;
+#else
+    (void)disp;
+    (void)area_w;
+    (void)pipelined;
+    return max_rows;
+#endif
+}
+
+static bool gfx_render_bin_reserve(gfx_disp_t *disp, uint32_t count)
+{
+    if (count <= disp->bin.capacity) {
+        return true;
+    }
+    if (count > UINT16_MAX) {
+        return false;
+    }
+
+    uint32_t capacity = disp->bin.capacity ? disp->bin.capacity : 16;
+    while (capacity < count) {
+        capacity *= 2;
+    }
+    if (capacity > UINT16_MAX) {
+        capacity = UINT16_MAX;
+    }
+
+    /* One block, widest element first so every array stays aligned; the old contents are rebuilt anyway */
+    size_t objs_size = capacity * sizeof(gfx_obj_t *);
+    size_t bounds_size = capacity * sizeof(gfx_area_t);
+    uint8_t *block = malloc(objs_size + bounds_size + capacity * (2 * sizeof(uint16_t) + sizeof(uint8_t)));
+    if (block == NULL) {
+        return false;
+    }
+    free(disp->bin.objs);
+
+    disp->bin.objs = (gfx_obj_t **)block;
+    disp->bin.bounds = (gfx_area_t *)(block + objs_size);
+    disp->bin.subtree_end = (uint16_t *)(block + objs_size + bounds_size);
+    disp->bin.area_list = disp->bin.subtree_end + capacity;
+    disp->bin.flags = (uint8_t *)(disp->bin.area_list + capacity);
+    disp->bin.capacity = (uint16_t)capacity;
+    return true;
+}
+
+/**
+ * Append obj and, for a container, its visible children right after it.
+ * clip is the half-open intersection of all ancestor bounds; entries that
+ * fall outside it are dropped together with their subtree.
+ */
+static void gfx_render_bin_add(gfx_disp_t *disp, gfx_obj_t *obj, const gfx_area_t *clip, bool clipped)
+{
+    gfx_area_t bounds;
+
+    gfx_obj_calc_pos_in_parent(obj);
+    bounds.x1 = obj->geometry.x;
+    bounds.y1 = obj->geometry.y;
+    bounds.x2 = obj->geometry.x + (gfx_coord_t)obj->geometry.width;
+    bounds.y2 = obj->geometry.y + (gfx_coord_t)obj->geometry.height;
+    if (clipped && !gfx_area_intersect_exclusive(&bounds, &bounds, clip)) {
+        return;
+    }
+
+    uint16_t slot = disp->bin.count++;
+    disp->bin.objs[slot] = obj;
+    disp->bin.bounds[slot] = bounds;
+    disp->bin.flags[slot] = (clipped ? GFX_RENDER_BIN_CLIPPED : 0) |
+                            ((obj->vfunc.is_opaque != NULL && obj->vfunc.is_opaque(obj)) ? GFX_RENDER_BIN_OPAQUE : 0);
+
+    if (obj->type == GFX_OBJ_TYPE_CONTAINER) {
+        for (uint16_t i = 0; i < disp->children.count; i++) {
+            gfx_obj_t *child = disp->children.objs[i];
+
+            if (child->parent == obj && child->state.is_visible && child->vfunc.draw != NULL) {
+                gfx_render_bin_add(disp, child, &bounds, true);
+            }
+        }
+    }
+    disp->bin.subtree_end[slot] = disp->bin.count;
+}
+
+/**
+ * Resolve layout and bounds of every visible object once per frame so the
+ * chunk loop only tests a cached rectangle instead of dereferencing objects.
+ * This is the only place positions are resolved during a frame: draw vfuncs
+ * run concurrently on stripe workers and must treat geometry as read-only.
+ * Objects inside containers follow their container, which lets area
+ * selection skip a whole subtree that misses the dirty area.
+ */
+static void gfx_render_bin_build(gfx_disp_t *disp)
+{
+    uint32_t child_count = disp->children.count;
+
+    disp->bin.valid = false;
+    disp->bin.count = 0;
+    disp->bin.area_count = 0;
+
+    if (child_count == 0) {
+        disp->bin.valid = true;
+        return;
+    }
+    if (!gfx_render_bin_reserve(disp, child_count)) {
+        GFX_LOGW(TAG, "object bin: reserve %" PRIu32 " entries failed, walking children", child_count);
+        /* Draws only read geometry, so resolve it here before any stripe runs */
+        for (uint16_t i = 0; i < disp->children.count; i++) {
+            gfx_obj_t *obj = disp->children.objs[i];
+
+            if (obj->state.is_visible && obj->vfunc.draw != NULL) {
+                gfx_obj_calc_pos_in_parent(obj);
+            }
+        }
+        return;
+    }
+
+    for (uint16_t i = 0; i < disp->children.count; i++) {
+        gfx_obj_t *obj = disp->children.objs[i];
+
+        if (obj->parent != NULL || !obj->state.is_visible || obj->vfunc.draw == NULL) {
+            continue;
+        }
+        gfx_render_bin_add(disp, obj, NULL, false);
+    }
+    disp->bin.valid = true;
+}
+
+static void gfx_render_bin_select_area(gfx_disp_t *disp, const gfx_area_t *area)
+{
+    disp->bin.area_count = 0;
+
+    for (uint16_t i = 0; i < disp->bin.count;) {
+        const gfx_area_t *b = &disp->bin.bounds[i];
+
+        /* area is inclusive, bounds are half-open; descendants lie inside b, so a miss culls them all */
+        if (b->x1 > area->x2 || b->x2 <= area->x1 || b->y1 > area->y2 || b->y2 <= area->y1) {
+            i = disp->bin.subtree_end[i];
+            continue;
+        }
+        disp->bin.area_list[disp->bin.area_count++] = i++;
+    }
+}
+
+/**
+ * Find the topmost opaque object that fully covers the chunk. Everything
+ * below it, including the background fill, would be overwritten anyway.
+ */
+static bool gfx_render_bin_find_occluder(gfx_disp_t *disp, const gfx_area_t *clip, uint16_t *out_first)
+{
+    if (!disp->bin.valid) {
+        return false;
+    }
+
+    for (int32_t i = (int32_t)disp->bin.area_count - 1; i >= 0; i--) {
+        uint16_t slot = disp->bin.area_list[i];
+        const gfx_area_t *b = &disp->bin.bounds[slot];
+
+        if (!(disp->bin.flags[slot] & GFX_RENDER_BIN_OPAQUE)) {
+            continue;
+        }
+        if (b->x1 <= clip->x1 && b->y1 <= clip->y1 && b->x2 >= clip->x2 && b->y2 >= clip->y2) {
+            *out_first = (uint16_t)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Render a cache_as_bitmap object into its private buffer. Drawing it once on
+ * black and once on white gives a*F and a*F + (1 - a) * white per channel, so
+ * the difference yields coverage and the black pass the premultiplied color.
+ */
+static void gfx_render_cache_build(gfx_obj_t *obj)
+{
+    uint16_t w;
+    uint16_t h;
+    size_t pixels;
+    bool opaque;
+
+    /* Runs before gfx_render_bin_build(), so a moved or aligned object is not resolved yet */
+    gfx_obj_calc_pos_in_parent(obj);
+    w = obj->geometry.width;
+    h = obj->geometry.height;
+    pixels = (size_t)w * h;
+    opaque = (obj->vfunc.is_opaque != NULL) && obj->vfunc.is_opaque(obj);
+
+    if (pixels == 0 || obj->vfunc.draw == NULL) {
+        return;
+    }
+
+    if (obj->cache.buf == NULL || obj->cache.width != w || obj->cache.height != h) {
+        gfx_obj_cache_free(obj);
+        obj->cache.buf = malloc(pixels * sizeof(gfx_color_t));
+        if (obj->cache.buf == NULL) {
+            GFX_LOGW(TAG, "bitmap cache: no mem for %ux%u, drawing directly", (unsigned)w, (unsigned)h);
+            obj->cache.enabled = false;
+            return;
+        }
+        obj->cache.width = w;
+        obj->cache.height = h;
+    }
+
+    gfx_draw_ctx_t ctx = {
+        .buf = obj->cache.buf,
+        .buf_area = {obj->geometry.x, obj->geometry.y, obj->geometry.x + w, obj->geometry.y + h},
+        .clip_area = {obj->geometry.x, obj->geometry.y, obj->geometry.x + w, obj->geometry.y + h},
+        .stride = w,
+        .swap = obj->disp->flags.swap,
+    };
+
+    gfx_sw_blend_fill((uint16_t *)obj->cache.buf, 0x0000, pixels);
+    obj->vfunc.draw(obj, &ctx);
+
+    if (!opaque) {
+        gfx_color_t *on_white = malloc(pixels * sizeof(gfx_color_t));
+
+        if (obj->cache.mask == NULL) {
+            obj->cache.mask = malloc(pixels);
+        }
+        if (on_white == NULL || obj->cache.mask == NULL) {
+            GFX_LOGW(TAG, "bitmap cache: no mem for coverage of %ux%u, drawing directly", (unsigned)w, (unsigned)h);
+            free(on_white);
+            gfx_obj_cache_free(obj);
+            obj->cache.enabled = false;
+            return;
+        }
+
+        ctx.buf = on_white;
+        gfx_sw_blend_fill((uint16_t *)on_white, 0xFFFF, pixels);
+        obj->vfunc.draw(obj, &ctx);
+        gfx_render_cache_split_alpha(obj, on_white, pixels, ctx.swap);
+        free(on_white);
+    } else {
+        free(obj->cache.mask);
+        obj->cache.mask = NULL;
+    }
+
+    obj->cache.valid = true;
+}
+
+/** Turn the black/white passes into straight color plus coverage; drop the mask if all pixels cover */
+static void gfx_render_cache_split_alpha(gfx_obj_t *obj, const gfx_color_t *on_white, size_t pixels, bool swap)
+{
+    gfx_color_t *buf = obj->cache.buf;
+    gfx_opa_t *mask = obj->cache.mask;
+    bool all_cover = true;
+
+    for (size_t i = 0; i < pixels; i++) {
+        uint16_t pb = gfx_color_to_native_u16(buf[i], swap);
+        uint16_t pw = gfx_color_to_native_u16(on_white[i], swap);
+        int32_t rb = pb >> 11, gb = (pb >> 5) & 0x3F, bb = pb & 0x1F;
+        int32_t rw = pw >> 11, gw = (pw >> 5) & 0x3F, bw = pw & 0x1F;
+        int32_t transp = ((rw - rb) * 255 / 31 + (gw - gb) * 255 / 63 + (bw - bb) * 255 / 31) / 3;
+        gfx_opa_t opa = (gfx_opa_t)(255 - ((transp < 0) ? 0 : (transp > 255) ? 255 : transp));
+
+        mask[i] = opa;
+        if (opa == 255) {
+            continue;
+        }
+        all_cover = false;
+        if (opa == 0) {
+            buf[i].full = 0;
+            continue;
+        }
+
+        int32_t r = rb * 255 / opa, g = gb * 255 / opa, b = bb * 255 / opa;
+        gfx_color_t c;
+        c.full = (uint16_t)(((r > 0x1F ? 0x1F : r) << 11) | ((g > 0x3F ? 0x3F : g) << 5) | (b > 0x1F ? 0x1F : b));
+        buf[i].full = gfx_color_to_native_u16(c, swap);
+    }
+
+    if (all_cover) {
+        free(obj->cache.mask);
+        obj->cache.mask = NULL;
+    }
+}
+
+static void gfx_render_draw_obj_content(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
+{
+    if (!obj->cache.enabled || !obj->cache.valid) {
+        obj->vfunc.draw(obj, ctx);
+        return;
+    }
+
+    gfx_area_t obj_area = {
+        obj->geometry.x, obj->geometry.y,
+        obj->geometry.x + obj->cache.width, obj->geometry.y + obj->cache.height
+    };
+    gfx_area_t clip_area;
+
+    if (!gfx_area_intersect_exclusive(&clip_area, &ctx->clip_area, &obj_area)) {
+        return;
+    }
+
+    size_t src_ofs = (size_t)(clip_area.y1 - obj_area.y1) * obj->cache.width + (size_t)(clip_area.x1 - obj_area.x1);
+    gfx_sw_blend_img_draw(GFX_DRAW_CTX_DEST_PTR(ctx, clip_area.x1, clip_area.y1), ctx->stride,
+                          obj->cache.buf + src_ofs, obj->cache.width,
+                          obj->cache.mask ? obj->cache.mask + src_ofs : NULL, obj->cache.width,
+                          &clip_area, ctx->swap);
+}
+
+#if GFX_RENDER_OBJ_PERF
+/**
+ * Stripe workers draw the same object concurrently, so counters are bumped
+ * atomically; each stripe counts its own call, time and covered pixels.
+ */
+static void gfx_render_obj_perf_add(gfx_perf_counter_t *counter, uint64_t pixels, int64_t start_us)
+{
+    uint64_t elapsed_us = (uint64_t)(esp_timer_get_time() - start_us);
+
+    __atomic_fetch_add(&counter->calls, 1U, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&counter->pixels, pixels, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&counter->time_us, elapsed_us, __ATOMIC_RELAXED);
+}
+#endif
+
+static void gfx_render_draw_obj(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
+{
+#if GFX_RENDER_OBJ_PERF
+    int64_t start_us = esp_timer_get_time();
+    gfx_area_t obj_area = {
+        obj->geometry.x, obj->geometry.y,
+        obj->geometry.x + obj->geometry.width, obj->geometry.y + obj->geometry.height
+    };
+    gfx_area_t covered;
+    uint64_t pixels = 0;
+
+    if (gfx_area_intersect_exclusive(&covered, &ctx->clip_area, &obj_area)) {
+        pixels = (uint64_t)(covered.x2 - covered.x1) * (uint64_t)(covered.y2 - covered.y1);
+    }
+    gfx_render_draw_obj_content(obj, ctx);
+    gfx_render_obj_perf_add(&obj->perf.draw, pixels, start_us);
+#else
+    gfx_render_draw_obj_content(obj, ctx);
+#endif
+}
+
+static void gfx_render_update_obj(gfx_obj_t *obj)
+{
+#if GFX_RENDER_OBJ_PERF
+    int64_t start_us = esp_timer_get_time();
+#endif
+
+    if (obj->vfunc.update) {
+        GFX_TRACE_BEGIN(obj->trace.class_name, obj->trace.create_seq);
+        obj->vfunc.update(obj);
+        GFX_TRACE_END(obj->trace.class_name);
+    }
+    if (obj->cache.enabled && !obj->cache.valid) {
+        gfx_render_cache_build(obj);
+    }
+
+#if GFX_RENDER_OBJ_PERF
+    if (obj->vfunc.update || obj->cache.enabled) {
+        gfx_render_obj_perf_add(&obj->perf.update, 0, start_us);
+    }
+#endif
+}
+
+/** Draw the visible children of parent (NULL = top level) in list order, descending into containers */
+static void gfx_render_draw_subtree(gfx_disp_t *disp, const gfx_obj_t *parent, const gfx_draw_ctx_t *ctx)
+{
+    for (uint16_t i = 0; i < disp->children.count; i++) {
+        gfx_obj_t *obj = disp->children.objs[i];
+
+        if (obj->parent != parent || !obj->state.is_visible || obj->vfunc.draw == NULL) {
+            continue;
+        }
+
+        gfx_render_draw_obj(obj, ctx);
+        if (obj->type != GFX_OBJ_TYPE_CONTAINER) {
+            continue;
+        }
+
+        gfx_draw_ctx_t child_ctx = *ctx;
+        gfx_area_t bounds = {
+            obj->geometry.x, obj->geometry.y,
+            obj->geometry.x + (gfx_coord_t)obj->geometry.width, obj->geometry.y + (gfx_coord_t)obj->geometry.height
+        };
+        if (gfx_area_intersect_exclusive(&child_ctx.clip_area, &ctx->clip_area, &bounds)) {
+            gfx_render_draw_subtree(disp, obj, &child_ctx);
+        }
+    }
+}
+
+static bool gfx_render_ancestors_visible(const gfx_obj_t *obj)
+{
+    for (const gfx_obj_t *p = obj->parent; p != NULL; p = p->parent) {
+        if (!p->state.is_visible) {
+            return false;
+        }
+    }
+    return true;
+}
+
 /**********************
  *   PUBLIC FUNCTIONS
  **********************/
 
 void gfx_render_draw_child_objects(gfx_disp_t *disp, const gfx_draw_ctx_t *ctx)
 {
-    if (disp == NULL || disp->child_list == NULL || ctx == NULL) {
+    if (disp == NULL || ctx == NULL) {
+        return;
+    }
+
+    gfx_render_draw_subtree(disp, NULL, ctx);
+}
+
+
+void gfx_render_draw_binned_objects(gfx_disp_t *disp, const gfx_draw_ctx_t *ctx, uint16_t first)
+{
+    if (disp == NULL || ctx == NULL) {
+        return;
+    }
+
+    if (!disp->bin.valid) {
+        gfx_render_draw_child_objects(disp, ctx);
         return;
     }
 
-    gfx_obj_child_t *child_node = disp->child_list;
+    const gfx_area_t *clip = &ctx->clip_area;
 
-    while (child_node != NULL) {
-        gfx_obj_t *obj = (gfx_obj_t *)child_node->src;
+    for (uint16_t i = first; i < disp->bin.area_count; i++) {
+        uint16_t slot = disp->bin.area_list[i];
+        const gfx_area_t *b = &disp->bin.bounds[slot];
 
-        if (!obj->state.is_visible) {
-            child_node = child_node->next;
+        if (b->y1 >= clip->y2 || b->y2 <= clip->y1 || b->x1 >= clip->x2 || b->x2 <= clip->x1) {
             continue;
         }
+        if (disp->bin.flags[slot] & GFX_RENDER_BIN_CLIPPED) {
+            gfx_draw_ctx_t child_ctx = *ctx;
 
-        if (obj->vfunc.draw) {
-            obj->vfunc.draw(obj, ctx);
+            gfx_area_intersect_exclusive(&child_ctx.clip_area, clip, b);
+            gfx_render_draw_obj(disp->bin.objs[slot], &child_ctx);
+            continue;
         }
-
-        child_node = child_node->next;
+        gfx_render_draw_obj(disp->bin.objs[slot], ctx);
     }
 }
 
+void gfx_render_bin_free(gfx_disp_t *disp)
+{
+    if (disp == NULL) {
+        return;
+    }
+
+    free(disp->bin.objs);
+    memset(&disp->bin, 0, sizeof(disp->bin));
+}
 
 void gfx_render_update_child_objects(gfx_disp_t *disp)
 {
-    if (disp == NULL || disp->child_list == NULL) {
+    if (disp == NULL) {
         return;
     }
 
-    gfx_obj_child_t *child_node = disp->child_list;
+    for (uint16_t i = 0; i < disp->children.count; i++) {
+        gfx_obj_t *obj = disp->children.objs[i];
 
-    while (child_node != NULL) {
-        gfx_obj_t *obj = (gfx_obj_t *)child_node->src;
-
-        if (!obj->state.is_visible) {
-            child_node = child_node->next;
+        if (!obj->state.is_visible || !gfx_render_ancestors_visible(obj)) {
             continue;
         }
 
-        if (obj->vfunc.update) {
-            obj->vfunc.update(obj);
-        }
-
-        child_node = child_node->next;
+        gfx_render_update_obj(obj);
     }
 }
 
@@ -179,17 +757,25 @@ void gfx_render_part_area(gfx_disp_t *disp, gfx_area_t *area, uint8_t area_idx,
         return;
     }
 
+    bool pipelined = (flush_cb != NULL) && gfx_render_can_pipeline(disp);
+
+    if (disp->bin.valid) {
+        gfx_render_bin_select_area(disp, area);
+    }
+
     disp->render.flushing_last = false;
     gfx_coord_t cur_y = area->y1;
 
     while (cur_y <= area->y2) {
         int64_t render_start_us;
-        int64_t flush_start_us;
+        int64_t render_end_us;
+        uint64_t chunk_render_us;
+        uint32_t chunk_px;
 
         gfx_coord_t chunk_x1 = area->x1;
         gfx_coord_t chunk_y1 = cur_y;
         gfx_coord_t chunk_x2 = area->x2 + 1;
-        gfx_coord_t chunk_y2 = cur_y + (gfx_coord_t)row_h;
+        gfx_coord_t chunk_y2 = cur_y + (gfx_coord_t)gfx_render_next_chunk_rows(disp, area_w, row_h, pipelined);
         if (chunk_y2 > area->y2 + 1) {
             chunk_y2 = area->y2 + 1;
         }
@@ -219,8 +805,12 @@ void gfx_render_part_area(gfx_disp_t *disp, gfx_area_t *area, uint8_t area_idx,
             .swap = disp->flags.swap,
         };
 
+        uint16_t first_obj = 0;
+        bool occluded = gfx_render_bin_find_occluder(disp, &draw_ctx.clip_area, &first_obj);
+
+        GFX_TRACE_BEGIN("chunk", chunk_y2 - chunk_y1);
         render_start_us = esp_timer_get_time();
-        if (disp->style.bg_enable) {
+        if (disp->style.bg_enable && !occluded) {
             uint16_t bg = gfx_color_to_native_u16(disp->style.bg_color, disp->flags.swap);
             if (disp->flags.full_frame) {
                 gfx_area_t fill_area = { chunk_x1, chunk_y1, chunk_x2, chunk_y2 };  /* exclusive x2,y2 */
@@ -230,14 +820,23 @@ void gfx_render_part_area(gfx_disp_t *disp, gfx_area_t *area, uint8_t area_idx,
                 gfx_sw_blend_fill_area(buf, chunk_x2 - chunk_x1, &fill_area, bg);
             }
         }
-        gfx_render_draw_child_objects(disp, &draw_ctx);
-        disp->render.render_time_us += (uint64_t)(esp_timer_get_time() - render_start_us);
+        gfx_render_stripe_draw(disp, &draw_ctx, first_obj);
+        render_end_us = esp_timer_get_time();
+        chunk_render_us = (uint64_t)(render_end_us - render_start_us);
+        GFX_TRACE_END("chunk");
+        disp->render.render_time_us += chunk_render_us;
+        chunk_px = area_w * (uint32_t)(chunk_y2 - chunk_y1);
+        gfx_render_cost_update(&disp->render.render_ns_per_px, chunk_render_us, chunk_px);
+        disp->render.chunk_px_last = chunk_px;
+        if (disp->render.flush_inflight) {
+            disp->render.overlap_time_us += gfx_render_flush_overlap_us(disp, render_start_us, render_end_us);
+        }
 
         if (flush_cb != NULL) {
+            /* Only one transfer may be in flight: the next flush reuses the event bit */
+            gfx_render_wait_flush(disp);
             xEventGroupClearBits(disp->sync.event_group, WAIT_FLUSH_DONE);
 
-            // uint32_t chunk_px = area_w * (uint32_t)(chunk_y2 - chunk_y1);
-
             bool is_last_chunk = (chunk_y2 >= area->y2 + 1);
             disp->render.flushing_last = is_last_chunk && is_last_area;
 
@@ -245,12 +844,16 @@ void gfx_render_part_area(gfx_disp_t *disp, gfx_area_t *area, uint8_t area_idx,
             //          chunk_x1, chunk_y1, chunk_x2 - 1, chunk_y2 - 1, chunk_px,
             //          disp->render.flushing_last ? " (last)" : "");
 
-            flush_start_us = esp_timer_get_time();
+            disp->render.flush_start_us = esp_timer_get_time();
+            disp->render.flush_px = chunk_px;
+            disp->render.flush_inflight = true;
+            GFX_TRACE_BEGIN("flush_cb", chunk_px);
             flush_cb(disp, chunk_x1, chunk_y1, chunk_x2, chunk_y2, buf);
+            GFX_TRACE_END("flush_cb");
 
-            xEventGroupWaitBits(disp->sync.event_group, WAIT_FLUSH_DONE, pdTRUE, pdFALSE, portMAX_DELAY);
-            disp->render.flush_time_us += (uint64_t)(esp_timer_get_time() - flush_start_us);
-            disp->render.flush_count++;
+            if (!pipelined) {
+                gfx_render_wait_flush(disp);
+            }
 
             if (disp->buf.buf2 != NULL && (!disp->flags.full_frame || disp->render.flushing_last)) {
                 disp->buf.buf_act = (disp->buf.buf_act == disp->buf.buf1) ? disp->buf.buf2 : disp->buf.buf1;
@@ -273,11 +876,17 @@ void gfx_render_dirty_areas(gfx_disp_t *disp)
 
     disp->render.render_time_us = 0;
     disp->render.flush_time_us = 0;
+    disp->render.flush_wait_us = 0;
     disp->render.flush_count = 0;
+    disp->render.overlap_time_us = 0;
+    disp->render.chunk_px_last = 0;
     gfx_sw_blend_perf_reset(&disp->render.blend);
     gfx_sw_blend_perf_bind(&disp->render.blend);
+    gfx_sw_blend_scratch_bind(&disp->render.scratch);
 
     gfx_render_sync_dirty_areas(disp);
+    gfx_render_move_blit(disp);
+    gfx_render_bin_build(disp);
 
     uint8_t last_area_idx = 0;
     for (uint8_t i = 0; i < disp->dirty.count; i++) {
@@ -294,9 +903,19 @@ void gfx_render_dirty_areas(gfx_disp_t *disp)
         gfx_area_t *area = &disp->dirty.areas[i];
         bool is_last_area = (i == last_area_idx);
         gfx_render_part_area(disp, area, i, is_last_area);
-        sync_points++;
         gfx_area_copy(&disp->sync_pending.areas[sync_points], area);
+        sync_points++;
     }
+    /* Blitted rects changed too; the other buffer has to catch up with them */
+    for (uint8_t i = 0; i < disp->move.blit_count; i++) {
+        gfx_area_copy(&disp->sync_pending.areas[sync_points], &disp->move.blit_dst[i]);
+        sync_points++;
+    }
+    disp->move.blit_count = 0;
+    /* Drain the last pipelined flush so no transfer outlives the frame */
+    gfx_render_wait_flush(disp);
+    disp->bin.valid = false;
+    gfx_sw_blend_scratch_bind(NULL);
     gfx_sw_blend_perf_unbind();
     disp->sync_pending.count = sync_points;
 }
@@ -323,25 +942,20 @@ void gfx_render_cleanup(gfx_disp_t *disp)
  */
 bool gfx_render_handler(gfx_core_context_t *ctx)
 {
-    static const uint32_t fps_sample_window = 100;
-    static uint32_t fps_samples = 0;
-    static uint32_t fps_elapsed_ms = 0;
-    static uint32_t last_tick_ms = 0;
-
-    uint32_t now_ms = gfx_timer_tick_get();
-    if (last_tick_ms == 0) {
-        last_tick_ms = now_ms;
-    } else {
-        uint32_t elapsed_ms = gfx_timer_tick_elaps(last_tick_ms);
-        fps_samples++;
-        fps_elapsed_ms += elapsed_ms;
-        last_tick_ms = now_ms;
+    gfx_timer_mgr_t *mgr = &ctx->timer_mgr;
+    uint32_t now_ms = gfx_timer_mgr_tick_get(mgr);
 
-        if (fps_samples >= fps_sample_window) {
-            gfx_timer_mgr_t *mgr = &ctx->timer_mgr;
-            mgr->actual_fps = (fps_samples * 1000) / fps_elapsed_ms;
-            fps_samples = 0;
-            fps_elapsed_ms = 0;
+    if (mgr->fps_last_tick == 0) {
+        mgr->fps_last_tick = now_ms;
+    } else {
+        mgr->fps_samples++;
+        mgr->fps_elapsed_ms += gfx_timer_tick_elaps(mgr, mgr->fps_last_tick);
+        mgr->fps_last_tick = now_ms;
+
+        if (mgr->fps_samples >= GFX_TIMER_FPS_SAMPLE_WINDOW && mgr->fps_elapsed_ms > 0) {
+            mgr->actual_fps = (mgr->fps_samples * 1000) / mgr->fps_elapsed_ms;
+            mgr->fps_samples = 0;
+            mgr->fps_elapsed_ms = 0;
         }
     }
 
@@ -349,21 +963,44 @@ bool gfx_render_handler(gfx_core_context_t *ctx)
 
     for (gfx_disp_t *disp = ctx->disp; disp != NULL; disp = disp->next) {
         int64_t frame_start_us = esp_timer_get_time();
+        GFX_TRACE_BEGIN("layout", 0);
         gfx_refr_update_layout_dirty(disp);
+        GFX_TRACE_END("layout");
 
-        if (disp->dirty.count > 1) {
-            gfx_refr_merge_areas(disp);
-        } else if (disp->dirty.count == 0) {
+        if (disp->dirty.count == 0 && !disp->dirty.tiles_any) {
+            /* Close the frame so move tracking does not carry over */
+            gfx_invalidate_area_disp(disp, NULL);
             continue;
+        } else if (disp->dirty.count > 1 && disp->dirty.tiles == NULL) {
+            gfx_refr_merge_areas(disp);
         }
 
+        GFX_TRACE_BEGIN("frame", disp->dirty.count);
         gfx_render_update_child_objects(disp);
+        /*
+         * Build the tile bands once, after the update callbacks have marked
+         * their tiles too; bands from one pass are disjoint, two passes
+         * over the same frame would overlap.
+         */
+        gfx_refr_collect_dirty_tiles(disp);
+        gfx_refr_resolve_moves(disp);
 
         uint32_t dirty_px = gfx_render_area_summary(disp);
         gfx_render_dirty_areas(disp);
-        uint64_t frame_time_us = (uint64_t)(esp_timer_get_time() - frame_start_us);
+        GFX_TRACE_END("frame");
+        int64_t present_us = esp_timer_get_time();
+        uint64_t frame_time_us = (uint64_t)(present_us - frame_start_us);
+        disp->render.frame_count++;
         disp->render.dirty_pixels = dirty_px;
         disp->render.frame_time_us = frame_time_us;
+#if GFX_DISP_PERF_HIST
+        gfx_perf_hist_record(&disp->hist.frame, frame_time_us);
+        gfx_perf_hist_record(&disp->hist.render, disp->render.render_time_us);
+        gfx_perf_hist_record(&disp->hist.flush, disp->render.flush_time_us);
+        if (disp->dirty.first_inv_us != 0 && present_us >= disp->dirty.first_inv_us) {
+            gfx_perf_hist_record(&disp->hist.latency, (uint64_t)(present_us - disp->dirty.first_inv_us));
+        }
+#endif
 
         if (dirty_px > 0) {
             did_render = true;
@@ -48,6 +48,18 @@ uint32_t gfx_render_area_summary(gfx_disp_t *disp);
  */
 void gfx_render_draw_child_objects(gfx_disp_t *disp, const gfx_draw_ctx_t *ctx);
 
+/**
+ * @brief Draw only the objects binned for the current dirty area that intersect ctx->clip_area
+ * @param first Index into the area bin to start from; objects below it are occluded
+ * @note Falls back to gfx_render_draw_child_objects() when no bin is available
+ */
+void gfx_render_draw_binned_objects(gfx_disp_t *disp, const gfx_draw_ctx_t *ctx, uint16_t first);
+
+/**
+ * @brief Release per-frame object bin storage of one display
+ */
+void gfx_render_bin_free(gfx_disp_t *disp);
+
 /**
  * @brief Update child objects for one display
  */
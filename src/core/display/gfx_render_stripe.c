@@ -0,0 +1,249 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "esp_check.h"
+#include "esp_heap_caps.h"
+#define GFX_LOG_MODULE GFX_LOG_MODULE_RENDER
+#include "common/gfx_log_priv.h"
+
+#include "common/gfx_config_internal.h"
+#include "core/display/gfx_render_priv.h"
+#include "core/display/gfx_render_stripe_priv.h"
+#include "core/draw/gfx_blend_priv.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define GFX_RENDER_STRIPE_MAX_WORKERS   ((GFX_RENDER_STRIPE_WORKERS > 0) ? GFX_RENDER_STRIPE_WORKERS : 1)
+#define GFX_RENDER_STRIPE_START_BIT(i)  ((EventBits_t)1 << (i))
+#define GFX_RENDER_STRIPE_DONE_BIT(i)   ((EventBits_t)1 << (8 + (i)))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+struct gfx_render_stripe_pool;
+
+/** One worker's share of the current chunk */
+typedef struct {
+    struct gfx_render_stripe_pool *pool;
+    uint8_t index;
+    gfx_disp_t *disp;
+    gfx_draw_ctx_t draw_ctx;            /**< Chunk ctx with clip_area narrowed to the stripe rows */
+    uint16_t first;
+    gfx_blend_perf_stats_t blend;       /**< Worker-local blend stats, merged after the join */
+    gfx_blend_scratch_t scratch;        /**< Worker-local polygon scratch, kept across frames */
+} gfx_render_stripe_job_t;
+
+typedef struct gfx_render_stripe_pool {
+    EventGroupHandle_t events;          /**< START_BIT(i) wakes worker i, DONE_BIT(i) joins it */
+    uint8_t worker_count;
+    volatile bool exit;
+    gfx_render_stripe_job_t jobs[GFX_RENDER_STRIPE_MAX_WORKERS];
+} gfx_render_stripe_pool_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const char *TAG = "render_stripe";
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void gfx_render_stripe_worker(void *arg);
+static void gfx_render_stripe_stop(gfx_render_stripe_pool_t *pool);
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void gfx_render_stripe_worker(void *arg)
+{
+    gfx_render_stripe_job_t *job = (gfx_render_stripe_job_t *)arg;
+    gfx_render_stripe_pool_t *pool = job->pool;
+    EventBits_t start_bit = GFX_RENDER_STRIPE_START_BIT(job->index);
+    EventBits_t done_bit = GFX_RENDER_STRIPE_DONE_BIT(job->index);
+
+    for (;;) {
+        xEventGroupWaitBits(pool->events, start_bit, pdTRUE, pdFALSE, portMAX_DELAY);
+        if (pool->exit) {
+            break;
+        }
+
+        gfx_sw_blend_perf_reset(&job->blend);
+        gfx_sw_blend_perf_bind(&job->blend);
+        gfx_sw_blend_scratch_bind(&job->scratch);
+        gfx_render_draw_binned_objects(job->disp, &job->draw_ctx, job->first);
+        gfx_sw_blend_scratch_bind(NULL);
+        gfx_sw_blend_perf_unbind();
+
+        xEventGroupSetBits(pool->events, done_bit);
+    }
+
+    xEventGroupSetBits(pool->events, done_bit);
+    vTaskDeleteWithCaps(NULL);
+}
+
+/** Ask the first worker_count workers to exit, wait for them and free the pool */
+static void gfx_render_stripe_stop(gfx_render_stripe_pool_t *pool)
+{
+    EventBits_t start_bits = 0;
+    EventBits_t done_bits = 0;
+
+    for (uint8_t i = 0; i < pool->worker_count; i++) {
+        start_bits |= GFX_RENDER_STRIPE_START_BIT(i);
+        done_bits |= GFX_RENDER_STRIPE_DONE_BIT(i);
+    }
+
+    if (done_bits != 0) {
+        pool->exit = true;
+        xEventGroupSetBits(pool->events, start_bits);
+        xEventGroupWaitBits(pool->events, done_bits, pdTRUE, pdTRUE, portMAX_DELAY);
+    }
+
+    if (pool->events != NULL) {
+        vEventGroupDelete(pool->events);
+    }
+    for (uint8_t i = 0; i < GFX_RENDER_STRIPE_MAX_WORKERS; i++) {
+        gfx_sw_blend_scratch_free(&pool->jobs[i].scratch);
+    }
+    free(pool);
+}
+
+/**********************
+ *   PUBLIC FUNCTIONS
+ **********************/
+
+esp_err_t gfx_render_stripe_init(gfx_core_context_t *ctx, const gfx_core_config_t *cfg)
+{
+    ESP_RETURN_ON_FALSE(ctx != NULL && cfg != NULL, ESP_ERR_INVALID_ARG, TAG, "init stripes: invalid argument");
+
+    ctx->stripes = NULL;
+    if (GFX_RENDER_STRIPE_WORKERS <= 0) {
+        return ESP_OK;
+    }
+    if (portNUM_PROCESSORS < 2) {
+        GFX_LOGI(TAG, "init stripes: single-core target, stripe workers disabled");
+        return ESP_OK;
+    }
+
+    gfx_render_stripe_pool_t *pool = calloc(1, sizeof(gfx_render_stripe_pool_t));
+    ESP_RETURN_ON_FALSE(pool != NULL, ESP_ERR_NO_MEM, TAG, "init stripes: no mem for pool");
+
+    pool->events = xEventGroupCreate();
+    if (pool->events == NULL) {
+        free(pool);
+        GFX_LOGE(TAG, "init stripes: failed to create event group");
+        return ESP_ERR_NO_MEM;
+    }
+
+    const uint32_t stack_caps = cfg->task.task_stack_caps ? cfg->task.task_stack_caps : (MALLOC_CAP_INTERNAL | MALLOC_CAP_DEFAULT);
+    for (uint8_t i = 0; i < GFX_RENDER_STRIPE_WORKERS; i++) {
+        gfx_render_stripe_job_t *job = &pool->jobs[i];
+        char name[configMAX_TASK_NAME_LEN];
+        BaseType_t task_ret;
+
+        job->pool = pool;
+        job->index = i;
+        snprintf(name, sizeof(name), "gfx_stripe%u", (unsigned)i);
+
+        if (cfg->task.task_affinity < 0) {
+            task_ret = xTaskCreateWithCaps(gfx_render_stripe_worker, name, cfg->task.task_stack,
+                                           job, cfg->task.task_priority, NULL, stack_caps);
+        } else {
+            /* Keep the render task's core for the last stripe; spread workers over the others */
+            BaseType_t core = (cfg->task.task_affinity + 1 + i) % portNUM_PROCESSORS;
+            task_ret = xTaskCreatePinnedToCoreWithCaps(gfx_render_stripe_worker, name, cfg->task.task_stack,
+                       job, cfg->task.task_priority, NULL, core, stack_caps);
+        }
+        if (task_ret != pdPASS) {
+            GFX_LOGE(TAG, "init stripes: failed to create worker %u", (unsigned)i);
+            gfx_render_stripe_stop(pool);
+            return ESP_ERR_NO_MEM;
+        }
+        pool->worker_count++;
+    }
+
+    ctx->stripes = pool;
+    GFX_LOGI(TAG, "init stripes: %u workers, min %d rows per stripe",
+             (unsigned)pool->worker_count, GFX_RENDER_STRIPE_MIN_ROWS);
+    return ESP_OK;
+}
+
+void gfx_render_stripe_deinit(gfx_core_context_t *ctx)
+{
+    if (ctx == NULL || ctx->stripes == NULL) {
+        return;
+    }
+
+    gfx_render_stripe_stop(ctx->stripes);
+    ctx->stripes = NULL;
+}
+
+void gfx_render_stripe_draw(gfx_disp_t *disp, const gfx_draw_ctx_t *ctx, uint16_t first)
+{
+    gfx_render_stripe_pool_t *pool = (disp != NULL && disp->ctx != NULL) ? disp->ctx->stripes : NULL;
+    uint32_t stripes;
+    int32_t rows;
+
+    if (pool == NULL || ctx == NULL) {
+        gfx_render_draw_binned_objects(disp, ctx, first);
+        return;
+    }
+
+    rows = ctx->clip_area.y2 - ctx->clip_area.y1;
+    stripes = (uint32_t)pool->worker_count + 1U;
+    if (rows < (int32_t)(stripes * GFX_RENDER_STRIPE_MIN_ROWS)) {
+        stripes = (rows > 0) ? (uint32_t)rows / GFX_RENDER_STRIPE_MIN_ROWS : 0U;
+    }
+    if (stripes < 2U) {
+        gfx_render_draw_binned_objects(disp, ctx, first);
+        return;
+    }
+
+    /* Workers take the upper stripes; stripes share buf but never a row */
+    EventBits_t start_bits = 0;
+    EventBits_t done_bits = 0;
+    gfx_coord_t y1 = ctx->clip_area.y1;
+
+    for (uint32_t i = 0; i + 1U < stripes; i++) {
+        gfx_render_stripe_job_t *job = &pool->jobs[i];
+        gfx_coord_t y2 = ctx->clip_area.y1 + (gfx_coord_t)(((int64_t)rows * (i + 1U)) / stripes);
+
+        job->disp = disp;
+        job->draw_ctx = *ctx;
+        job->draw_ctx.clip_area.y1 = y1;
+        job->draw_ctx.clip_area.y2 = y2;
+        job->draw_ctx.stripe = (uint8_t)(i + 1U);
+        job->first = first;
+        start_bits |= GFX_RENDER_STRIPE_START_BIT(i);
+        done_bits |= GFX_RENDER_STRIPE_DONE_BIT(i);
+        y1 = y2;
+    }
+    xEventGroupSetBits(pool->events, start_bits);
+
+    gfx_draw_ctx_t last_ctx = *ctx;
+    last_ctx.clip_area.y1 = y1;
+    gfx_render_draw_binned_objects(disp, &last_ctx, first);
+
+    xEventGroupWaitBits(pool->events, done_bits, pdTRUE, pdTRUE, portMAX_DELAY);
+
+    for (uint32_t i = 0; i + 1U < stripes; i++) {
+        gfx_sw_blend_perf_merge(&disp->render.blend, &pool->jobs[i].blend);
+    }
+}
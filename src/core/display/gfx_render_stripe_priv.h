@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "core/runtime/gfx_core_priv.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Create the stripe worker pool (CONFIG_GFX_RENDER_STRIPE_WORKERS > 0)
+ *
+ * Workers inherit priority and stack settings from the render task and are
+ * pinned to the cores following task_affinity when it is set.
+ * @return ESP_OK (also when stripe workers are disabled), ESP_ERR_NO_MEM on failure
+ */
+esp_err_t gfx_render_stripe_init(gfx_core_context_t *ctx, const gfx_core_config_t *cfg);
+
+/**
+ * @brief Stop and free the stripe worker pool
+ */
+void gfx_render_stripe_deinit(gfx_core_context_t *ctx);
+
+/**
+ * @brief Draw binned objects for one chunk, split into horizontal stripes
+ *
+ * The chunk clip_area is cut into one stripe per worker plus one for the
+ * calling task; all stripes are joined before returning. Chunks shorter than
+ * two GFX_RENDER_STRIPE_MIN_ROWS stripes are drawn on the calling task only.
+ * @param first Index into the area bin to start from (see gfx_render_draw_binned_objects)
+ */
+void gfx_render_stripe_draw(gfx_disp_t *disp, const gfx_draw_ctx_t *ctx, uint16_t first);
+
+#ifdef __cplusplus
+}
+#endif
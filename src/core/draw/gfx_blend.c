@@ -18,29 +18,100 @@
 #include "common/gfx_config_internal.h"
 #include "common/gfx_mesh_frac.h"
 #include "core/draw/gfx_blend_priv.h"
+#include "core/draw/gfx_blend_backend_priv.h"
 
 /*********************
  *      DEFINES
  *********************/
 
-#define OPA_MAX      253  /*Opacities above this will fully cover*/
-#define OPA_TRANSP   0
-#define OPA_COVER    0xFF
+#define OPA_MAX      GFX_BLEND_OPA_MAX  /*Opacities above this will fully cover*/
+#define OPA_COVER    GFX_BLEND_OPA_COVER
 
-#define FILL_NORMAL_MASK_PX(color, swap)                              \
-    if(*mask == OPA_COVER) *dest_buf = color;                \
-    else *dest_buf = gfx_blend_color_mix(color, *dest_buf, *mask, swap);     \
-    mask++;                                                     \
-    dest_buf++;
+#define TRI_FRAC_BITS       16  /* UV fixed point: sufficient for sub-1024px textures */
+#define TRI_FRAC_HALF       (1 << (TRI_FRAC_BITS - 1))
+#define TRI_BLOCK           8   /* Rasterizer block edge in pixels */
+#define TRI_BLOCK_GROUP     32  /* Blocks classified at once along a block row */
+
+#define POLY_FRAC           GFX_MESH_FRAC_SHIFT
+#define POLY_ONE            GFX_MESH_FRAC_ONE
+#define POLY_AREA_FULL      (2 * POLY_ONE * POLY_ONE)  /* Accumulated area of a fully covered pixel */
+#define POLY_STACK_EDGES    48  /* Polygons with up to this many edges ... */
+#define POLY_STACK_WIDTH    192 /* ... and rows up to this wide rasterize from stack scratch */
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef enum {
+    GFX_SW_BLEND_TRI_BLOCK_SKIP,    /* Nothing in the block is drawn */
+    GFX_SW_BLEND_TRI_BLOCK_ACCEPT,  /* Fully inside and clear of every AA band */
+    GFX_SW_BLEND_TRI_BLOCK_EDGE,    /* Needs the per-pixel test */
+} gfx_sw_blend_tri_block_t;
+
+/* Rasterizer values at one pixel centre */
+typedef struct {
+    int64_t w0;
+    int64_t w1;
+    int32_t u;
+    int32_t v;
+    int64_t xaa[GFX_BLEND_MAX_EXTRA_AA_EDGES];
+} gfx_sw_blend_tri_px_t;
+
+/* Per-triangle setup shared by block classification and the edge path */
+typedef struct {
+    const gfx_blend_backend_t *backend;
+    gfx_blend_tex_t tex;
+    int64_t area_2x;
+    int64_t step_x[3];          /* Edge function deltas per pixel (w0, w1, w2) */
+    int64_t step_y[3];
+    int32_t len[3];
+    int32_t du_dx, dv_dx, du_dy, dv_dy;
+    int32_t x0, y0;             /* Pixel the origin values below belong to */
+    gfx_sw_blend_tri_px_t org;
+    const gfx_sw_blend_aa_edge_t *xaa_edges;
+    int64_t xaa_sx[GFX_BLEND_MAX_EXTRA_AA_EDGES];
+    int64_t xaa_sy[GFX_BLEND_MAX_EXTRA_AA_EDGES];
+    uint8_t xaa_n;
+    uint8_t internal_edges;
+    bool inward;
+    gfx_opa_t opa;
+    bool swap;
+} gfx_sw_blend_tri_t;
+
+/* Polygon edge oriented top to bottom; dir is -1 when the source edge pointed up */
+typedef struct {
+    int32_t x0, y0;
+    int32_t x1, y1;
+    int32_t dir;
+} gfx_sw_blend_poly_edge_t;
+
+/* Polygon row accumulator: acc[i] belongs to the i-th pixel of the row */
+typedef struct {
+    int32_t *acc;
+    int32_t w;                  /* Pixels in the row; acc holds w + 2 cells */
+    int32_t cmin, cmax;         /* Cells touched since the last flush */
+} gfx_sw_blend_poly_row_t;
+
 /**********************
  *  STATIC VARIABLES
  **********************/
-static gfx_blend_perf_stats_t *s_active_perf_stats = NULL;
+/* Per task: stripe workers bind their own stats while blending in parallel */
+static __thread gfx_blend_perf_stats_t *s_active_perf_stats = NULL;
+/* Per task as well: each stripe worker grows its own polygon scratch */
+static __thread gfx_blend_scratch_t *s_active_scratch = NULL;
+
+/* Scalar first: it is the reference the others are checked against. The last one is the default */
+static const gfx_blend_backend_t *const s_blend_backends[] = {
+    &gfx_blend_backend_scalar,
+    &gfx_blend_backend_swar,
+#if GFX_BLEND_VECTOR
+    &gfx_blend_backend_vector,
+#endif
+};
+
+#define BLEND_BACKEND_DEFAULT (s_blend_backends[sizeof(s_blend_backends) / sizeof(s_blend_backends[0]) - 1])
+
+static const gfx_blend_backend_t *s_blend_backend = BLEND_BACKEND_DEFAULT;
 
 /**********************
  *   STATIC FUNCTIONS
@@ -115,259 +186,619 @@ static inline bool gfx_sw_blend_triangle_sample_inside(int64_t area_2x,
     return (w0 <= 0) && (w1 <= 0) && (w2 <= 0);
 }
 
-static inline uint64_t gfx_blend_perf_elapsed_us(int64_t start_us)
+/*
+ * Values at pixel (x, y), derived from the origin rather than stepped so any
+ * block can start anywhere. UV wraps exactly like the per-pixel adds did.
+ */
+static inline void gfx_sw_blend_tri_eval(const gfx_sw_blend_tri_t *t, int32_t x, int32_t y,
+        gfx_sw_blend_tri_px_t *px)
 {
-    return (uint64_t)(esp_timer_get_time() - start_us);
+    int64_t dx = x - t->x0;
+    int64_t dy = y - t->y0;
+
+    px->w0 = t->org.w0 + dx * t->step_x[0] + dy * t->step_y[0];
+    px->w1 = t->org.w1 + dx * t->step_x[1] + dy * t->step_y[1];
+    px->u = (int32_t)((uint32_t)t->org.u + (uint32_t)dx * (uint32_t)t->du_dx + (uint32_t)dy * (uint32_t)t->du_dy);
+    px->v = (int32_t)((uint32_t)t->org.v + (uint32_t)dx * (uint32_t)t->dv_dx + (uint32_t)dy * (uint32_t)t->dv_dy);
+    for (uint8_t ei = 0; ei < t->xaa_n; ei++) {
+        px->xaa[ei] = t->org.xaa[ei] + dx * t->xaa_sx[ei] + dy * t->xaa_sy[ei];
+    }
 }
 
-static void gfx_sw_blend_polygon_fill_scanline_fallback(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
-        const gfx_area_t *buf_area, const gfx_area_t *clip_area,
-        gfx_color_t color,
-        gfx_opa_t opa,
-        const int32_t *vx, const int32_t *vy,
-        int vertex_count,
-        bool swap)
+/*
+ * Classify a bw x bh block whose top-left pixel holds px. Edge functions are
+ * linear, so their extremes over the block sit at its corners. Signs are
+ * normalised so that >= 0 means inside for either winding.
+ */
+static gfx_sw_blend_tri_block_t gfx_sw_blend_tri_classify(const gfx_sw_blend_tri_t *t,
+        const gfx_sw_blend_tri_px_t *px, int32_t bw, int32_t bh)
 {
-#define POLY_FRAC   GFX_MESH_FRAC_SHIFT
-#define POLY_ONE    GFX_MESH_FRAC_ONE
-#define POLY_HALF   GFX_MESH_FRAC_HALF
-#define POLY_MASK   GFX_MESH_FRAC_MASK
-#define POLY_MAX_IX GFX_BLEND_POLYGON_MAX_INTERSECTIONS
-#define POLY_SUB_SAMPLES GFX_BLEND_POLYGON_SUB_SAMPLES
-#define POLY_COV_MAX_W   GFX_BLEND_POLYGON_COVERAGE_MAX_WIDTH
-
-    int32_t min_yq, max_yq, y_start, y_end;
-    int32_t x_clip_lo, x_clip_hi;
-    gfx_color_t fill;
-
-    if (opa == 0U) {
-        return;
-    }
-
-    fill = color;
-    if (swap) {
-        fill.full = (uint16_t)(fill.full << 8 | fill.full >> 8);
+    const int64_t sign = (t->area_2x > 0) ? 1 : -1;
+    const int64_t w[3] = { px->w0, px->w1, t->area_2x - px->w0 - px->w1 };
+    int64_t lo[3], hi[3];
+    bool all_inside = true;
+    bool any_outside = false;
+
+    for (int i = 0; i < 3; i++) {
+        int64_t ox = sign * t->step_x[i] * (bw - 1);
+        int64_t oy = sign * t->step_y[i] * (bh - 1);
+        lo[i] = sign * w[i] + MIN(ox, 0) + MIN(oy, 0);
+        hi[i] = sign * w[i] + MAX(ox, 0) + MAX(oy, 0);
+        all_inside = all_inside && lo[i] >= 0;
+        any_outside = any_outside || hi[i] < 0;
     }
 
-    min_yq = vy[0];
-    max_yq = vy[0];
-    for (int i = 1; i < vertex_count; i++) {
-        if (vy[i] < min_yq) {
-            min_yq = vy[i];
+    if (t->inward) {
+        /* Inward AA never touches outside pixels; inside ones fade near an outer edge */
+        if (any_outside) {
+            return GFX_SW_BLEND_TRI_BLOCK_SKIP;
         }
-        if (vy[i] > max_yq) {
-            max_yq = vy[i];
+        if (!all_inside) {
+            return GFX_SW_BLEND_TRI_BLOCK_EDGE;
         }
-    }
-
-    y_start = (min_yq >= 0) ? (min_yq >> POLY_FRAC) : -(((-min_yq) + POLY_MASK) >> POLY_FRAC);
-    y_end = (max_yq >= 0) ? ((max_yq + POLY_MASK) >> POLY_FRAC) : -((-max_yq) >> POLY_FRAC);
-
-    y_start = MAX(y_start, MAX(buf_area->y1, clip_area->y1));
-    y_end = MIN(y_end, MIN(buf_area->y2 - 1, clip_area->y2 - 1));
-    x_clip_lo = MAX(buf_area->x1, clip_area->x1);
-    x_clip_hi = MIN(buf_area->x2 - 1, clip_area->x2 - 1);
-
-    {
-        int32_t min_xq = vx[0], max_xq = vx[0];
-        for (int i = 1; i < vertex_count; i++) {
-            if (vx[i] < min_xq) {
-                min_xq = vx[i];
+        for (int i = 0; i < 3; i++) {
+            if (!(t->internal_edges & (1U << i)) && lo[i] < (int64_t)GFX_BLEND_TRI_EDGE_AA_RANGE * t->len[i]) {
+                return GFX_SW_BLEND_TRI_BLOCK_EDGE;
             }
-            if (vx[i] > max_xq) {
-                max_xq = vx[i];
+        }
+        for (uint8_t ei = 0; ei < t->xaa_n; ei++) {
+            int64_t ox = sign * t->xaa_sx[ei] * (bw - 1);
+            int64_t oy = sign * t->xaa_sy[ei] * (bh - 1);
+            if (sign * px->xaa[ei] + MIN(ox, 0) + MIN(oy, 0) <
+                    (int64_t)GFX_BLEND_TRI_EDGE_AA_RANGE * t->xaa_edges[ei].len) {
+                return GFX_SW_BLEND_TRI_BLOCK_EDGE;
             }
         }
+        return GFX_SW_BLEND_TRI_BLOCK_ACCEPT;
+    }
 
-        int32_t cov_full_x0 = (min_xq >= 0) ? (min_xq >> POLY_FRAC) : -(((-min_xq) + POLY_MASK) >> POLY_FRAC);
-        int32_t cov_full_x1 = (max_xq >= 0) ? ((max_xq + POLY_MASK) >> POLY_FRAC) : -((-max_xq) >> POLY_FRAC);
-        cov_full_x0 = MAX(cov_full_x0, x_clip_lo);
-        cov_full_x1 = MIN(cov_full_x1, x_clip_hi);
-        if (cov_full_x1 < cov_full_x0) {
-            return;
+    /* Outward AA: inside pixels are never faded, outside ones only near a non-internal edge */
+    if (all_inside) {
+        return GFX_SW_BLEND_TRI_BLOCK_ACCEPT;
+    }
+    bool far_outside = false;
+    bool outer_edges_clear = true;
+    for (int i = 0; i < 3; i++) {
+        if (t->internal_edges & (1U << i)) {
+            continue;
         }
+        if (-hi[i] >= (int64_t)GFX_BLEND_TRI_EDGE_AA_RANGE * t->len[i]) {
+            far_outside = true;
+        }
+        if (lo[i] < 0) {
+            outer_edges_clear = false;
+        }
+    }
+    if (far_outside || (any_outside && outer_edges_clear)) {
+        return GFX_SW_BLEND_TRI_BLOCK_SKIP;
+    }
+    return GFX_SW_BLEND_TRI_BLOCK_EDGE;
+}
 
-        uint16_t cov_buf[POLY_COV_MAX_W];
-
-        for (int32_t cov_x0 = cov_full_x0; cov_x0 <= cov_full_x1; cov_x0 += POLY_COV_MAX_W) {
-            int32_t cov_x1 = MIN(cov_x0 + POLY_COV_MAX_W - 1, cov_full_x1);
-            int32_t cov_w = cov_x1 - cov_x0 + 1;
-
-            for (int32_t y = y_start; y <= y_end; y++) {
-#if GFX_BLEND_POLYGON_INWARD_AA || GFX_BLEND_POLYGON_SOLID_HARD_EDGE
-                int32_t center_ix[POLY_MAX_IX];
-                int center_ic = 0;
-#endif
-                memset(cov_buf, 0, (size_t)cov_w * sizeof(uint16_t));
-
-#if GFX_BLEND_POLYGON_INWARD_AA || GFX_BLEND_POLYGON_SOLID_HARD_EDGE
-                /*
-                 * Keep AA inward-only: partially covered pixels whose centre lies
-                 * outside the polygon are not touched.  This avoids a bright/dark
-                 * "coat" caused by blending edge coverage with stale/background
-                 * pixels outside filled Bezier loops.
-                 */
-                {
-                    int32_t yc = y * POLY_ONE + POLY_HALF;
-                    for (int e = 0; e < vertex_count; e++) {
-                        int en = (e + 1 < vertex_count) ? e + 1 : 0;
-                        int32_t y1 = vy[e], y2 = vy[en];
-                        if ((y1 <= yc && y2 > yc) || (y2 <= yc && y1 > yc)) {
-                            int32_t dy = y2 - y1;
-                            int32_t xi = (int32_t)((int64_t)vx[e] + (int64_t)(yc - y1) * (vx[en] - vx[e]) / dy);
-                            if (center_ic < POLY_MAX_IX) {
-                                center_ix[center_ic++] = xi;
-                            }
+/* Per-pixel edge test and edge AA for pixels x..x_end of one row, px at x */
+static void gfx_sw_blend_tri_edge_run(const gfx_sw_blend_tri_t *t, gfx_color_t *dst_row,
+                                      int32_t x, int32_t x_end, gfx_sw_blend_tri_px_t px)
+{
+    const int64_t area_2x = t->area_2x;
+    const bool inward = t->inward;
+    const uint8_t internal_edges = t->internal_edges;
+    const gfx_color_t *src_buf = t->tex.buf;
+    const gfx_opa_t *mask = t->tex.mask;
+    const gfx_opa_t opa = t->opa;
+    const bool swap = t->swap;
+    int64_t w0 = px.w0;
+    int64_t w1 = px.w1;
+    int32_t u_cur = px.u;
+    int32_t v_cur = px.v;
+
+    for (; x <= x_end; x++) {
+        int64_t w2 = area_2x - w0 - w1;
+
+        if (!inward && gfx_sw_blend_triangle_sample_inside(area_2x, w0, w1, w2)) {
+            /* Interior run: no per-pixel AA, so the backend takes the whole span */
+            int32_t run = 1;
+            int64_t rw0 = w0 + t->step_x[0];
+            int64_t rw1 = w1 + t->step_x[1];
+            while (x + run <= x_end &&
+                    gfx_sw_blend_triangle_sample_inside(area_2x, rw0, rw1, area_2x - rw0 - rw1)) {
+                rw0 += t->step_x[0];
+                rw1 += t->step_x[1];
+                run++;
+            }
+            t->backend->tri_span(dst_row, run, &t->tex, u_cur, v_cur, t->du_dx, t->dv_dx, opa, swap);
+            w0 = rw0;
+            w1 = rw1;
+            u_cur += t->du_dx * run;
+            v_cur += t->dv_dx * run;
+            dst_row += run;
+            x += run - 1;
+            continue;
+        }
+        if (gfx_sw_blend_triangle_sample_inside(area_2x, w0, w1, w2)) {
+            /* Inside triangle */
+            int32_t src_x = (u_cur + TRI_FRAC_HALF) >> TRI_FRAC_BITS;
+            int32_t src_y = (v_cur + TRI_FRAC_HALF) >> TRI_FRAC_BITS;
+            src_x = gfx_sw_blend_clamp_coord(src_x, 0, t->tex.stride - 1);
+            src_y = gfx_sw_blend_clamp_coord(src_y, 0, t->tex.height - 1);
+            gfx_color_t src_color = src_buf[(size_t)src_y * t->tex.stride + (size_t)src_x];
+            gfx_opa_t final_opa = opa;
+
+            /* Inward AA: fade pixels near non-internal outer edges */
+            if (inward) {
+                int32_t min_id = GFX_BLEND_TRI_EDGE_AA_RANGE;
+                uint8_t emask = internal_edges & 0x07;
+                if (area_2x > 0) {
+                    if (!(emask & 0x01)) {
+                        int32_t d = (int32_t)(w0 / t->len[0]);
+                        if (d < min_id) {
+                            min_id = d;
                         }
                     }
-                    for (int a = 1; a < center_ic; a++) {
-                        int32_t tmp = center_ix[a];
-                        int b = a - 1;
-                        while (b >= 0 && center_ix[b] > tmp) {
-                            center_ix[b + 1] = center_ix[b];
-                            b--;
+                    if (!(emask & 0x02)) {
+                        int32_t d = (int32_t)(w1 / t->len[1]);
+                        if (d < min_id) {
+                            min_id = d;
                         }
-                        center_ix[b + 1] = tmp;
                     }
-                }
-#endif
-
-#if GFX_BLEND_POLYGON_SOLID_HARD_EDGE
-                if (opa >= OPA_COVER) {
-                    gfx_color_t *row = dest_buf + (size_t)(y - buf_area->y1) * dest_stride;
-                    for (int p = 0; p + 1 < center_ic; p += 2) {
-                        for (int32_t x = cov_x0; x <= cov_x1; x++) {
-                            int32_t xc = x * POLY_ONE + POLY_HALF;
-                            if (xc >= center_ix[p] && xc < center_ix[p + 1]) {
-                                row[x - buf_area->x1] = fill;
-                            }
+                    if (!(emask & 0x04)) {
+                        int32_t d = (int32_t)(w2 / t->len[2]);
+                        if (d < min_id) {
+                            min_id = d;
                         }
                     }
-                    continue;
-                }
-#endif
-
-                for (int s = 0; s < POLY_SUB_SAMPLES; s++) {
-                    int32_t yc = y * POLY_ONE + (2 * s + 1) * POLY_ONE / (2 * POLY_SUB_SAMPLES);
-                    int32_t ix[POLY_MAX_IX];
-                    int ic = 0;
-
-                    for (int e = 0; e < vertex_count; e++) {
-                        int en = (e + 1 < vertex_count) ? e + 1 : 0;
-                        int32_t y1 = vy[e], y2 = vy[en];
-                        if ((y1 <= yc && y2 > yc) || (y2 <= yc && y1 > yc)) {
-                            int32_t dy = y2 - y1;
-                            int32_t xi = (int32_t)((int64_t)vx[e] + (int64_t)(yc - y1) * (vx[en] - vx[e]) / dy);
-                            if (ic < POLY_MAX_IX) {
-                                ix[ic++] = xi;
-                            }
+                    for (uint8_t ei = 0; ei < t->xaa_n; ei++) {
+                        int32_t d = (int32_t)(px.xaa[ei] / t->xaa_edges[ei].len);
+                        if (d < min_id) {
+                            min_id = d;
                         }
                     }
-
-                    if (ic < 2) {
-                        continue;
-                    }
-
-                    for (int a = 1; a < ic; a++) {
-                        int32_t tmp = ix[a];
-                        int b = a - 1;
-                        while (b >= 0 && ix[b] > tmp) {
-                            ix[b + 1] = ix[b];
-                            b--;
+                } else {
+                    if (!(emask & 0x01)) {
+                        int32_t d = (int32_t)((-w0) / t->len[0]);
+                        if (d < min_id) {
+                            min_id = d;
                         }
-                        ix[b + 1] = tmp;
                     }
-
-                    for (int p = 0; p + 1 < ic; p += 2) {
-                        int32_t xlq = ix[p];
-                        int32_t xrq = ix[p + 1];
-                        if (xlq >= xrq) {
-                            continue;
-                        }
-
-                        int32_t xl = (xlq >= 0) ? (xlq >> POLY_FRAC) : -(((-xlq) + POLY_MASK) >> POLY_FRAC);
-                        int32_t xr = (xrq >= 0) ? (xrq >> POLY_FRAC) : -((-xrq) >> POLY_FRAC);
-                        if (xr < cov_x0 || xl > cov_x1) {
-                            continue;
-                        }
-
-                        if (xl == xr) {
-                            if (xl >= cov_x0 && xl <= cov_x1) {
-                                cov_buf[xl - cov_x0] += (uint16_t)((xrq - xlq) * 255 / POLY_ONE);
-                            }
-                            continue;
+                    if (!(emask & 0x02)) {
+                        int32_t d = (int32_t)((-w1) / t->len[1]);
+                        if (d < min_id) {
+                            min_id = d;
                         }
-
-                        if (xl >= cov_x0 && xl <= cov_x1) {
-                            int32_t frac = xlq & POLY_MASK;
-                            cov_buf[xl - cov_x0] += (uint16_t)((POLY_ONE - frac) * 255 / POLY_ONE);
-                        }
-                        {
-                            int32_t fs = MAX(xl + 1, cov_x0);
-                            int32_t fe = MIN(xr - 1, cov_x1);
-                            for (int32_t x = fs; x <= fe; x++) {
-                                cov_buf[x - cov_x0] += 255;
-                            }
+                    }
+                    if (!(emask & 0x04)) {
+                        int32_t d = (int32_t)((-w2) / t->len[2]);
+                        if (d < min_id) {
+                            min_id = d;
                         }
-                        if (xr >= cov_x0 && xr <= cov_x1) {
-                            int32_t frac = xrq & POLY_MASK;
-                            if (frac > 0) {
-                                cov_buf[xr - cov_x0] += (uint16_t)(frac * 255 / POLY_ONE);
-                            }
+                    }
+                    for (uint8_t ei = 0; ei < t->xaa_n; ei++) {
+                        int32_t d = (int32_t)((-px.xaa[ei]) / t->xaa_edges[ei].len);
+                        if (d < min_id) {
+                            min_id = d;
                         }
                     }
                 }
+                if (min_id < GFX_BLEND_TRI_EDGE_AA_RANGE) {
+                    gfx_opa_t edge_opa = (gfx_opa_t)((int32_t)min_id * 255 / GFX_BLEND_TRI_EDGE_AA_RANGE);
+                    final_opa = (gfx_opa_t)(((uint32_t)final_opa * edge_opa + 128U) >> 8);
+                    if (final_opa == 0U) {
+                        goto next_pixel;
+                    }
+                }
+            }
 
-                gfx_color_t *row = dest_buf + (size_t)(y - buf_area->y1) * dest_stride;
-                for (int32_t x = cov_x0; x <= cov_x1; x++) {
-                    uint16_t c = cov_buf[x - cov_x0];
-                    if (c == 0) {
-                        continue;
+            if (mask != NULL) {
+                gfx_opa_t src_opa = mask[(size_t)src_y * t->tex.mask_stride + (size_t)src_x];
+                final_opa = (gfx_opa_t)(((uint32_t)final_opa * src_opa + 128) >> 8);
+            }
+            if (final_opa == 0U) {
+                goto next_pixel;
+            } else if (final_opa >= OPA_COVER) {
+                *dst_row = src_color;
+            } else {
+                *dst_row = gfx_blend_color_mix(src_color, *dst_row, final_opa, swap);
+            }
+        } else {
+            /* Outside triangle */
+            if (inward) {
+                goto next_pixel;
+            }
+            /* Outward edge AA: blend if within 1 px.
+             * Skip distance for edges flagged as internal (shared
+             * with an adjacent triangle) to avoid dark-seam artifacts.
+             * Bit 0 = edge 0 (v1→v2), bit 1 = edge 1 (v2→v0),
+             * bit 2 = edge 2 (v0→v1). */
+            int32_t max_od = 0;
+            if (area_2x > 0) {
+                if (w0 < 0 && !(internal_edges & 0x01)) {
+                    int32_t d = (int32_t)((-w0) / t->len[0]);
+                    if (d > max_od) {
+                        max_od = d;
                     }
-                    gfx_opa_t px_opa = (c >= POLY_SUB_SAMPLES * 255) ? 255 : (gfx_opa_t)(c / POLY_SUB_SAMPLES);
-                    if (opa < OPA_COVER) {
-                        px_opa = (gfx_opa_t)(((uint32_t)px_opa * opa + 128U) >> 8);
+                }
+                if (w1 < 0 && !(internal_edges & 0x02)) {
+                    int32_t d = (int32_t)((-w1) / t->len[1]);
+                    if (d > max_od) {
+                        max_od = d;
                     }
-                    if (px_opa >= OPA_MAX) {
-                        row[x - buf_area->x1] = fill;
-                    } else if (px_opa > 0U) {
-#if GFX_BLEND_POLYGON_INWARD_AA || GFX_BLEND_POLYGON_SOLID_HARD_EDGE
-                        bool center_inside = false;
-                        int32_t xc = x * POLY_ONE + POLY_HALF;
-                        for (int p = 0; p + 1 < center_ic; p += 2) {
-                            if (xc >= center_ix[p] && xc < center_ix[p + 1]) {
-                                center_inside = true;
-                                break;
-                            }
-                        }
-#endif
+                }
+                if (w2 < 0 && !(internal_edges & 0x04)) {
+                    int32_t d = (int32_t)((-w2) / t->len[2]);
+                    if (d > max_od) {
+                        max_od = d;
+                    }
+                }
+            } else {
+                if (w0 > 0 && !(internal_edges & 0x01)) {
+                    int32_t d = (int32_t)(w0 / t->len[0]);
+                    if (d > max_od) {
+                        max_od = d;
+                    }
+                }
+                if (w1 > 0 && !(internal_edges & 0x02)) {
+                    int32_t d = (int32_t)(w1 / t->len[1]);
+                    if (d > max_od) {
+                        max_od = d;
+                    }
+                }
+                if (w2 > 0 && !(internal_edges & 0x04)) {
+                    int32_t d = (int32_t)(w2 / t->len[2]);
+                    if (d > max_od) {
+                        max_od = d;
+                    }
+                }
+            }
+
+            if (max_od > 0 && max_od < GFX_BLEND_TRI_EDGE_AA_RANGE) {
+                gfx_opa_t aa_opa = (gfx_opa_t)((GFX_BLEND_TRI_EDGE_AA_RANGE - max_od) * 255 / GFX_BLEND_TRI_EDGE_AA_RANGE);
+                int32_t src_x = (u_cur + TRI_FRAC_HALF) >> TRI_FRAC_BITS;
+                int32_t src_y = (v_cur + TRI_FRAC_HALF) >> TRI_FRAC_BITS;
+                src_x = gfx_sw_blend_clamp_coord(src_x, 0, t->tex.stride - 1);
+                src_y = gfx_sw_blend_clamp_coord(src_y, 0, t->tex.height - 1);
+                gfx_color_t src_color = src_buf[(size_t)src_y * t->tex.stride + (size_t)src_x];
+                if (opa < OPA_COVER) {
+                    aa_opa = (gfx_opa_t)(((uint32_t)aa_opa * opa + 128U) >> 8);
+                }
+                if (mask != NULL) {
+                    gfx_opa_t src_opa = mask[(size_t)src_y * t->tex.mask_stride + (size_t)src_x];
+                    aa_opa = (gfx_opa_t)(((uint32_t)aa_opa * src_opa + 128) >> 8);
+                }
+                if (aa_opa > 0) {
+                    *dst_row = gfx_blend_color_mix(src_color, *dst_row, aa_opa, swap);
+                }
+            }
+        }
+
+next_pixel:
+        w0 += t->step_x[0];
+        w1 += t->step_x[1];
+        u_cur += t->du_dx;
+        v_cur += t->dv_dx;
+        for (uint8_t ei = 0; ei < t->xaa_n; ei++) {
+            px.xaa[ei] += t->xaa_sx[ei];
+        }
+        dst_row++;
+    }
+}
+
+static inline uint64_t gfx_blend_perf_elapsed_us(int64_t start_us)
+{
+    return (uint64_t)(esp_timer_get_time() - start_us);
+}
+
+static void gfx_sw_blend_perf_counter_merge(gfx_perf_counter_t *dst, const gfx_perf_counter_t *src)
+{
+    dst->calls += src->calls;
+    dst->pixels += src->pixels;
+    dst->time_us += src->time_us;
+}
+
+static int gfx_sw_blend_poly_edge_cmp(const void *a, const void *b)
+{
+    const gfx_sw_blend_poly_edge_t *ea = (const gfx_sw_blend_poly_edge_t *)a;
+    const gfx_sw_blend_poly_edge_t *eb = (const gfx_sw_blend_poly_edge_t *)b;
+
+    return (ea->y0 > eb->y0) - (ea->y0 < eb->y0);
+}
+
+/* x of edge e at y, which must lie within its y range */
+static inline int32_t gfx_sw_blend_poly_edge_x(const gfx_sw_blend_poly_edge_t *e, int32_t y)
+{
+    return e->x0 + (int32_t)((int64_t)(y - e->y0) * (e->x1 - e->x0) / (e->y1 - e->y0));
+}
+
+/*
+ * Accumulate a segment lying inside pixel column cx (x relative to the row
+ * start). acc[cx] gets the area right of the segment within the column and
+ * acc[cx + 1] the remainder of its height, so the prefix sum over a row is
+ * the signed covered area of each pixel in POLY_AREA_FULL units.
+ */
+static inline void gfx_sw_blend_poly_cell(gfx_sw_blend_poly_row_t *row, int32_t cx,
+        int32_t xa, int32_t ya, int32_t xb, int32_t yb, int32_t dir)
+{
+    int32_t dy = ((yb > ya) ? (yb - ya) : (ya - yb)) * dir;
+    int32_t xm2 = xa + xb - 2 * cx * POLY_ONE;
+
+    row->acc[cx] += dy * (2 * POLY_ONE - xm2);
+    row->acc[cx + 1] += dy * xm2;
+    row->cmin = MIN(row->cmin, cx);
+    row->cmax = MAX(row->cmax, cx + 1);
+}
+
+/* Accumulate one edge's piece of the current row, x relative to the row start */
+static void gfx_sw_blend_poly_segment(gfx_sw_blend_poly_row_t *row,
+                                      int32_t xa, int32_t ya, int32_t xb, int32_t yb, int32_t dir)
+{
+    const int32_t right = row->w * POLY_ONE;
+
+    if (xa > xb) {
+        int32_t tx = xa, ty = ya;
+        xa = xb;
+        ya = yb;
+        xb = tx;
+        yb = ty;
+    }
+    if (xa >= right || ya == yb) {
+        return;
+    }
+    /* Left of the row only the height matters: fold that part onto x = 0 */
+    if (xb <= 0) {
+        gfx_sw_blend_poly_cell(row, 0, 0, ya, 0, yb, dir);
+        return;
+    }
+
+    /*
+     * Every crossing is interpolated from the same endpoints, so the result
+     * does not depend on where the row was clipped.
+     */
+    const int64_t dx = xb - xa;
+    const int64_t dy = yb - ya;
+    int32_t c0 = 0;
+    int32_t c1 = (MIN(xb, right) - 1) >> POLY_FRAC;
+    int32_t px = xa, py = ya;
+
+    if (xa < 0) {
+        py = ya + (int32_t)((0 - xa) * dy / dx);
+        px = 0;
+        gfx_sw_blend_poly_cell(row, 0, 0, ya, 0, py, dir);
+    } else {
+        c0 = xa >> POLY_FRAC;
+        c1 = MAX(c1, c0);
+    }
+    for (int32_t c = c0; c < c1; c++) {
+        int32_t bx = (c + 1) * POLY_ONE;
+        int32_t by = ya + (int32_t)((bx - xa) * dy / dx);
+        gfx_sw_blend_poly_cell(row, c, px, py, bx, by, dir);
+        px = bx;
+        py = by;
+    }
+    /* Right of the row nothing is visible */
+    if (xb > right) {
+        gfx_sw_blend_poly_cell(row, c1, px, py, right, ya + (int32_t)((right - xa) * dy / dx), dir);
+    } else {
+        gfx_sw_blend_poly_cell(row, c1, px, py, xb, yb, dir);
+    }
+}
+
+/* Signed area from the row prefix sum to an alpha, before opa */
+static inline gfx_opa_t gfx_sw_blend_poly_alpha(int32_t area, gfx_sw_blend_fill_rule_t rule)
+{
+    int32_t a = (area < 0) ? -area : area;
+
+    if (rule == GFX_SW_BLEND_FILL_EVEN_ODD) {
+        /* Winding 2 is outside again: fold the area back */
+        a %= 2 * POLY_AREA_FULL;
+        if (a > POLY_AREA_FULL) {
+            a = 2 * POLY_AREA_FULL - a;
+        }
+    } else if (a > POLY_AREA_FULL) {
+        a = POLY_AREA_FULL;
+    }
 #if GFX_BLEND_POLYGON_INWARD_AA
-                        if (!center_inside) {
-                            continue;
-                        }
+    /*
+     * A straight edge leaves at least half of a pixel inside exactly when the
+     * pixel centre is inside, so this keeps AA off pixels centred outside.
+     */
+    if (a < POLY_AREA_FULL / 2) {
+        return 0U;
+    }
 #endif
+    return (gfx_opa_t)(((int64_t)a * 255 + POLY_AREA_FULL / 2) / POLY_AREA_FULL);
+}
+
+/*
+ * Resolve the accumulated row into pixels. Cells the edges never touched
+ * continue the previous pixel's coverage, so each such run is resolved once:
+ * solid runs become one fill, empty runs are skipped and partial pixels are
+ * batched into poly_span.
+ */
+static void gfx_sw_blend_poly_flush_row(gfx_sw_blend_poly_row_t *row, gfx_opa_t *alpha,
+                                        gfx_color_t *dst, gfx_color_t color, gfx_color_t fill,
+                                        gfx_opa_t opa, gfx_sw_blend_fill_rule_t rule, bool swap)
+{
+    const gfx_blend_backend_t *backend = s_blend_backend;
+    /* Past cmax the coverage stays put: interior when right edges fell outside the row */
+    const int32_t x_end = row->w - 1;
+    int32_t area = 0;
+    int32_t span_x = -1;
+
+    for (int32_t x = row->cmin; x <= x_end; x++) {
+        int32_t run_end = x;
+        gfx_opa_t a;
+
+        area += row->acc[x];
+        while (run_end < x_end && row->acc[run_end + 1] == 0) {
+            run_end++;
+        }
+
+        a = gfx_sw_blend_poly_alpha(area, rule);
 #if GFX_BLEND_POLYGON_SOLID_HARD_EDGE
-                        if (opa >= OPA_COVER && center_inside) {
-                            row[x - buf_area->x1] = fill;
-                        } else {
-                            row[x - buf_area->x1] = gfx_blend_color_mix(color, row[x - buf_area->x1], px_opa, swap);
-                        }
-#else
-                        row[x - buf_area->x1] = gfx_blend_color_mix(color, row[x - buf_area->x1], px_opa, swap);
+        if (opa >= OPA_COVER && a != 0U) {
+            a = OPA_COVER;
+        }
 #endif
-                    }
-                }
+        if (a != 0U && opa < OPA_COVER) {
+            a = (gfx_opa_t)(((uint32_t)a * opa + 128U) >> 8);
+        }
+
+        if (a == 0U || a >= OPA_MAX) {
+            if (span_x >= 0) {
+                backend->poly_span(dst + span_x, alpha + span_x, x - span_x, color, swap);
+                span_x = -1;
+            }
+            if (a != 0U) {
+                backend->fill((uint16_t *)(dst + x), fill.full, (size_t)(run_end - x + 1));
+            }
+        } else {
+            if (span_x < 0) {
+                span_x = x;
+            }
+            memset(alpha + x, a, (size_t)(run_end - x + 1));
+        }
+        x = run_end;
+    }
+    if (span_x >= 0) {
+        backend->poly_span(dst + span_x, alpha + span_x, x_end - span_x + 1, color, swap);
+    }
+
+    memset(row->acc + row->cmin, 0, (size_t)(row->cmax - row->cmin + 1) * sizeof(int32_t));
+    row->cmin = INT32_MAX;
+    row->cmax = -1;
+}
+
+static void gfx_sw_blend_polygon_fill_aet(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
+        const gfx_area_t *buf_area, const gfx_area_t *clip_area,
+        gfx_color_t color, gfx_opa_t opa,
+        const int32_t *vx, const int32_t *vy, int vertex_count,
+        gfx_sw_blend_fill_rule_t rule, bool swap)
+{
+    gfx_sw_blend_poly_edge_t edges_stack[POLY_STACK_EDGES];
+    int32_t active_stack[POLY_STACK_EDGES];
+    int32_t acc_stack[POLY_STACK_WIDTH + 2];
+    gfx_opa_t alpha_stack[POLY_STACK_WIDTH];
+    gfx_sw_blend_poly_edge_t *edges = edges_stack;
+    int32_t *active = active_stack;
+    gfx_opa_t *alpha = alpha_stack;
+    void *heap = NULL;
+    gfx_sw_blend_poly_row_t row;
+    int32_t min_xq, max_xq, min_yq, max_yq;
+    int32_t x_lo, x_hi, y_start, y_end;
+    int edge_count = 0;
+    int active_count = 0;
+    int next_edge = 0;
+    gfx_color_t fill;
+
+    min_xq = max_xq = vx[0];
+    min_yq = max_yq = vy[0];
+    for (int i = 1; i < vertex_count; i++) {
+        min_xq = MIN(min_xq, vx[i]);
+        max_xq = MAX(max_xq, vx[i]);
+        min_yq = MIN(min_yq, vy[i]);
+        max_yq = MAX(max_yq, vy[i]);
+    }
+
+    x_lo = MAX(gfx_sw_blend_floor_q8_to_int(min_xq), MAX(buf_area->x1, clip_area->x1));
+    x_hi = MIN(gfx_sw_blend_ceil_q8_to_int(max_xq), MIN(buf_area->x2 - 1, clip_area->x2 - 1));
+    y_start = MAX(gfx_sw_blend_floor_q8_to_int(min_yq), MAX(buf_area->y1, clip_area->y1));
+    y_end = MIN(gfx_sw_blend_ceil_q8_to_int(max_yq), MIN(buf_area->y2 - 1, clip_area->y2 - 1));
+    if (x_lo > x_hi || y_start > y_end) {
+        return;
+    }
+
+    row.w = x_hi - x_lo + 1;
+    row.acc = acc_stack;
+    row.cmin = INT32_MAX;
+    row.cmax = -1;
+    if (vertex_count > POLY_STACK_EDGES || row.w > POLY_STACK_WIDTH) {
+        /* One block, widest element first so every array stays aligned */
+        size_t edges_size = (size_t)vertex_count * sizeof(gfx_sw_blend_poly_edge_t);
+        size_t acc_size = (size_t)(row.w + 2) * sizeof(int32_t);
+        size_t block_size = edges_size + acc_size + (size_t)vertex_count * sizeof(int32_t) + (size_t)row.w;
+        uint8_t *block;
+        if (s_active_scratch != NULL) {
+            if (s_active_scratch->size < block_size) {
+                free(s_active_scratch->buf);
+                s_active_scratch->buf = malloc(block_size);
+                s_active_scratch->size = (s_active_scratch->buf != NULL) ? block_size : 0;
+            }
+            block = s_active_scratch->buf;
+        } else {
+            block = malloc(block_size);
+            heap = block;
+        }
+        if (block == NULL) {
+            return;
+        }
+        edges = (gfx_sw_blend_poly_edge_t *)block;
+        row.acc = (int32_t *)(block + edges_size);
+        active = (int32_t *)(block + edges_size + acc_size);
+        alpha = (gfx_opa_t *)(active + vertex_count);
+    }
+    memset(row.acc, 0, (size_t)(row.w + 2) * sizeof(int32_t));
+
+    /* Edge table: non-horizontal edges oriented top to bottom, sorted by top */
+    for (int i = 0; i < vertex_count; i++) {
+        int n = (i + 1 < vertex_count) ? i + 1 : 0;
+        gfx_sw_blend_poly_edge_t *e = &edges[edge_count];
+
+        if (vy[i] == vy[n]) {
+            continue;
+        }
+        if (vy[i] < vy[n]) {
+            *e = (gfx_sw_blend_poly_edge_t) {
+                vx[i], vy[i], vx[n], vy[n], 1
+            };
+        } else {
+            *e = (gfx_sw_blend_poly_edge_t) {
+                vx[n], vy[n], vx[i], vy[i], -1
+            };
+        }
+        edge_count++;
+    }
+    qsort(edges, (size_t)edge_count, sizeof(gfx_sw_blend_poly_edge_t), gfx_sw_blend_poly_edge_cmp);
+
+    fill = color;
+    if (swap) {
+        fill.full = (uint16_t)(fill.full << 8 | fill.full >> 8);
+    }
+
+    for (int32_t y = y_start; y <= y_end; y++) {
+        const int32_t row_top = y * POLY_ONE;
+        const int32_t row_bot = row_top + POLY_ONE;
+        int kept = 0;
+
+        while (next_edge < edge_count && edges[next_edge].y0 < row_bot) {
+            active[active_count++] = next_edge++;
+        }
+        for (int i = 0; i < active_count; i++) {
+            const gfx_sw_blend_poly_edge_t *e = &edges[active[i]];
+
+            if (e->y1 <= row_top) {
+                continue;
+            }
+            active[kept++] = active[i];
+
+            int32_t ya = MAX(e->y0, row_top);
+            int32_t yb = MIN(e->y1, row_bot);
+            if (ya < yb) {
+                gfx_sw_blend_poly_segment(&row,
+                                          gfx_sw_blend_poly_edge_x(e, ya) - x_lo * POLY_ONE, ya,
+                                          gfx_sw_blend_poly_edge_x(e, yb) - x_lo * POLY_ONE, yb, e->dir);
             }
         }
+        active_count = kept;
+
+        if (row.cmax >= 0) {
+            gfx_sw_blend_poly_flush_row(&row, alpha,
+                                        dest_buf + (size_t)(y - buf_area->y1) * dest_stride + (size_t)(x_lo - buf_area->x1),
+                                        color, fill, opa, rule, swap);
+        }
+        if (active_count == 0 && next_edge == edge_count) {
+            break;
+        }
     }
 
-#undef POLY_FRAC
-#undef POLY_ONE
-#undef POLY_HALF
-#undef POLY_MASK
-#undef POLY_MAX_IX
-#undef POLY_SUB_SAMPLES
-#undef POLY_COV_MAX_W
+    free(heap);
 }
 
 /**********************
@@ -392,56 +823,80 @@ void gfx_sw_blend_perf_unbind(void)
     s_active_perf_stats = NULL;
 }
 
-gfx_color_t gfx_blend_color_mix(gfx_color_t c1, gfx_color_t c2, uint8_t mix, bool swap)
+void gfx_sw_blend_scratch_bind(gfx_blend_scratch_t *scratch)
 {
-    gfx_color_t ret;
+    s_active_scratch = scratch;
+}
 
-    if (swap) {
-        c1.full = c1.full << 8 | c1.full >> 8;
-        c2.full = c2.full << 8 | c2.full >> 8;
-    }
-    /*Source: https://stackoverflow.com/a/50012418/1999969*/
-    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
-    uint32_t bg = (uint32_t)((uint32_t)c2.full | ((uint32_t)c2.full << 16)) &
-                  0x7E0F81F; /*0b00000111111000001111100000011111*/
-    uint32_t fg = (uint32_t)((uint32_t)c1.full | ((uint32_t)c1.full << 16)) & 0x7E0F81F;
-    uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F;
-    ret.full = (uint16_t)((result >> 16) | result);
-    if (swap) {
-        ret.full = ret.full << 8 | ret.full >> 8;
+void gfx_sw_blend_scratch_free(gfx_blend_scratch_t *scratch)
+{
+    if (scratch == NULL) {
+        return;
     }
+    free(scratch->buf);
+    scratch->buf = NULL;
+    scratch->size = 0;
+}
 
-    return ret;
+void gfx_sw_blend_perf_merge(gfx_blend_perf_stats_t *dst, const gfx_blend_perf_stats_t *src)
+{
+    if (dst == NULL || src == NULL) {
+        return;
+    }
+    gfx_sw_blend_perf_counter_merge(&dst->fill, &src->fill);
+    gfx_sw_blend_perf_counter_merge(&dst->color_draw, &src->color_draw);
+    gfx_sw_blend_perf_counter_merge(&dst->image_draw, &src->image_draw);
+    gfx_sw_blend_perf_counter_merge(&dst->triangle_draw, &src->triangle_draw);
+    dst->triangle_covered_pixels += src->triangle_covered_pixels;
+    dst->triangle_aa_pixels += src->triangle_aa_pixels;
 }
 
-void gfx_sw_blend_fill(uint16_t *buf, uint16_t color, size_t pixels)
+gfx_color_t gfx_blend_color_mix(gfx_color_t c1, gfx_color_t c2, uint8_t mix, bool swap)
 {
-    if ((color & 0xFF) == (color >> 8)) {
-        memset(buf, color & 0xFF, pixels * sizeof(uint16_t));
-    } else {
-        uint32_t color32 = ((uint32_t)color << 16) | color;
+    return gfx_blend_mix_rgb565(c1, c2, mix, swap);
+}
 
-        if (((uintptr_t)buf & 0x3) && pixels > 0) {
-            *buf++ = color;
-            pixels--;
-        }
+const gfx_blend_backend_t *gfx_blend_backend_get(void)
+{
+    return s_blend_backend;
+}
 
-        uint32_t *buf32 = (uint32_t *)buf;
-        size_t pairs = pixels / 2;
+esp_err_t gfx_blend_backend_set(const gfx_blend_backend_t *backend)
+{
+    if (backend == NULL) {
+        s_blend_backend = BLEND_BACKEND_DEFAULT;
+        return ESP_OK;
+    }
+    if (backend->fill == NULL || backend->color_draw == NULL || backend->image_draw == NULL ||
+            backend->premul_draw == NULL || backend->tri_span == NULL || backend->poly_span == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    s_blend_backend = backend;
+    return ESP_OK;
+}
 
-        for (size_t i = 0; i < pairs; i++) {
-            buf32[i] = color32;
-        }
+size_t gfx_blend_backend_count(void)
+{
+    return sizeof(s_blend_backends) / sizeof(s_blend_backends[0]);
+}
 
-        if (pixels & 1) {
-            buf[pixels - 1] = color;
-        }
+const gfx_blend_backend_t *gfx_blend_backend_at(size_t index)
+{
+    if (index >= gfx_blend_backend_count()) {
+        return NULL;
     }
+    return s_blend_backends[index];
+}
+
+void gfx_sw_blend_fill(uint16_t *buf, uint16_t color, size_t pixels)
+{
+    s_blend_backend->fill(buf, color, pixels);
 }
 
 void gfx_sw_blend_fill_area(uint16_t *dest_buf, gfx_coord_t dest_stride,
                             const gfx_area_t *area, uint16_t color)
 {
+    const gfx_blend_backend_t *backend = s_blend_backend;
     int64_t perf_start_us = 0;
 
     if (dest_buf == NULL || area == NULL) {
@@ -457,7 +912,7 @@ void gfx_sw_blend_fill_area(uint16_t *dest_buf, gfx_coord_t dest_stride,
     }
     for (int32_t y = area->y1; y < area->y2; y++) {
         uint16_t *row = dest_buf + (size_t)y * dest_stride + area->x1;
-        gfx_sw_blend_fill(row, color, (size_t)w);
+        backend->fill(row, color, (size_t)w);
     }
     if (s_active_perf_stats != NULL) {
         s_active_perf_stats->fill.calls++;
@@ -474,9 +929,6 @@ void gfx_sw_blend_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
     int32_t h = clip_area->y2 - clip_area->y1;
     int64_t perf_start_us = 0;
 
-    int32_t x, y;
-    uint32_t c32 = color.full + ((uint32_t)color.full << 16);
-
     if (w <= 0 || h <= 0) {
         return;
     }
@@ -485,78 +937,8 @@ void gfx_sw_blend_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
         perf_start_us = esp_timer_get_time();
     }
 
-    /*Only the mask matters*/
-    if (opa >= OPA_MAX) {
-        int32_t x_end4 = w - 4;
-
-        for (y = 0; y < h; y++) {
-            for (x = 0; x < w && ((uintptr_t)mask & 0x3); x++) {
-                FILL_NORMAL_MASK_PX(color, swap)
-            }
-
-            for (; x <= x_end4; x += 4) {
-                uint32_t mask32 = *((uint32_t *)mask);
-                if (mask32 == 0xFFFFFFFF) {
-                    if ((uintptr_t)dest_buf & 0x3) {
-                        dest_buf[0] = color;
-                        ((uint32_t *)(dest_buf + 1))[0] = c32;
-                        dest_buf[3] = color;
-                    } else {
-                        uint32_t *d32 = (uint32_t *)dest_buf;
-                        d32[0] = c32;
-                        d32[1] = c32;
-                    }
-                    dest_buf += 4;
-                    mask += 4;
-                } else if (mask32) {
-                    FILL_NORMAL_MASK_PX(color, swap)
-                    FILL_NORMAL_MASK_PX(color, swap)
-                    FILL_NORMAL_MASK_PX(color, swap)
-                    FILL_NORMAL_MASK_PX(color, swap)
-                } else { //transparent
-                    mask += 4;
-                    dest_buf += 4;
-                }
-            }
+    s_blend_backend->color_draw(dest_buf, dest_stride, mask, mask_stride, w, h, color, opa, swap);
 
-            for (; x < w ; x++) {
-                FILL_NORMAL_MASK_PX(color, swap)
-            }
-            dest_buf += (dest_stride - w);
-            mask += (mask_stride - w);
-        }
-    } else { /*With opacity*/
-        /*Buffer the result color to avoid recalculating the same color*/
-        gfx_color_t last_dest_color;
-        gfx_color_t last_res_color;
-        gfx_opa_t last_mask = OPA_TRANSP;
-        last_dest_color.full = dest_buf[0].full;
-        last_res_color.full = dest_buf[0].full;
-        gfx_opa_t opa_tmp = OPA_TRANSP;
-
-        for (y = 0; y < h; y++) {
-            for (x = 0; x < w; x++) {
-                if (*mask) {
-                    if (*mask != last_mask) {
-                        opa_tmp = (*mask == OPA_COVER) ? opa : ((uint32_t)((uint32_t)(*mask) * opa) >> 8);
-                    }
-                    if (*mask != last_mask || last_dest_color.full != dest_buf[x].full) {
-                        if (opa_tmp == OPA_COVER) {
-                            last_res_color = color;
-                        } else {
-                            last_res_color = gfx_blend_color_mix(color, dest_buf[x], opa_tmp, swap);
-                        }
-                        last_mask = *mask;
-                        last_dest_color.full = dest_buf[x].full;
-                    }
-                    dest_buf[x] = last_res_color;
-                }
-                mask++;
-            }
-            dest_buf += dest_stride;
-            mask += (mask_stride - w);
-        }
-    }
     if (s_active_perf_stats != NULL) {
         s_active_perf_stats->color_draw.calls++;
         s_active_perf_stats->color_draw.pixels += (uint64_t)w * (uint64_t)h;
@@ -573,8 +955,6 @@ void gfx_sw_blend_img_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
     int32_t h = clip_area->y2 - clip_area->y1;
     int64_t perf_start_us = 0;
 
-    int32_t x, y;
-
     if (w <= 0 || h <= 0) {
         return;
     }
@@ -583,51 +963,34 @@ void gfx_sw_blend_img_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
         perf_start_us = esp_timer_get_time();
     }
 
-    if (mask == NULL) {
-        /* src_buf is expected to already be in native framebuffer order */
-        size_t row_bytes = (size_t)w * sizeof(gfx_color_t);
-        for (y = 0; y < h; y++) {
-            memcpy(dest_buf, src_buf, row_bytes);
-            dest_buf += dest_stride;
-            src_buf += src_stride;
-        }
-        if (s_active_perf_stats != NULL) {
-            s_active_perf_stats->image_draw.calls++;
-            s_active_perf_stats->image_draw.pixels += (uint64_t)w * (uint64_t)h;
-            s_active_perf_stats->image_draw.time_us += gfx_blend_perf_elapsed_us(perf_start_us);
-        }
+    s_blend_backend->image_draw(dest_buf, dest_stride, src_buf, src_stride, mask, mask_stride, w, h, swap);
+
+    if (s_active_perf_stats != NULL) {
+        s_active_perf_stats->image_draw.calls++;
+        s_active_perf_stats->image_draw.pixels += (uint64_t)w * (uint64_t)h;
+        s_active_perf_stats->image_draw.time_us += gfx_blend_perf_elapsed_us(perf_start_us);
+    }
+}
+
+void gfx_sw_blend_img_premul_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
+                                  const gfx_color_t *src_buf, gfx_coord_t src_stride,
+                                  const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                  gfx_area_t *clip_area, bool swap)
+{
+    int32_t w = clip_area->x2 - clip_area->x1;
+    int32_t h = clip_area->y2 - clip_area->y1;
+    int64_t perf_start_us = 0;
+
+    if (w <= 0 || h <= 0) {
         return;
     }
 
-    gfx_color_t last_dest_color;
-    gfx_color_t last_res_color;
-    gfx_color_t last_src_color;
-    gfx_opa_t last_mask = OPA_TRANSP;
-    last_dest_color.full = dest_buf[0].full;
-    last_res_color.full = dest_buf[0].full;
-    last_src_color.full = src_buf[0].full;
-
-    for (y = 0; y < h; y++) {
-        for (x = 0; x < w; x++) {
-            if (*mask) {
-                if (*mask != last_mask || last_dest_color.full != dest_buf[x].full || last_src_color.full != src_buf[x].full) {
-                    if (*mask == OPA_COVER) {
-                        last_res_color = src_buf[x];
-                    } else {
-                        last_res_color = gfx_blend_color_mix(src_buf[x], dest_buf[x], *mask, swap);
-                    }
-                    last_mask = *mask;
-                    last_dest_color.full = dest_buf[x].full;
-                    last_src_color.full = src_buf[x].full;
-                }
-                dest_buf[x] = last_res_color;
-            }
-            mask++;
-        }
-        dest_buf += dest_stride;
-        src_buf += src_stride;
-        mask += (mask_stride - w);
+    if (s_active_perf_stats != NULL) {
+        perf_start_us = esp_timer_get_time();
     }
+
+    s_blend_backend->premul_draw(dest_buf, dest_stride, src_buf, src_stride, mask, mask_stride, w, h, swap);
+
     if (s_active_perf_stats != NULL) {
         s_active_perf_stats->image_draw.calls++;
         s_active_perf_stats->image_draw.pixels += (uint64_t)w * (uint64_t)h;
@@ -649,33 +1012,28 @@ void gfx_sw_blend_img_triangle_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stri
                                     bool swap)
 {
     /*
-     * Fixed-point incremental edge-walking rasterizer.
+     * Fixed-point edge-function rasterizer, traversed in TRI_BLOCK square
+     * blocks.
      *
-     * Instead of computing 3 edge functions + 2 float divides per pixel,
-     * we pre-compute linear step constants and walk the edge values with
-     * pure integer adds in the inner loop.
-     *
-     * Fractional precision: 16 bits (sufficient for sub-1024px coordinates).
+     * Edge functions are linear, so each block is classified from its corners:
+     * blocks entirely outside the triangle (or its AA band) are skipped,
+     * blocks entirely inside and clear of every AA band go straight to the
+     * backend's tri_span, and only blocks straddling an edge walk the edge
+     * values per pixel with integer adds.
      */
-#define FRAC_BITS     16
-#define FRAC_HALF     (1 << (FRAC_BITS - 1))
 #define XY_SUB_ONE    GFX_MESH_FRAC_ONE
 #define XY_SUB_HALF   GFX_MESH_FRAC_HALF
 
+    gfx_sw_blend_tri_t t;
     int64_t area_2x;
     int32_t min_x, min_y, max_x, max_y;
     int64_t perf_start_us = 0;
     uint64_t perf_raster_pixels = 0;
+    uint64_t perf_accept_pixels = 0;
+    uint64_t perf_edge_pixels = 0;
 
     /* Edge function step constants (mesh subpixel geometry) */
     int32_t e0_a, e0_b, e1_a, e1_b;
-    int64_t e0_step_x, e0_step_y, e1_step_x, e1_step_y;
-
-    /* Edge anti-aliasing: edge lengths in mesh fixed-point space */
-    int32_t e0_len, e1_len, e2_len;
-
-    /* UV interpolation gradients (fixed-point) */
-    int32_t du_dx, dv_dx, du_dy, dv_dy;
 
     if (dest_buf == NULL || buf_area == NULL || clip_area == NULL ||
             src_buf == NULL || v0 == NULL || v1 == NULL || v2 == NULL ||
@@ -726,30 +1084,42 @@ void gfx_sw_blend_img_triangle_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stri
      *   E1(x,y) = (x - v2x)*(v0y - v2y) - (y - v2y)*(v0x - v2x)
      *   dE1/dx = (v0y - v2y) = e1_a
      *   dE1/dy = (v2x - v0x) = e1_b
+     *
+     * E2 = area_2x - E0 - E1, so its steps are the negated sums.
      */
     e0_a = (int32_t)(v2->y - v1->y);
     e0_b = (int32_t)(v1->x - v2->x);
     e1_a = (int32_t)(v0->y - v2->y);
     e1_b = (int32_t)(v2->x - v0->x);
-    e0_step_x = (int64_t)e0_a * XY_SUB_ONE;
-    e0_step_y = (int64_t)e0_b * XY_SUB_ONE;
-    e1_step_x = (int64_t)e1_a * XY_SUB_ONE;
-    e1_step_y = (int64_t)e1_b * XY_SUB_ONE;
 
+    memset(&t, 0, sizeof(t));
+    t.backend = s_blend_backend;
+    t.tex = (gfx_blend_tex_t) {
+        .buf = src_buf,
+        .mask = mask,
+        .stride = src_stride,
+        .height = src_height,
+        .mask_stride = mask_stride,
+    };
+    t.area_2x = area_2x;
+    t.step_x[0] = (int64_t)e0_a * XY_SUB_ONE;
+    t.step_y[0] = (int64_t)e0_b * XY_SUB_ONE;
+    t.step_x[1] = (int64_t)e1_a * XY_SUB_ONE;
+    t.step_y[1] = (int64_t)e1_b * XY_SUB_ONE;
+    t.step_x[2] = -(t.step_x[0] + t.step_x[1]);
+    t.step_y[2] = -(t.step_y[0] + t.step_y[1]);
+
+    /* Edge anti-aliasing: edge lengths in mesh fixed-point space */
     {
         int32_t e2_a = -(e0_a + e1_a);
         int32_t e2_b = -(e0_b + e1_b);
-        e0_len = gfx_sw_blend_isqrt_i64((uint64_t)((int64_t)e0_a * e0_a + (int64_t)e0_b * e0_b));
-        e1_len = gfx_sw_blend_isqrt_i64((uint64_t)((int64_t)e1_a * e1_a + (int64_t)e1_b * e1_b));
-        e2_len = gfx_sw_blend_isqrt_i64((uint64_t)((int64_t)e2_a * e2_a + (int64_t)e2_b * e2_b));
-        if (e0_len < 1) {
-            e0_len = 1;
-        }
-        if (e1_len < 1) {
-            e1_len = 1;
-        }
-        if (e2_len < 1) {
-            e2_len = 1;
+        t.len[0] = gfx_sw_blend_isqrt_i64((uint64_t)((int64_t)e0_a * e0_a + (int64_t)e0_b * e0_b));
+        t.len[1] = gfx_sw_blend_isqrt_i64((uint64_t)((int64_t)e1_a * e1_a + (int64_t)e1_b * e1_b));
+        t.len[2] = gfx_sw_blend_isqrt_i64((uint64_t)((int64_t)e2_a * e2_a + (int64_t)e2_b * e2_b));
+        for (int i = 0; i < 3; i++) {
+            if (t.len[i] < 1) {
+                t.len[i] = 1;
+            }
         }
     }
 
@@ -761,22 +1131,32 @@ void gfx_sw_blend_img_triangle_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stri
      * du/dx = (e0_a * u0 + e1_a * u1 + (-e0_a - e1_a) * u2) / area_2x
      *       = (e0_a * (u0 - u2) + e1_a * (u1 - u2)) / area_2x
      *
-     * We compute in fixed-point by shifting numerator up by FRAC_BITS.
+     * We compute in fixed-point by shifting numerator up by TRI_FRAC_BITS.
      */
     {
         int64_t num;
 
-        num = e0_step_x * (v0->u - v2->u) + e1_step_x * (v1->u - v2->u);
-        du_dx = (int32_t)((num << FRAC_BITS) / area_2x);
+        num = t.step_x[0] * (v0->u - v2->u) + t.step_x[1] * (v1->u - v2->u);
+        t.du_dx = (int32_t)((num << TRI_FRAC_BITS) / area_2x);
+
+        num = t.step_x[0] * (v0->v - v2->v) + t.step_x[1] * (v1->v - v2->v);
+        t.dv_dx = (int32_t)((num << TRI_FRAC_BITS) / area_2x);
 
-        num = e0_step_x * (v0->v - v2->v) + e1_step_x * (v1->v - v2->v);
-        dv_dx = (int32_t)((num << FRAC_BITS) / area_2x);
+        num = t.step_y[0] * (v0->u - v2->u) + t.step_y[1] * (v1->u - v2->u);
+        t.du_dy = (int32_t)((num << TRI_FRAC_BITS) / area_2x);
 
-        num = e0_step_y * (v0->u - v2->u) + e1_step_y * (v1->u - v2->u);
-        du_dy = (int32_t)((num << FRAC_BITS) / area_2x);
+        num = t.step_y[0] * (v0->v - v2->v) + t.step_y[1] * (v1->v - v2->v);
+        t.dv_dy = (int32_t)((num << TRI_FRAC_BITS) / area_2x);
+    }
 
-        num = e0_step_y * (v0->v - v2->v) + e1_step_y * (v1->v - v2->v);
-        dv_dy = (int32_t)((num << FRAC_BITS) / area_2x);
+    t.inward = (internal_edges & GFX_BLEND_TRI_AA_INWARD) != 0;
+    t.internal_edges = internal_edges;
+    t.opa = opa;
+    t.swap = swap;
+    t.xaa_edges = extra_aa_edges;
+    t.xaa_n = (t.inward && extra_aa_edges != NULL) ? extra_aa_count : 0;
+    if (t.xaa_n > GFX_BLEND_MAX_EXTRA_AA_EDGES) {
+        t.xaa_n = GFX_BLEND_MAX_EXTRA_AA_EDGES;
     }
 
     /*
@@ -785,219 +1165,70 @@ void gfx_sw_blend_img_triangle_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stri
     {
         int32_t sample_x_q8 = min_x * XY_SUB_ONE + XY_SUB_HALF;
         int32_t sample_y_q8 = min_y * XY_SUB_ONE + XY_SUB_HALF;
-        int64_t w0_row = (int64_t)(sample_x_q8 - v1->x) * e0_a + (int64_t)(sample_y_q8 - v1->y) * e0_b;
-        int64_t w1_row = (int64_t)(sample_x_q8 - v2->x) * e1_a + (int64_t)(sample_y_q8 - v2->y) * e1_b;
+        int64_t w0_org = (int64_t)(sample_x_q8 - v1->x) * e0_a + (int64_t)(sample_y_q8 - v1->y) * e0_b;
+        int64_t w1_org = (int64_t)(sample_x_q8 - v2->x) * e1_a + (int64_t)(sample_y_q8 - v2->y) * e1_b;
 
         /* UV at starting point (fixed-point) */
-        int64_t u_start_num = (int64_t)w0_row * v0->u + (int64_t)w1_row * v1->u
-                              + (int64_t)(area_2x - w0_row - w1_row) * v2->u;
-        int64_t v_start_num = (int64_t)w0_row * v0->v + (int64_t)w1_row * v1->v
-                              + (int64_t)(area_2x - w0_row - w1_row) * v2->v;
-        int32_t u_row = (int32_t)((u_start_num << FRAC_BITS) / area_2x);
-        int32_t v_row = (int32_t)((v_start_num << FRAC_BITS) / area_2x);
-
-        const bool inward = (internal_edges & GFX_BLEND_TRI_AA_INWARD) != 0;
-        uint8_t xaa_n = (inward && extra_aa_edges != NULL) ? extra_aa_count : 0;
-        if (xaa_n > GFX_BLEND_MAX_EXTRA_AA_EDGES) {
-            xaa_n = GFX_BLEND_MAX_EXTRA_AA_EDGES;
-        }
-        int64_t xaa_row[GFX_BLEND_MAX_EXTRA_AA_EDGES];
-        int64_t xaa_sx[GFX_BLEND_MAX_EXTRA_AA_EDGES];
-        int64_t xaa_sy[GFX_BLEND_MAX_EXTRA_AA_EDGES];
-        for (uint8_t ei = 0; ei < xaa_n; ei++) {
-            xaa_sx[ei] = (int64_t)extra_aa_edges[ei].a * XY_SUB_ONE;
-            xaa_sy[ei] = (int64_t)extra_aa_edges[ei].b * XY_SUB_ONE;
-            xaa_row[ei] = (int64_t)(sample_x_q8 - extra_aa_edges[ei].vx) * extra_aa_edges[ei].a
-                          + (int64_t)(sample_y_q8 - extra_aa_edges[ei].vy) * extra_aa_edges[ei].b;
+        int64_t u_start_num = (int64_t)w0_org * v0->u + (int64_t)w1_org * v1->u
+                              + (int64_t)(area_2x - w0_org - w1_org) * v2->u;
+        int64_t v_start_num = (int64_t)w0_org * v0->v + (int64_t)w1_org * v1->v
+                              + (int64_t)(area_2x - w0_org - w1_org) * v2->v;
+
+        t.x0 = min_x;
+        t.y0 = min_y;
+        t.org.w0 = w0_org;
+        t.org.w1 = w1_org;
+        t.org.u = (int32_t)((u_start_num << TRI_FRAC_BITS) / area_2x);
+        t.org.v = (int32_t)((v_start_num << TRI_FRAC_BITS) / area_2x);
+        for (uint8_t ei = 0; ei < t.xaa_n; ei++) {
+            t.xaa_sx[ei] = (int64_t)extra_aa_edges[ei].a * XY_SUB_ONE;
+            t.xaa_sy[ei] = (int64_t)extra_aa_edges[ei].b * XY_SUB_ONE;
+            t.org.xaa[ei] = (int64_t)(sample_x_q8 - extra_aa_edges[ei].vx) * extra_aa_edges[ei].a
+                            + (int64_t)(sample_y_q8 - extra_aa_edges[ei].vy) * extra_aa_edges[ei].b;
         }
+    }
 
-        for (int32_t y = min_y; y <= max_y; y++) {
-            int64_t w0 = w0_row;
-            int64_t w1 = w1_row;
-            int32_t u_cur = u_row;
-            int32_t v_cur = v_row;
-            int64_t xaa[GFX_BLEND_MAX_EXTRA_AA_EDGES];
-            for (uint8_t ei = 0; ei < xaa_n; ei++) {
-                xaa[ei] = xaa_row[ei];
+    for (int32_t by = min_y; by <= max_y; by += TRI_BLOCK) {
+        const int32_t bh = MIN(TRI_BLOCK, max_y - by + 1);
+
+        for (int32_t gx = min_x; gx <= max_x; gx += TRI_BLOCK * TRI_BLOCK_GROUP) {
+            gfx_sw_blend_tri_block_t cls[TRI_BLOCK_GROUP];
+            int32_t nblk = 0;
+            const int32_t g_end = MIN(gx + TRI_BLOCK * TRI_BLOCK_GROUP - 1, max_x);
+
+            for (int32_t bx = gx; bx <= g_end; bx += TRI_BLOCK) {
+                gfx_sw_blend_tri_px_t px;
+                gfx_sw_blend_tri_eval(&t, bx, by, &px);
+                cls[nblk++] = gfx_sw_blend_tri_classify(&t, &px, MIN(TRI_BLOCK, g_end - bx + 1), bh);
             }
-            gfx_color_t *dst_row = dest_buf + (size_t)(y - buf_area->y1) * dest_stride
-                                   + (size_t)(min_x - buf_area->x1);
-
-            for (int32_t x = min_x; x <= max_x; x++) {
-                int64_t w2 = area_2x - w0 - w1;
-
-                if (gfx_sw_blend_triangle_sample_inside(area_2x, w0, w1, w2)) {
-                    /* Inside triangle */
-                    int32_t src_x = (u_cur + FRAC_HALF) >> FRAC_BITS;
-                    int32_t src_y = (v_cur + FRAC_HALF) >> FRAC_BITS;
-                    src_x = gfx_sw_blend_clamp_coord(src_x, 0, src_stride - 1);
-                    src_y = gfx_sw_blend_clamp_coord(src_y, 0, src_height - 1);
-                    gfx_color_t src_color = src_buf[(size_t)src_y * src_stride + (size_t)src_x];
-                    gfx_opa_t final_opa = opa;
-
-                    /* Inward AA: fade pixels near non-internal outer edges */
-                    if (inward) {
-                        int32_t min_id = GFX_BLEND_TRI_EDGE_AA_RANGE;
-                        uint8_t emask = internal_edges & 0x07;
-                        if (area_2x > 0) {
-                            if (!(emask & 0x01)) {
-                                int32_t d = (int32_t)(w0 / e0_len);
-                                if (d < min_id) {
-                                    min_id = d;
-                                }
-                            }
-                            if (!(emask & 0x02)) {
-                                int32_t d = (int32_t)(w1 / e1_len);
-                                if (d < min_id) {
-                                    min_id = d;
-                                }
-                            }
-                            if (!(emask & 0x04)) {
-                                int32_t d = (int32_t)(w2 / e2_len);
-                                if (d < min_id) {
-                                    min_id = d;
-                                }
-                            }
-                            for (uint8_t ei = 0; ei < xaa_n; ei++) {
-                                int32_t d = (int32_t)(xaa[ei] / extra_aa_edges[ei].len);
-                                if (d < min_id) {
-                                    min_id = d;
-                                }
-                            }
-                        } else {
-                            if (!(emask & 0x01)) {
-                                int32_t d = (int32_t)((-w0) / e0_len);
-                                if (d < min_id) {
-                                    min_id = d;
-                                }
-                            }
-                            if (!(emask & 0x02)) {
-                                int32_t d = (int32_t)((-w1) / e1_len);
-                                if (d < min_id) {
-                                    min_id = d;
-                                }
-                            }
-                            if (!(emask & 0x04)) {
-                                int32_t d = (int32_t)((-w2) / e2_len);
-                                if (d < min_id) {
-                                    min_id = d;
-                                }
-                            }
-                            for (uint8_t ei = 0; ei < xaa_n; ei++) {
-                                int32_t d = (int32_t)((-xaa[ei]) / extra_aa_edges[ei].len);
-                                if (d < min_id) {
-                                    min_id = d;
-                                }
-                            }
-                        }
-                        if (min_id < GFX_BLEND_TRI_EDGE_AA_RANGE) {
-                            gfx_opa_t edge_opa = (gfx_opa_t)((int32_t)min_id * 255 / GFX_BLEND_TRI_EDGE_AA_RANGE);
-                            final_opa = (gfx_opa_t)(((uint32_t)final_opa * edge_opa + 128U) >> 8);
-                            if (final_opa == 0U) {
-                                goto next_pixel;
-                            }
-                        }
-                    }
 
-                    if (mask != NULL) {
-                        gfx_opa_t src_opa = mask[(size_t)src_y * mask_stride + (size_t)src_x];
-                        final_opa = (gfx_opa_t)(((uint32_t)final_opa * src_opa + 128) >> 8);
-                    }
-                    if (final_opa == 0U) {
-                        goto next_pixel;
-                    } else if (final_opa >= OPA_COVER) {
-                        *dst_row = src_color;
-                    } else {
-                        *dst_row = gfx_blend_color_mix(src_color, *dst_row, final_opa, swap);
-                    }
-                } else {
-                    /* Outside triangle */
-                    if (inward) {
-                        goto next_pixel;
-                    }
-                    /* Outward edge AA: blend if within 1 px.
-                     * Skip distance for edges flagged as internal (shared
-                     * with an adjacent triangle) to avoid dark-seam artifacts.
-                     * Bit 0 = edge 0 (v1→v2), bit 1 = edge 1 (v2→v0),
-                     * bit 2 = edge 2 (v0→v1). */
-                    int32_t max_od = 0;
-                    if (area_2x > 0) {
-                        if (w0 < 0 && !(internal_edges & 0x01)) {
-                            int32_t d = (int32_t)((-w0) / e0_len);
-                            if (d > max_od) {
-                                max_od = d;
-                            }
-                        }
-                        if (w1 < 0 && !(internal_edges & 0x02)) {
-                            int32_t d = (int32_t)((-w1) / e1_len);
-                            if (d > max_od) {
-                                max_od = d;
-                            }
-                        }
-                        if (w2 < 0 && !(internal_edges & 0x04)) {
-                            int32_t d = (int32_t)((-w2) / e2_len);
-                            if (d > max_od) {
-                                max_od = d;
-                            }
-                        }
-                    } else {
-                        if (w0 > 0 && !(internal_edges & 0x01)) {
-                            int32_t d = (int32_t)(w0 / e0_len);
-                            if (d > max_od) {
-                                max_od = d;
-                            }
-                        }
-                        if (w1 > 0 && !(internal_edges & 0x02)) {
-                            int32_t d = (int32_t)(w1 / e1_len);
-                            if (d > max_od) {
-                                max_od = d;
-                            }
-                        }
-                        if (w2 > 0 && !(internal_edges & 0x04)) {
-                            int32_t d = (int32_t)(w2 / e2_len);
-                            if (d > max_od) {
-                                max_od = d;
-                            }
-                        }
+            for (int32_t y = by; y < by + bh; y++) {
+                gfx_color_t *dst_row = dest_buf + (size_t)(y - buf_area->y1) * dest_stride;
+
+                /* Neighbouring blocks of the same class are handled as one run */
+                for (int32_t bi = 0; bi < nblk;) {
+                    int32_t bj = bi + 1;
+                    while (bj < nblk && cls[bj] == cls[bi]) {
+                        bj++;
                     }
+                    const int32_t x = gx + bi * TRI_BLOCK;
+                    const int32_t x_end = MIN(gx + bj * TRI_BLOCK - 1, g_end);
 
-                    if (max_od > 0 && max_od < GFX_BLEND_TRI_EDGE_AA_RANGE) {
-                        gfx_opa_t aa_opa = (gfx_opa_t)((GFX_BLEND_TRI_EDGE_AA_RANGE - max_od) * 255 / GFX_BLEND_TRI_EDGE_AA_RANGE);
-                        int32_t src_x = (u_cur + FRAC_HALF) >> FRAC_BITS;
-                        int32_t src_y = (v_cur + FRAC_HALF) >> FRAC_BITS;
-                        src_x = gfx_sw_blend_clamp_coord(src_x, 0, src_stride - 1);
-                        src_y = gfx_sw_blend_clamp_coord(src_y, 0, src_height - 1);
-                        gfx_color_t src_color = src_buf[(size_t)src_y * src_stride + (size_t)src_x];
-                        if (opa < OPA_COVER) {
-                            aa_opa = (gfx_opa_t)(((uint32_t)aa_opa * opa + 128U) >> 8);
-                        }
-                        if (mask != NULL) {
-                            gfx_opa_t src_opa = mask[(size_t)src_y * mask_stride + (size_t)src_x];
-                            aa_opa = (gfx_opa_t)(((uint32_t)aa_opa * src_opa + 128) >> 8);
-                        }
-                        if (aa_opa > 0) {
-                            *dst_row = gfx_blend_color_mix(src_color, *dst_row, aa_opa, swap);
+                    if (cls[bi] != GFX_SW_BLEND_TRI_BLOCK_SKIP) {
+                        gfx_sw_blend_tri_px_t px;
+                        gfx_color_t *dst = dst_row + (x - buf_area->x1);
+
+                        gfx_sw_blend_tri_eval(&t, x, y, &px);
+                        if (cls[bi] == GFX_SW_BLEND_TRI_BLOCK_ACCEPT) {
+                            t.backend->tri_span(dst, x_end - x + 1, &t.tex, px.u, px.v, t.du_dx, t.dv_dx, opa, swap);
+                            perf_accept_pixels += (uint64_t)(x_end - x + 1);
+                        } else {
+                            gfx_sw_blend_tri_edge_run(&t, dst, x, x_end, px);
+                            perf_edge_pixels += (uint64_t)(x_end - x + 1);
                         }
                     }
+                    bi = bj;
                 }
-
-next_pixel:
-                w0 += e0_step_x;
-                w1 += e1_step_x;
-                u_cur += du_dx;
-                v_cur += dv_dx;
-                for (uint8_t ei = 0; ei < xaa_n; ei++) {
-                    xaa[ei] += xaa_sx[ei];
-                }
-                dst_row++;
-            }
-
-            w0_row += e0_step_y;
-            w1_row += e1_step_y;
-            u_row += du_dy;
-            v_row += dv_dy;
-            for (uint8_t ei = 0; ei < xaa_n; ei++) {
-                xaa_row[ei] += xaa_sy[ei];
             }
         }
     }
@@ -1006,10 +1237,10 @@ next_pixel:
         s_active_perf_stats->triangle_draw.calls++;
         s_active_perf_stats->triangle_draw.pixels += perf_raster_pixels;
         s_active_perf_stats->triangle_draw.time_us += gfx_blend_perf_elapsed_us(perf_start_us);
+        s_active_perf_stats->triangle_covered_pixels += perf_accept_pixels + perf_edge_pixels;
+        s_active_perf_stats->triangle_aa_pixels += perf_edge_pixels;
     }
 
-#undef FRAC_BITS
-#undef FRAC_HALF
 #undef XY_SUB_ONE
 #undef XY_SUB_HALF
 }
@@ -1020,6 +1251,7 @@ void gfx_sw_blend_polygon_fill(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
                                gfx_opa_t opa,
                                const int32_t *vx, const int32_t *vy,
                                int vertex_count,
+                               gfx_sw_blend_fill_rule_t rule,
                                bool swap)
 {
     int64_t perf_start_us = 0;
@@ -1034,9 +1266,8 @@ void gfx_sw_blend_polygon_fill(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
         perf_start_us = esp_timer_get_time();
     }
 
-    gfx_sw_blend_polygon_fill_scanline_fallback(dest_buf, dest_stride,
-            buf_area, clip_area,
-            color, opa, vx, vy, vertex_count, swap);
+    gfx_sw_blend_polygon_fill_aet(dest_buf, dest_stride, buf_area, clip_area,
+                                  color, opa, vx, vy, vertex_count, rule, swap);
 
     if (s_active_perf_stats != NULL) {
         s_active_perf_stats->triangle_draw.calls++;
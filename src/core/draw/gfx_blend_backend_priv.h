@@ -0,0 +1,200 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include "esp_err.h"
+#include "common/gfx_config_internal.h"
+#include "core/gfx_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Blend backends: the inner pixel loops of gfx_blend.c behind a table of
+ * kernels. The scalar backend is the reference; every other backend must
+ * produce bit-identical output (host_blend checks this). gfx_sw_blend_*()
+ * keep clipping, rasterization and perf accounting and call into the
+ * active backend for the per-pixel work.
+ */
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define GFX_BLEND_OPA_MAX     253  /* Mix ratios at or above this give the foreground color */
+#define GFX_BLEND_OPA_COVER   0xFF
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** Texture sampled by tri_span() */
+typedef struct {
+    const gfx_color_t *buf;
+    const gfx_opa_t *mask;      /**< Per-texel alpha, NULL when opaque */
+    gfx_coord_t stride;         /**< Texels per row (also the u clamp limit) */
+    gfx_coord_t height;         /**< Rows (v clamp limit) */
+    gfx_coord_t mask_stride;
+} gfx_blend_tex_t;
+
+typedef struct {
+    const char *name;
+
+    /** Write color (framebuffer byte order) to pixels consecutive entries */
+    void (*fill)(uint16_t *buf, uint16_t color, size_t pixels);
+
+    /** gfx_sw_blend_draw() body: solid color through an A8 mask, w x h already clipped */
+    void (*color_draw)(gfx_color_t *dest, gfx_coord_t dest_stride,
+                       const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                       int32_t w, int32_t h, gfx_color_t color, gfx_opa_t opa, bool swap);
+
+    /** gfx_sw_blend_img_draw() body: copy, or mix through mask when not NULL */
+    void (*image_draw)(gfx_color_t *dest, gfx_coord_t dest_stride,
+                       const gfx_color_t *src, gfx_coord_t src_stride,
+                       const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                       int32_t w, int32_t h, bool swap);
+
+    /**
+     * Premultiplied RGB565A8 body: dst * (1 - a) + src through mask, which is
+     * never NULL; alpha 0 leaves the pixel and 255 copies src
+     */
+    void (*premul_draw)(gfx_color_t *dest, gfx_coord_t dest_stride,
+                        const gfx_color_t *src, gfx_coord_t src_stride,
+                        const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                        int32_t w, int32_t h, bool swap);
+
+    /**
+     * Textured run fully inside a triangle: count pixels, texel at
+     * ((u + 0.5) >> 16, (v + 0.5) >> 16) clamped, stepping u/v by du/dv
+     */
+    void (*tri_span)(gfx_color_t *dest, int32_t count, const gfx_blend_tex_t *tex,
+                     int32_t u, int32_t v, int32_t du, int32_t dv, gfx_opa_t opa, bool swap);
+
+    /**
+     * Polygon coverage row: cov 0 leaves the pixel, >= GFX_BLEND_OPA_MAX
+     * writes the fill color, anything else mixes
+     */
+    void (*poly_span)(gfx_color_t *dest, const gfx_opa_t *cov, int32_t count,
+                      gfx_color_t color, bool swap);
+} gfx_blend_backend_t;
+
+/**********************
+ *   INTERNAL API
+ **********************/
+
+/**
+ * @brief RGB565 mix shared by every kernel; gfx_blend_color_mix() wraps it
+ *
+ * Both colors are in framebuffer byte order when swap is set. mix 0..3 returns
+ * c2 and 253..255 returns c1 exactly.
+ */
+static inline gfx_color_t gfx_blend_mix_rgb565(gfx_color_t c1, gfx_color_t c2, uint8_t mix, bool swap)
+{
+    gfx_color_t ret;
+
+    if (swap) {
+        c1.full = c1.full << 8 | c1.full >> 8;
+        c2.full = c2.full << 8 | c2.full >> 8;
+    }
+    /*Source: https://stackoverflow.com/a/50012418/1999969*/
+    mix = (uint32_t)((uint32_t)mix + 4) >> 3;
+    uint32_t bg = (uint32_t)((uint32_t)c2.full | ((uint32_t)c2.full << 16)) &
+                  0x7E0F81F; /*0b00000111111000001111100000011111*/
+    uint32_t fg = (uint32_t)((uint32_t)c1.full | ((uint32_t)c1.full << 16)) & 0x7E0F81F;
+    uint32_t result = ((((fg - bg) * mix) >> 5) + bg) & 0x7E0F81F;
+    ret.full = (uint16_t)((result >> 16) | result);
+    if (swap) {
+        ret.full = ret.full << 8 | ret.full >> 8;
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Premultiplied over: dst * (1 - alpha) + src, one multiply for all channels
+ *
+ * src is already scaled by alpha, so only dst is weighted. The 5-bit weight
+ * rounds down, which keeps every channel in range as long as src does not
+ * exceed what alpha allows (true for premultiplied data), so no saturation is
+ * needed. alpha 0 must be skipped by the caller.
+ */
+static inline gfx_color_t gfx_blend_premul_rgb565(gfx_color_t src, gfx_color_t dst, uint8_t alpha, bool swap)
+{
+    gfx_color_t ret;
+
+    if (swap) {
+        src.full = src.full << 8 | src.full >> 8;
+        dst.full = dst.full << 8 | dst.full >> 8;
+    }
+    uint32_t inv = (255U - (uint32_t)alpha) >> 3;
+    uint32_t bg = ((uint32_t)dst.full | ((uint32_t)dst.full << 16)) & 0x7E0F81F;
+    uint32_t fg = ((uint32_t)src.full | ((uint32_t)src.full << 16)) & 0x7E0F81F;
+    /* 0x2008010 adds half a step to each field before the shift */
+    uint32_t result = ((((bg * inv + 0x2008010U) >> 5) & 0x7E0F81F) + fg) & 0x7E0F81F;
+    ret.full = (uint16_t)((result >> 16) | result);
+    if (swap) {
+        ret.full = ret.full << 8 | ret.full >> 8;
+    }
+
+    return ret;
+}
+
+extern const gfx_blend_backend_t gfx_blend_backend_scalar;
+extern const gfx_blend_backend_t gfx_blend_backend_swar;
+#if GFX_BLEND_VECTOR
+extern const gfx_blend_backend_t gfx_blend_backend_vector;
+#endif
+
+/** Scalar kernels, for backends that only accelerate some entries */
+void gfx_blend_scalar_fill(uint16_t *buf, uint16_t color, size_t pixels);
+void gfx_blend_scalar_color_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                 const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                 int32_t w, int32_t h, gfx_color_t color, gfx_opa_t opa, bool swap);
+void gfx_blend_scalar_image_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                 const gfx_color_t *src, gfx_coord_t src_stride,
+                                 const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                 int32_t w, int32_t h, bool swap);
+void gfx_blend_scalar_premul_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                  const gfx_color_t *src, gfx_coord_t src_stride,
+                                  const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                  int32_t w, int32_t h, bool swap);
+void gfx_blend_scalar_tri_span(gfx_color_t *dest, int32_t count, const gfx_blend_tex_t *tex,
+                               int32_t u, int32_t v, int32_t du, int32_t dv, gfx_opa_t opa, bool swap);
+void gfx_blend_scalar_poly_span(gfx_color_t *dest, const gfx_opa_t *cov, int32_t count,
+                                gfx_color_t color, bool swap);
+
+/**
+ * @brief Backend used by gfx_sw_blend_*()
+ */
+const gfx_blend_backend_t *gfx_blend_backend_get(void);
+
+/**
+ * @brief Switch the active backend
+ *
+ * Call while nothing is rendering (before gfx_emote_init() or with the render
+ * lock held); stripe workers read the pointer without synchronization.
+ * @param backend Table with every kernel set, NULL for the built-in default
+ * @return ESP_OK, ESP_ERR_INVALID_ARG if a kernel is missing
+ */
+esp_err_t gfx_blend_backend_set(const gfx_blend_backend_t *backend);
+
+/**
+ * @brief Number of built-in backends (scalar first, then the optional ones)
+ */
+size_t gfx_blend_backend_count(void);
+
+/**
+ * @brief Built-in backend by index, NULL when out of range
+ */
+const gfx_blend_backend_t *gfx_blend_backend_at(size_t index);
+
+#ifdef __cplusplus
+}
+#endif
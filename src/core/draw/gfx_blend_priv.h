@@ -53,6 +53,18 @@ typedef struct {
     int32_t vy;    /**< reference vertex y (A.y, mesh subpixel) */
 } gfx_sw_blend_aa_edge_t;
 
+/** Which regions of a self-intersecting or nested polygon are inside */
+typedef enum {
+    GFX_SW_BLEND_FILL_EVEN_ODD = 0,     /**< Inside where a ray crosses an odd number of edges */
+    GFX_SW_BLEND_FILL_NONZERO,          /**< Inside where the winding number is not zero */
+} gfx_sw_blend_fill_rule_t;
+
+/** Heap scratch for polygons too big for the stack; grows to the largest fill seen */
+typedef struct {
+    void *buf;
+    size_t size;
+} gfx_blend_scratch_t;
+
 /**********************
  *      PRIVATE FUNCTIONS
  **********************/
@@ -124,6 +136,19 @@ void gfx_sw_blend_img_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
                            const gfx_opa_t *mask, gfx_coord_t mask_stride,
                            gfx_area_t *clip_area, bool swap);
 
+/**
+ * @brief Draw a premultiplied-alpha image onto a destination buffer
+ *
+ * Like gfx_sw_blend_img_draw() with a mask, but src colors are already scaled
+ * by their alpha (GFX_IMAGE_FLAGS_PREMULTIPLIED), so each pixel becomes
+ * dst * (1 - alpha) + src. Counted as image_draw in the perf stats.
+ * @param mask Alpha of every source pixel, must not be NULL
+ */
+void gfx_sw_blend_img_premul_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
+                                  const gfx_color_t *src_buf, gfx_coord_t src_stride,
+                                  const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                  gfx_area_t *clip_area, bool swap);
+
 /**
  * @brief Draw a textured triangle with edge anti-aliasing
  *
@@ -152,8 +177,11 @@ void gfx_sw_blend_img_triangle_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stri
  * @brief Scanline polygon fill with edge anti-aliasing.
  *
  * Fills a closed polygon defined by vertex arrays with a solid color.
- * Uses even-odd fill rule. Vertices are in mesh subpixel coordinates
- * (same as gfx_sw_blend_img_vertex_t x/y).
+ * Vertices are in mesh subpixel coordinates (same as
+ * gfx_sw_blend_img_vertex_t x/y). Edges are walked with an active edge
+ * table and each pixel's coverage is its exact covered area; interior runs
+ * are written with one fill. Any vertex count and clip width is accepted;
+ * large ones take their scratch from the heap.
  *
  * Designed for stroke outlines where no texture mapping is needed.
  */
@@ -163,11 +191,18 @@ void gfx_sw_blend_polygon_fill(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
                                gfx_opa_t opa,
                                const int32_t *vx, const int32_t *vy,
                                int vertex_count,
+                               gfx_sw_blend_fill_rule_t rule,
                                bool swap);
 
 void gfx_sw_blend_perf_reset(gfx_blend_perf_stats_t *stats);
 void gfx_sw_blend_perf_bind(gfx_blend_perf_stats_t *stats);
 void gfx_sw_blend_perf_unbind(void);
+/** Accumulate src counters into dst (used to fold stripe worker stats into the display) */
+void gfx_sw_blend_perf_merge(gfx_blend_perf_stats_t *dst, const gfx_blend_perf_stats_t *src);
+
+/** Bind the calling task's polygon scratch (NULL unbinds: large fills then malloc per call) */
+void gfx_sw_blend_scratch_bind(gfx_blend_scratch_t *scratch);
+void gfx_sw_blend_scratch_free(gfx_blend_scratch_t *scratch);
 
 #ifdef __cplusplus
 }
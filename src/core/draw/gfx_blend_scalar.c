@@ -0,0 +1,278 @@
+/*
+ * SPDX-FileCopyrightText: 2024-2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <string.h>
+
+#include "core/draw/gfx_blend_backend_priv.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define OPA_MAX      GFX_BLEND_OPA_MAX  /*Opacities above this will fully cover*/
+#define OPA_TRANSP   0
+#define OPA_COVER    GFX_BLEND_OPA_COVER
+
+#define TEX_FRAC_BITS   16
+#define TEX_FRAC_HALF   (1 << (TEX_FRAC_BITS - 1))
+
+#define FILL_NORMAL_MASK_PX(color, swap)                              \
+    if(*mask == OPA_COVER) *dest_buf = color;                \
+    else *dest_buf = gfx_blend_mix_rgb565(color, *dest_buf, *mask, swap);     \
+    mask++;                                                     \
+    dest_buf++;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const gfx_blend_backend_t gfx_blend_backend_scalar = {
+    .name = "scalar",
+    .fill = gfx_blend_scalar_fill,
+    .color_draw = gfx_blend_scalar_color_draw,
+    .image_draw = gfx_blend_scalar_image_draw,
+    .premul_draw = gfx_blend_scalar_premul_draw,
+    .tri_span = gfx_blend_scalar_tri_span,
+    .poly_span = gfx_blend_scalar_poly_span,
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline int32_t gfx_blend_scalar_clamp(int32_t value, int32_t max_value)
+{
+    if (value < 0) {
+        return 0;
+    }
+    if (value > max_value) {
+        return max_value;
+    }
+    return value;
+}
+
+/**********************
+ *   PUBLIC FUNCTIONS
+ **********************/
+
+void gfx_blend_scalar_fill(uint16_t *buf, uint16_t color, size_t pixels)
+{
+    if ((color & 0xFF) == (color >> 8)) {
+        memset(buf, color & 0xFF, pixels * sizeof(uint16_t));
+    } else {
+        uint32_t color32 = ((uint32_t)color << 16) | color;
+
+        if (((uintptr_t)buf & 0x3) && pixels > 0) {
+            *buf++ = color;
+            pixels--;
+        }
+
+        uint32_t *buf32 = (uint32_t *)buf;
+        size_t pairs = pixels / 2;
+
+        for (size_t i = 0; i < pairs; i++) {
+            buf32[i] = color32;
+        }
+
+        if (pixels & 1) {
+            buf[pixels - 1] = color;
+        }
+    }
+}
+
+void gfx_blend_scalar_color_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
+                                 const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                 int32_t w, int32_t h, gfx_color_t color, gfx_opa_t opa, bool swap)
+{
+    int32_t x, y;
+    uint32_t c32 = color.full + ((uint32_t)color.full << 16);
+
+    /*Only the mask matters*/
+    if (opa >= OPA_MAX) {
+        int32_t x_end4 = w - 4;
+
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w && ((uintptr_t)mask & 0x3); x++) {
+                FILL_NORMAL_MASK_PX(color, swap)
+            }
+
+            for (; x <= x_end4; x += 4) {
+                uint32_t mask32 = *((uint32_t *)mask);
+                if (mask32 == 0xFFFFFFFF) {
+                    if ((uintptr_t)dest_buf & 0x3) {
+                        dest_buf[0] = color;
+                        ((uint32_t *)(dest_buf + 1))[0] = c32;
+                        dest_buf[3] = color;
+                    } else {
+                        uint32_t *d32 = (uint32_t *)dest_buf;
+                        d32[0] = c32;
+                        d32[1] = c32;
+                    }
+                    dest_buf += 4;
+                    mask += 4;
+                } else if (mask32) {
+                    FILL_NORMAL_MASK_PX(color, swap)
+                    FILL_NORMAL_MASK_PX(color, swap)
+                    FILL_NORMAL_MASK_PX(color, swap)
+                    FILL_NORMAL_MASK_PX(color, swap)
+                } else { //transparent
+                    mask += 4;
+                    dest_buf += 4;
+                }
+            }
+
+            for (; x < w ; x++) {
+                FILL_NORMAL_MASK_PX(color, swap)
+            }
+            dest_buf += (dest_stride - w);
+            mask += (mask_stride - w);
+        }
+    } else { /*With opacity*/
+        /*Buffer the result color to avoid recalculating the same color*/
+        gfx_color_t last_dest_color;
+        gfx_color_t last_res_color;
+        gfx_opa_t last_mask = OPA_TRANSP;
+        last_dest_color.full = dest_buf[0].full;
+        last_res_color.full = dest_buf[0].full;
+        gfx_opa_t opa_tmp = OPA_TRANSP;
+
+        for (y = 0; y < h; y++) {
+            for (x = 0; x < w; x++) {
+                if (*mask) {
+                    if (*mask != last_mask) {
+                        opa_tmp = (*mask == OPA_COVER) ? opa : ((uint32_t)((uint32_t)(*mask) * opa) >> 8);
+                    }
+                    if (*mask != last_mask || last_dest_color.full != dest_buf[x].full) {
+                        if (opa_tmp == OPA_COVER) {
+                            last_res_color = color;
+                        } else {
+                            last_res_color = gfx_blend_mix_rgb565(color, dest_buf[x], opa_tmp, swap);
+                        }
+                        last_mask = *mask;
+                        last_dest_color.full = dest_buf[x].full;
+                    }
+                    dest_buf[x] = last_res_color;
+                }
+                mask++;
+            }
+            dest_buf += dest_stride;
+            mask += (mask_stride - w);
+        }
+    }
+}
+
+void gfx_blend_scalar_image_draw(gfx_color_t *dest_buf, gfx_coord_t dest_stride,
+                                 const gfx_color_t *src_buf, gfx_coord_t src_stride,
+                                 const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                 int32_t w, int32_t h, bool swap)
+{
+    int32_t x, y;
+
+    if (mask == NULL) {
+        /* src_buf is expected to already be in native framebuffer order */
+        size_t row_bytes = (size_t)w * sizeof(gfx_color_t);
+        for (y = 0; y < h; y++) {
+            memcpy(dest_buf, src_buf, row_bytes);
+            dest_buf += dest_stride;
+            src_buf += src_stride;
+        }
+        return;
+    }
+
+    gfx_color_t last_dest_color;
+    gfx_color_t last_res_color;
+    gfx_color_t last_src_color;
+    gfx_opa_t last_mask = OPA_TRANSP;
+    last_dest_color.full = dest_buf[0].full;
+    last_res_color.full = dest_buf[0].full;
+    last_src_color.full = src_buf[0].full;
+
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            if (*mask) {
+                if (*mask != last_mask || last_dest_color.full != dest_buf[x].full || last_src_color.full != src_buf[x].full) {
+                    if (*mask == OPA_COVER) {
+                        last_res_color = src_buf[x];
+                    } else {
+                        last_res_color = gfx_blend_mix_rgb565(src_buf[x], dest_buf[x], *mask, swap);
+                    }
+                    last_mask = *mask;
+                    last_dest_color.full = dest_buf[x].full;
+                    last_src_color.full = src_buf[x].full;
+                }
+                dest_buf[x] = last_res_color;
+            }
+            mask++;
+        }
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+        mask += (mask_stride - w);
+    }
+}
+
+void gfx_blend_scalar_premul_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                  const gfx_color_t *src, gfx_coord_t src_stride,
+                                  const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                  int32_t w, int32_t h, bool swap)
+{
+    for (int32_t y = 0; y < h; y++) {
+        for (int32_t x = 0; x < w; x++) {
+            if (mask[x] == OPA_COVER) {
+                dest[x] = src[x];
+            } else if (mask[x] != OPA_TRANSP) {
+                dest[x] = gfx_blend_premul_rgb565(src[x], dest[x], mask[x], swap);
+            }
+        }
+        dest += dest_stride;
+        src += src_stride;
+        mask += mask_stride;
+    }
+}
+
+void gfx_blend_scalar_tri_span(gfx_color_t *dest, int32_t count, const gfx_blend_tex_t *tex,
+                               int32_t u, int32_t v, int32_t du, int32_t dv, gfx_opa_t opa, bool swap)
+{
+    for (int32_t i = 0; i < count; i++, u += du, v += dv) {
+        int32_t src_x = gfx_blend_scalar_clamp((u + TEX_FRAC_HALF) >> TEX_FRAC_BITS, tex->stride - 1);
+        int32_t src_y = gfx_blend_scalar_clamp((v + TEX_FRAC_HALF) >> TEX_FRAC_BITS, tex->height - 1);
+        gfx_color_t src_color = tex->buf[(size_t)src_y * tex->stride + (size_t)src_x];
+        gfx_opa_t final_opa = opa;
+
+        if (tex->mask != NULL) {
+            gfx_opa_t src_opa = tex->mask[(size_t)src_y * tex->mask_stride + (size_t)src_x];
+            final_opa = (gfx_opa_t)(((uint32_t)final_opa * src_opa + 128) >> 8);
+        }
+        if (final_opa == 0U) {
+            continue;
+        } else if (final_opa >= OPA_COVER) {
+            dest[i] = src_color;
+        } else {
+            dest[i] = gfx_blend_mix_rgb565(src_color, dest[i], final_opa, swap);
+        }
+    }
+}
+
+void gfx_blend_scalar_poly_span(gfx_color_t *dest, const gfx_opa_t *cov, int32_t count,
+                                gfx_color_t color, bool swap)
+{
+    gfx_color_t fill = color;
+
+    if (swap) {
+        fill.full = (uint16_t)(fill.full << 8 | fill.full >> 8);
+    }
+
+    for (int32_t i = 0; i < count; i++) {
+        if (cov[i] >= OPA_MAX) {
+            dest[i] = fill;
+        } else if (cov[i] > 0U) {
+            dest[i] = gfx_blend_mix_rgb565(color, dest[i], cov[i], swap);
+        }
+    }
+}
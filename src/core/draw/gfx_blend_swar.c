@@ -0,0 +1,268 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <string.h>
+
+#include "core/draw/gfx_blend_backend_priv.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*
+ * Two RGB565 pixels per 32-bit word, pixel 0 in the low half. When both share
+ * a mix ratio the word is split into two groups whose fields never collide
+ * under a 5-bit multiply:
+ *   LO = p0.B [0:4]  p0.R [11:15]  p1.G [21:26]
+ *   HI = p0.G [0:5]  p1.B [11:15]  p1.R [22:26]   (word >> 5)
+ * LO has the same layout as the single-pixel 0x7E0F81F spread, so each field
+ * comes out exactly as gfx_blend_mix_rgb565() would produce it.
+ */
+#define SWAR_LO_MASK    0x07E0F81FU
+#define SWAR_HI_MASK    0x07C0F83FU
+#define SWAR_PX_MASK    0x07E0F81FU
+
+#define OPA_MAX         GFX_BLEND_OPA_MAX
+#define OPA_COVER       GFX_BLEND_OPA_COVER
+
+#define SWAR_QUAD       4   /* Alpha bytes tested with one word compare */
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void gfx_blend_swar_color_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                      const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                      int32_t w, int32_t h, gfx_color_t color, gfx_opa_t opa, bool swap);
+static void gfx_blend_swar_image_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                      const gfx_color_t *src, gfx_coord_t src_stride,
+                                      const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                      int32_t w, int32_t h, bool swap);
+static void gfx_blend_swar_premul_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                       const gfx_color_t *src, gfx_coord_t src_stride,
+                                       const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                       int32_t w, int32_t h, bool swap);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+const gfx_blend_backend_t gfx_blend_backend_swar = {
+    .name = "swar",
+    .fill = gfx_blend_scalar_fill,
+    .color_draw = gfx_blend_swar_color_draw,
+    .image_draw = gfx_blend_swar_image_draw,
+    .premul_draw = gfx_blend_swar_premul_draw,
+    .tri_span = gfx_blend_scalar_tri_span,
+    .poly_span = gfx_blend_scalar_poly_span,
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/* Pixel pairs go through memcpy: the gfx_color_t buffers must not be read or written as uint32_t (strict aliasing) */
+static inline uint32_t gfx_blend_swar_load2(const gfx_color_t *p)
+{
+    uint32_t px2;
+
+    memcpy(&px2, p, sizeof(px2));
+    return px2;
+}
+
+static inline void gfx_blend_swar_store2(gfx_color_t *p, uint32_t px2)
+{
+    memcpy(p, &px2, sizeof(px2));
+}
+
+/* Byte-swap both halves: framebuffer order <-> RGB565, once per pixel pair */
+static inline uint32_t gfx_blend_swar_bswap2(uint32_t px2)
+{
+    return ((px2 >> 8) & 0x00FF00FFU) | ((px2 << 8) & 0xFF00FF00U);
+}
+
+/* Blend pairs fg over bg with mix ratios m0 (low pixel) and m1, both already in 0..32 */
+static inline uint32_t gfx_blend_swar_mix2(uint32_t fg, uint32_t bg, uint32_t m0, uint32_t m1)
+{
+    if (m0 == m1) {
+        uint32_t fa = fg & SWAR_LO_MASK;
+        uint32_t ba = bg & SWAR_LO_MASK;
+        uint32_t fb = (fg >> 5) & SWAR_HI_MASK;
+        uint32_t bb = (bg >> 5) & SWAR_HI_MASK;
+
+        fa = ((((fa - ba) * m0) >> 5) + ba) & SWAR_LO_MASK;
+        fb = ((((fb - bb) * m0) >> 5) + bb) & SWAR_HI_MASK;
+        return fa | (fb << 5);
+    }
+
+    /* Different ratios: one spread word per pixel, still one load/store per pair */
+    uint32_t f0 = ((fg & 0xFFFFU) | (fg << 16)) & SWAR_PX_MASK;
+    uint32_t b0 = ((bg & 0xFFFFU) | (bg << 16)) & SWAR_PX_MASK;
+    uint32_t f1 = ((fg >> 16) | (fg & 0xFFFF0000U)) & SWAR_PX_MASK;
+    uint32_t b1 = ((bg >> 16) | (bg & 0xFFFF0000U)) & SWAR_PX_MASK;
+
+    f0 = ((((f0 - b0) * m0) >> 5) + b0) & SWAR_PX_MASK;
+    f1 = ((((f1 - b1) * m1) >> 5) + b1) & SWAR_PX_MASK;
+    return ((f0 | (f0 >> 16)) & 0xFFFFU) | (f1 << 16) | (f1 & 0xFFFF0000U);
+}
+
+/* fg is already in RGB565 order; bg and the result are in framebuffer order */
+static inline uint32_t gfx_blend_swar_mix2_swap(uint32_t fg, uint32_t bg, uint32_t a0, uint32_t a1, bool swap)
+{
+    uint32_t res;
+
+    if (swap) {
+        bg = gfx_blend_swar_bswap2(bg);
+    }
+    res = gfx_blend_swar_mix2(fg, bg, (a0 + 4U) >> 3, (a1 + 4U) >> 3);
+    return swap ? gfx_blend_swar_bswap2(res) : res;
+}
+
+static inline gfx_opa_t gfx_blend_swar_scale(gfx_opa_t mask, gfx_opa_t opa)
+{
+    return (mask == OPA_COVER) ? opa : (gfx_opa_t)(((uint32_t)mask * opa) >> 8);
+}
+
+static void gfx_blend_swar_color_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                      const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                      int32_t w, int32_t h, gfx_color_t color, gfx_opa_t opa, bool swap)
+{
+    const bool scale = opa < OPA_MAX;
+    const uint32_t fg2 = (uint32_t)color.full * 0x00010001U;
+    const uint32_t fg2_565 = swap ? gfx_blend_swar_bswap2(fg2) : fg2;
+
+    for (int32_t y = 0; y < h; y++) {
+        gfx_color_t *d = dest;
+        const gfx_opa_t *m = mask;
+        int32_t n = w;
+
+        /* Peel one pixel so pairs are word aligned */
+        if (((uintptr_t)d & 0x3) && n > 0) {
+            if (*m != 0U) {
+                *d = gfx_blend_mix_rgb565(color, *d, scale ? gfx_blend_swar_scale(*m, opa) : *m, swap);
+            }
+            d++;
+            m++;
+            n--;
+        }
+
+        for (; n >= 2; n -= 2, d += 2, m += 2) {
+            uint32_t a0 = m[0];
+            uint32_t a1 = m[1];
+
+            if ((a0 | a1) == 0U) {
+                continue;
+            }
+            if (scale) {
+                a0 = gfx_blend_swar_scale((gfx_opa_t)a0, opa);
+                a1 = gfx_blend_swar_scale((gfx_opa_t)a1, opa);
+            } else if ((a0 & a1) == OPA_COVER) {
+                gfx_blend_swar_store2(d, fg2);
+                continue;
+            }
+            gfx_blend_swar_store2(d, gfx_blend_swar_mix2_swap(fg2_565, gfx_blend_swar_load2(d), a0, a1, swap));
+        }
+
+        if (n > 0 && *m != 0U) {
+            *d = gfx_blend_mix_rgb565(color, *d, scale ? gfx_blend_swar_scale(*m, opa) : *m, swap);
+        }
+        dest += dest_stride;
+        mask += mask_stride;
+    }
+}
+
+static void gfx_blend_swar_image_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                      const gfx_color_t *src, gfx_coord_t src_stride,
+                                      const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                      int32_t w, int32_t h, bool swap)
+{
+    if (mask == NULL) {
+        gfx_blend_scalar_image_draw(dest, dest_stride, src, src_stride, NULL, 0, w, h, swap);
+        return;
+    }
+
+    for (int32_t y = 0; y < h; y++) {
+        gfx_color_t *d = dest;
+        const gfx_color_t *s = src;
+        const gfx_opa_t *m = mask;
+        int32_t n = w;
+
+        if (((uintptr_t)d & 0x3) && n > 0) {
+            if (*m != 0U) {
+                *d = gfx_blend_mix_rgb565(*s, *d, *m, swap);
+            }
+            d++;
+            s++;
+            m++;
+            n--;
+        }
+
+        for (; n >= 2; n -= 2, d += 2, s += 2, m += 2) {
+            uint32_t a0 = m[0];
+            uint32_t a1 = m[1];
+
+            if ((a0 | a1) == 0U) {
+                continue;
+            }
+            /* src keeps its own alignment; memcpy reads the pair either way */
+            uint32_t fg = gfx_blend_swar_load2(s);
+            if ((a0 & a1) == OPA_COVER) {
+                gfx_blend_swar_store2(d, fg);
+                continue;
+            }
+            gfx_blend_swar_store2(d, gfx_blend_swar_mix2_swap(swap ? gfx_blend_swar_bswap2(fg) : fg,
+                                  gfx_blend_swar_load2(d), a0, a1, swap));
+        }
+
+        if (n > 0 && *m != 0U) {
+            *d = gfx_blend_mix_rgb565(*s, *d, *m, swap);
+        }
+        dest += dest_stride;
+        src += src_stride;
+        mask += mask_stride;
+    }
+}
+
+static void gfx_blend_swar_premul_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                       const gfx_color_t *src, gfx_coord_t src_stride,
+                                       const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                       int32_t w, int32_t h, bool swap)
+{
+    for (int32_t y = 0; y < h; y++) {
+        int32_t x = 0;
+
+        /* Icons are mostly fully transparent or fully opaque: settle 4 alphas per compare */
+        for (; x + SWAR_QUAD <= w; x += SWAR_QUAD) {
+            uint32_t a4;
+
+            memcpy(&a4, mask + x, sizeof(a4));
+            if (a4 == 0U) {
+                continue;
+            }
+            if (a4 == UINT32_MAX) {
+                memcpy(dest + x, src + x, SWAR_QUAD * sizeof(gfx_color_t));
+                continue;
+            }
+            for (int32_t i = x; i < x + SWAR_QUAD; i++) {
+                if (mask[i] != 0U) {
+                    dest[i] = gfx_blend_premul_rgb565(src[i], dest[i], mask[i], swap);
+                }
+            }
+        }
+        for (; x < w; x++) {
+            if (mask[x] != 0U) {
+                dest[x] = gfx_blend_premul_rgb565(src[x], dest[x], mask[x], swap);
+            }
+        }
+        dest += dest_stride;
+        src += src_stride;
+        mask += mask_stride;
+    }
+}
@@ -0,0 +1,298 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include <string.h>
+
+#include "core/draw/gfx_blend_backend_priv.h"
+
+#if GFX_BLEND_VECTOR
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*
+ * Four pixels per step in 32-bit lanes, i.e. one 128-bit register on SSE or
+ * NEON (wider vectors get split and end up slower than scalar). Uses the same
+ * 0x7E0F81F trick as gfx_blend_mix_rgb565() so results match the scalar
+ * kernels bit for bit.
+ * The memo caches of the scalar kernels are dropped: every lane is mixed,
+ * which is equivalent because mix(fg, bg, 0) == bg and mix(fg, bg, 255) == fg.
+ */
+#define VEC_LANES       4
+#define VEC_RB_G_MASK   0x7E0F81FU
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef uint32_t gfx_vec_u32_t __attribute__((vector_size(VEC_LANES * sizeof(uint32_t))));
+typedef int32_t gfx_vec_i32_t __attribute__((vector_size(VEC_LANES * sizeof(int32_t))));
+typedef uint16_t gfx_vec_u16_t __attribute__((vector_size(VEC_LANES * sizeof(uint16_t))));
+typedef uint8_t gfx_vec_u8_t __attribute__((vector_size(VEC_LANES * sizeof(uint8_t))));
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void gfx_blend_vec_color_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                     const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                     int32_t w, int32_t h, gfx_color_t color, gfx_opa_t opa, bool swap);
+static void gfx_blend_vec_image_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                     const gfx_color_t *src, gfx_coord_t src_stride,
+                                     const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                     int32_t w, int32_t h, bool swap);
+static void gfx_blend_vec_premul_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                      const gfx_color_t *src, gfx_coord_t src_stride,
+                                      const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                      int32_t w, int32_t h, bool swap);
+static void gfx_blend_vec_poly_span(gfx_color_t *dest, const gfx_opa_t *cov, int32_t count,
+                                    gfx_color_t color, bool swap);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+/* fill is already store-bound and tri_span is a texel gather: both stay scalar */
+const gfx_blend_backend_t gfx_blend_backend_vector = {
+    .name = "vector",
+    .fill = gfx_blend_scalar_fill,
+    .color_draw = gfx_blend_vec_color_draw,
+    .image_draw = gfx_blend_vec_image_draw,
+    .premul_draw = gfx_blend_vec_premul_draw,
+    .tri_span = gfx_blend_scalar_tri_span,
+    .poly_span = gfx_blend_vec_poly_span,
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static inline gfx_vec_u32_t gfx_blend_vec_load_px(const gfx_color_t *p)
+{
+    gfx_vec_u16_t v;
+
+    memcpy(&v, p, sizeof(v));
+    return __builtin_convertvector(v, gfx_vec_u32_t);
+}
+
+static inline void gfx_blend_vec_store_px(gfx_color_t *p, gfx_vec_u32_t px)
+{
+    gfx_vec_u16_t v = __builtin_convertvector(px, gfx_vec_u16_t);
+
+    memcpy(p, &v, sizeof(v));
+}
+
+static inline uint32_t gfx_blend_vec_peek_mask(const gfx_opa_t *m)
+{
+    uint32_t bits;
+
+    memcpy(&bits, m, sizeof(bits));
+    return bits;
+}
+
+static inline gfx_vec_u32_t gfx_blend_vec_load_mask(const gfx_opa_t *m)
+{
+    gfx_vec_u8_t v;
+
+    memcpy(&v, m, sizeof(v));
+    return __builtin_convertvector(v, gfx_vec_u32_t);
+}
+
+static inline gfx_vec_u32_t gfx_blend_vec_bswap(gfx_vec_u32_t c)
+{
+    return ((c << 8) | (c >> 8)) & 0xFFFFU;
+}
+
+static inline gfx_vec_u32_t gfx_blend_vec_select(gfx_vec_i32_t cond, gfx_vec_u32_t a, gfx_vec_u32_t b)
+{
+    gfx_vec_u32_t m = (gfx_vec_u32_t)cond;
+
+    return (a & m) | (b & ~m);
+}
+
+/* Lane-wise gfx_blend_mix_rgb565(); c1/c2 hold zero-extended 16-bit pixels */
+static inline gfx_vec_u32_t gfx_blend_vec_mix(gfx_vec_u32_t c1, gfx_vec_u32_t c2, gfx_vec_u32_t mix, bool swap)
+{
+    gfx_vec_u32_t fg, bg, res;
+
+    if (swap) {
+        c1 = gfx_blend_vec_bswap(c1);
+        c2 = gfx_blend_vec_bswap(c2);
+    }
+    mix = (mix + 4U) >> 3;
+    bg = (c2 | (c2 << 16)) & VEC_RB_G_MASK;
+    fg = (c1 | (c1 << 16)) & VEC_RB_G_MASK;
+    res = ((((fg - bg) * mix) >> 5) + bg) & VEC_RB_G_MASK;
+    res = ((res >> 16) | res) & 0xFFFFU;
+    if (swap) {
+        res = gfx_blend_vec_bswap(res);
+    }
+    return res;
+}
+
+/* Lane-wise gfx_blend_premul_rgb565(); lanes with alpha 0 keep c2 */
+static inline gfx_vec_u32_t gfx_blend_vec_premul(gfx_vec_u32_t c1, gfx_vec_u32_t c2, gfx_vec_u32_t alpha, bool swap)
+{
+    gfx_vec_u32_t fg, bg, res;
+
+    if (swap) {
+        c1 = gfx_blend_vec_bswap(c1);
+        c2 = gfx_blend_vec_bswap(c2);
+    }
+    bg = (c2 | (c2 << 16)) & VEC_RB_G_MASK;
+    fg = (c1 | (c1 << 16)) & VEC_RB_G_MASK;
+    res = ((((bg * ((255U - alpha) >> 3) + 0x2008010U) >> 5) & VEC_RB_G_MASK) + fg) & VEC_RB_G_MASK;
+    res = ((res >> 16) | res) & 0xFFFFU;
+    if (swap) {
+        res = gfx_blend_vec_bswap(res);
+        c2 = gfx_blend_vec_bswap(c2);
+    }
+    return gfx_blend_vec_select(alpha == 0U, c2, res);
+}
+
+static void gfx_blend_vec_color_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                     const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                     int32_t w, int32_t h, gfx_color_t color, gfx_opa_t opa, bool swap)
+{
+    const gfx_vec_u32_t fg = (gfx_vec_u32_t){0} + color.full;
+    const bool scale = opa < GFX_BLEND_OPA_MAX;
+
+    for (int32_t y = 0; y < h; y++) {
+        int32_t x = 0;
+
+        for (; x + VEC_LANES <= w; x += VEC_LANES) {
+            uint32_t bits = gfx_blend_vec_peek_mask(mask + x);
+            if (bits == 0U) {
+                continue;
+            }
+            if (bits == UINT32_MAX && !scale) {
+                gfx_blend_vec_store_px(dest + x, fg);
+                continue;
+            }
+            gfx_vec_u32_t m = gfx_blend_vec_load_mask(mask + x);
+            if (scale) {
+                m = gfx_blend_vec_select(m == 0xFFU, (gfx_vec_u32_t){0} + opa, (m * opa) >> 8);
+            }
+            gfx_blend_vec_store_px(dest + x, gfx_blend_vec_mix(fg, gfx_blend_vec_load_px(dest + x), m, swap));
+        }
+        for (; x < w; x++) {
+            gfx_opa_t m = mask[x];
+            if (m == 0U) {
+                continue;
+            }
+            if (scale) {
+                m = (m == GFX_BLEND_OPA_COVER) ? opa : (gfx_opa_t)(((uint32_t)m * opa) >> 8);
+            }
+            dest[x] = gfx_blend_mix_rgb565(color, dest[x], m, swap);
+        }
+        dest += dest_stride;
+        mask += mask_stride;
+    }
+}
+
+static void gfx_blend_vec_image_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                     const gfx_color_t *src, gfx_coord_t src_stride,
+                                     const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                     int32_t w, int32_t h, bool swap)
+{
+    if (mask == NULL) {
+        gfx_blend_scalar_image_draw(dest, dest_stride, src, src_stride, NULL, 0, w, h, swap);
+        return;
+    }
+
+    for (int32_t y = 0; y < h; y++) {
+        int32_t x = 0;
+
+        for (; x + VEC_LANES <= w; x += VEC_LANES) {
+            uint32_t bits = gfx_blend_vec_peek_mask(mask + x);
+            if (bits == 0U) {
+                continue;
+            }
+            if (bits == UINT32_MAX) {
+                memcpy(dest + x, src + x, VEC_LANES * sizeof(gfx_color_t));
+                continue;
+            }
+            gfx_blend_vec_store_px(dest + x, gfx_blend_vec_mix(gfx_blend_vec_load_px(src + x),
+                                   gfx_blend_vec_load_px(dest + x),
+                                   gfx_blend_vec_load_mask(mask + x), swap));
+        }
+        for (; x < w; x++) {
+            if (mask[x] != 0U) {
+                dest[x] = gfx_blend_mix_rgb565(src[x], dest[x], mask[x], swap);
+            }
+        }
+        dest += dest_stride;
+        src += src_stride;
+        mask += mask_stride;
+    }
+}
+
+static void gfx_blend_vec_premul_draw(gfx_color_t *dest, gfx_coord_t dest_stride,
+                                      const gfx_color_t *src, gfx_coord_t src_stride,
+                                      const gfx_opa_t *mask, gfx_coord_t mask_stride,
+                                      int32_t w, int32_t h, bool swap)
+{
+    for (int32_t y = 0; y < h; y++) {
+        int32_t x = 0;
+
+        for (; x + VEC_LANES <= w; x += VEC_LANES) {
+            uint32_t bits = gfx_blend_vec_peek_mask(mask + x);
+            if (bits == 0U) {
+                continue;
+            }
+            if (bits == UINT32_MAX) {
+                memcpy(dest + x, src + x, VEC_LANES * sizeof(gfx_color_t));
+                continue;
+            }
+            gfx_blend_vec_store_px(dest + x, gfx_blend_vec_premul(gfx_blend_vec_load_px(src + x),
+                                   gfx_blend_vec_load_px(dest + x),
+                                   gfx_blend_vec_load_mask(mask + x), swap));
+        }
+        for (; x < w; x++) {
+            if (mask[x] != 0U) {
+                dest[x] = gfx_blend_premul_rgb565(src[x], dest[x], mask[x], swap);
+            }
+        }
+        dest += dest_stride;
+        src += src_stride;
+        mask += mask_stride;
+    }
+}
+
+static void gfx_blend_vec_poly_span(gfx_color_t *dest, const gfx_opa_t *cov, int32_t count,
+                                    gfx_color_t color, bool swap)
+{
+    gfx_color_t fill = color;
+    int32_t i = 0;
+
+    if (swap) {
+        fill.full = (uint16_t)(fill.full << 8 | fill.full >> 8);
+    }
+    const gfx_vec_u32_t fg = (gfx_vec_u32_t){0} + color.full;
+    const gfx_vec_u32_t fill_v = (gfx_vec_u32_t){0} + fill.full;
+
+    for (; i + VEC_LANES <= count; i += VEC_LANES) {
+        uint32_t bits = gfx_blend_vec_peek_mask(cov + i);
+        if (bits == 0U) {
+            continue;
+        }
+        if (bits == UINT32_MAX) {
+            gfx_blend_vec_store_px(dest + i, fill_v);
+            continue;
+        }
+        gfx_vec_u32_t m = gfx_blend_vec_load_mask(cov + i);
+        gfx_vec_u32_t mixed = gfx_blend_vec_mix(fg, gfx_blend_vec_load_px(dest + i), m, swap);
+        gfx_blend_vec_store_px(dest + i, gfx_blend_vec_select(m >= GFX_BLEND_OPA_MAX, fill_v, mixed));
+    }
+    gfx_blend_scalar_poly_span(dest + i, cov + i, count - i, color, swap);
+}
+
+#endif /* GFX_BLEND_VECTOR */
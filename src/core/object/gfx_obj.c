@@ -1,5 +1,5 @@
 /*
- * SPDX-FileCopyrightText: 2024-2025 Espressif Systems (Shanghai) CO LTD
+ * SPDX-FileCopyrightText: 2024-2026 Espressif Systems (Shanghai) CO LTD
  *
  * SPDX-License-Identifier: Apache-2.0
  */
@@ -14,6 +14,7 @@
 #include "common/gfx_comm.h"
 #include "core/gfx_obj.h"
 #include "core/display/gfx_refr_priv.h"
+#include "core/runtime/gfx_cmd_priv.h"
 #include "core/runtime/gfx_core_priv.h"
 
 /**********************
@@ -37,6 +38,7 @@ static const char *TAG = "obj";
 static void gfx_obj_notify_aligned_dependents(gfx_obj_t *obj, uint8_t depth);
 static void gfx_obj_detach_aligned_dependents(gfx_obj_t *obj);
 static void gfx_obj_calc_pos_in_parent_internal(gfx_obj_t *obj, uint8_t depth);
+static void gfx_obj_delete_children(gfx_obj_t *obj);
 
 /**********************
  *   STATIC FUNCTIONS
@@ -48,10 +50,10 @@ static void gfx_obj_notify_aligned_dependents(gfx_obj_t *obj, uint8_t depth)
         return;
     }
 
-    for (gfx_obj_child_t *child = obj->disp->child_list; child != NULL; child = child->next) {
-        gfx_obj_t *child_obj = (gfx_obj_t *)child->src;
+    for (uint16_t i = 0; i < obj->disp->children.count; i++) {
+        gfx_obj_t *child_obj = obj->disp->children.objs[i];
 
-        if (child_obj == NULL || child_obj == obj) {
+        if (child_obj == obj) {
             continue;
         }
 
@@ -69,10 +71,10 @@ static void gfx_obj_detach_aligned_dependents(gfx_obj_t *obj)
         return;
     }
 
-    for (gfx_obj_child_t *child = obj->disp->child_list; child != NULL; child = child->next) {
-        gfx_obj_t *child_obj = (gfx_obj_t *)child->src;
+    for (uint16_t i = 0; i < obj->disp->children.count; i++) {
+        gfx_obj_t *child_obj = obj->disp->children.objs[i];
 
-        if (child_obj == NULL || child_obj == obj) {
+        if (child_obj == obj) {
             continue;
         }
 
@@ -102,6 +104,14 @@ static void gfx_obj_calc_pos_in_parent_internal(gfx_obj_t *obj, uint8_t depth)
     parent_w = gfx_disp_get_hor_res(obj->disp);
     parent_h = gfx_disp_get_ver_res(obj->disp);
 
+    if (obj->parent != NULL) {
+        gfx_obj_calc_pos_in_parent_internal(obj->parent, depth + 1);
+        origin_x = obj->parent->geometry.x;
+        origin_y = obj->parent->geometry.y;
+        parent_w = obj->parent->geometry.width;
+        parent_h = obj->parent->geometry.height;
+    }
+
     if (obj->align.target != NULL && obj->align.target != obj) {
         gfx_obj_t *target = obj->align.target;
 
@@ -114,9 +124,36 @@ static void gfx_obj_calc_pos_in_parent_internal(gfx_obj_t *obj, uint8_t depth)
         }
     }
 
-    gfx_obj_cal_aligned_pos(obj, parent_w, parent_h, &obj->geometry.x, &obj->geometry.y);
-    obj->geometry.x += origin_x;
-    obj->geometry.y += origin_y;
+    /* Resolve into locals and store once: stripe workers may read geometry concurrently */
+    gfx_coord_t x;
+    gfx_coord_t y;
+    if (obj->parent != NULL && !obj->align.enabled) {
+        x = obj->local.x;
+        y = obj->local.y;
+    } else {
+        gfx_obj_cal_aligned_pos(obj, parent_w, parent_h, &x, &y);
+    }
+    obj->geometry.x = x + origin_x;
+    obj->geometry.y = y + origin_y;
+}
+
+/** Delete every object whose parent is obj; a deletion may remove several slots, so rescan after each */
+static void gfx_obj_delete_children(gfx_obj_t *obj)
+{
+    bool found = true;
+
+    while (found) {
+        found = false;
+        for (uint16_t i = obj->disp->children.count; i-- > 0;) {
+            gfx_obj_t *child_obj = obj->disp->children.objs[i];
+
+            if (child_obj->parent == obj) {
+                gfx_obj_delete(child_obj);
+                found = true;
+                break;
+            }
+        }
+    }
 }
 
 /**********************
@@ -129,15 +166,21 @@ esp_err_t gfx_obj_set_pos(gfx_obj_t *obj, gfx_coord_t x, gfx_coord_t y)
 {
     GFX_RETURN_IF_NULL(obj, ESP_ERR_INVALID_ARG);
 
-    //invalidate the old position
-    gfx_obj_invalidate(obj);
+    gfx_coord_t old_x = obj->geometry.x;
+    gfx_coord_t old_y = obj->geometry.y;
 
-    obj->geometry.x = x;
-    obj->geometry.y = y;
     obj->align.enabled = false;
     obj->align.target = NULL;
-    //invalidate the new position
-    gfx_obj_invalidate(obj);
+    if (obj->parent != NULL) {
+        obj->local.x = x;
+        obj->local.y = y;
+        gfx_obj_calc_pos_in_parent(obj);
+    } else {
+        obj->geometry.x = x;
+        obj->geometry.y = y;
+    }
+    //invalidate the old and new position
+    gfx_obj_invalidate_move(obj, old_x, old_y);
     gfx_obj_notify_aligned_dependents(obj, 0);
     GFX_LOGD(TAG, "Set object position: (%d, %d)", x, y);
     return ESP_OK;
@@ -245,6 +288,153 @@ bool gfx_obj_get_visible(gfx_obj_t *obj)
     return obj->state.is_visible;
 }
 
+esp_err_t gfx_obj_set_cache_as_bitmap(gfx_obj_t *obj, bool enable)
+{
+    GFX_RETURN_IF_NULL(obj, ESP_ERR_INVALID_ARG);
+
+    if (obj->cache.enabled == enable) {
+        return ESP_OK;
+    }
+
+    obj->cache.enabled = enable;
+    if (!enable) {
+        gfx_obj_cache_free(obj);
+    }
+    /* Built by the render task on the next frame, after the update callbacks */
+    gfx_obj_invalidate(obj);
+
+    GFX_LOGD(TAG, "Set object bitmap cache: %s", enable ? "on" : "off");
+    return ESP_OK;
+}
+
+esp_err_t gfx_obj_set_parent(gfx_obj_t *obj, gfx_obj_t *parent)
+{
+    GFX_RETURN_IF_NULL(obj, ESP_ERR_INVALID_ARG);
+    GFX_RETURN_IF_NULL(obj->disp, ESP_ERR_INVALID_STATE);
+
+    if (parent != NULL) {
+        if (parent->type != GFX_OBJ_TYPE_CONTAINER || parent->disp != obj->disp) {
+            GFX_LOGW(TAG, "set parent: parent must be a container on the same display");
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (parent == obj || gfx_obj_is_ancestor(obj, parent)) {
+            GFX_LOGW(TAG, "set parent: parent cannot be the object or one of its children");
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    if (obj->parent == parent) {
+        return ESP_OK;
+    }
+
+    /* Keep the coordinates the caller gave, now read in the new parent's frame */
+    gfx_coord_t x;
+    gfx_coord_t y;
+    gfx_obj_get_pos(obj, &x, &y);
+
+    gfx_obj_invalidate(obj);
+    obj->parent = parent;
+    /* Last slot = in front of the new siblings */
+    int32_t slot = gfx_disp_find_child(obj->disp, obj);
+    if (slot >= 0) {
+        gfx_disp_move_child(obj->disp, (uint16_t)slot, obj->disp->children.count - 1);
+    }
+    obj->local.x = x;
+    obj->local.y = y;
+    if (parent == NULL && !obj->align.enabled) {
+        obj->geometry.x = x;
+        obj->geometry.y = y;
+    }
+    gfx_obj_calc_pos_in_parent(obj);
+    gfx_obj_invalidate(obj);
+    gfx_obj_notify_aligned_dependents(obj, 0);
+
+    GFX_LOGD(TAG, "Set object parent: %p", parent);
+    return ESP_OK;
+}
+
+gfx_obj_t *gfx_obj_get_parent(gfx_obj_t *obj)
+{
+    GFX_RETURN_IF_NULL(obj, NULL);
+    return obj->parent;
+}
+
+esp_err_t gfx_obj_set_index(gfx_obj_t *obj, uint16_t index)
+{
+    GFX_RETURN_IF_NULL(obj, ESP_ERR_INVALID_ARG);
+    GFX_RETURN_IF_NULL(obj->disp, ESP_ERR_INVALID_STATE);
+
+    gfx_disp_t *disp = obj->disp;
+    int32_t from = gfx_disp_find_child(disp, obj);
+    int32_t before = -1;
+    int32_t last = -1;
+    uint16_t seen = 0;
+
+    if (from < 0) {
+        GFX_LOGW(TAG, "set index: object not on its display");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* Slots of other objects in between belong to other containers and do not stack against obj */
+    for (uint16_t i = 0; i < disp->children.count; i++) {
+        gfx_obj_t *other = disp->children.objs[i];
+
+        if (other == obj || other->parent != obj->parent) {
+            continue;
+        }
+        if (seen++ == index) {
+            before = i;
+            break;
+        }
+        last = i;
+    }
+
+    int32_t to;
+    if (before >= 0) {
+        to = (from < before) ? before - 1 : before;
+    } else if (last >= 0) {
+        to = (from < last) ? last : last + 1;
+    } else {
+        to = from;
+    }
+    if (to == from) {
+        return ESP_OK;
+    }
+
+    gfx_disp_move_child(disp, (uint16_t)from, (uint16_t)to);
+    gfx_obj_invalidate(obj);
+    GFX_LOGD(TAG, "Set object index: %u (slot %d -> %d)", (unsigned)index, (int)from, (int)to);
+    return ESP_OK;
+}
+
+int32_t gfx_obj_get_index(gfx_obj_t *obj)
+{
+    GFX_RETURN_IF_NULL(obj, -1);
+    GFX_RETURN_IF_NULL(obj->disp, -1);
+
+    int32_t index = 0;
+    for (uint16_t i = 0; i < obj->disp->children.count; i++) {
+        gfx_obj_t *other = obj->disp->children.objs[i];
+
+        if (other == obj) {
+            return index;
+        }
+        if (other->parent == obj->parent) {
+            index++;
+        }
+    }
+    return -1;
+}
+
+esp_err_t gfx_obj_move_to_front(gfx_obj_t *obj)
+{
+    return gfx_obj_set_index(obj, UINT16_MAX);
+}
+
+esp_err_t gfx_obj_move_to_back(gfx_obj_t *obj)
+{
+    return gfx_obj_set_index(obj, 0);
+}
+
 void gfx_obj_update_layout(gfx_obj_t *obj)
 {
     GFX_RETURN_IF_NULL_VOID(obj);
@@ -371,6 +561,52 @@ void gfx_obj_calc_pos_in_parent(gfx_obj_t *obj)
     gfx_obj_calc_pos_in_parent_internal(obj, 0);
 }
 
+bool gfx_obj_is_ancestor(const gfx_obj_t *anc, const gfx_obj_t *obj)
+{
+    for (const gfx_obj_t *p = (obj != NULL) ? obj->parent : NULL; p != NULL; p = p->parent) {
+        if (p == anc) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool gfx_obj_get_ancestor_clip(gfx_obj_t *obj, gfx_area_t *out)
+{
+    GFX_RETURN_IF_NULL(obj, false);
+    GFX_RETURN_IF_NULL(out, false);
+
+    gfx_obj_calc_pos_in_parent(obj);
+    out->x1 = 0;
+    out->y1 = 0;
+    out->x2 = (gfx_coord_t)gfx_disp_get_hor_res(obj->disp) - 1;
+    out->y2 = (gfx_coord_t)gfx_disp_get_ver_res(obj->disp) - 1;
+
+    for (gfx_obj_t *p = obj->parent; p != NULL; p = p->parent) {
+        gfx_area_t bounds = {
+            p->geometry.x, p->geometry.y,
+            p->geometry.x + p->geometry.width - 1, p->geometry.y + p->geometry.height - 1
+        };
+        if (!p->state.is_visible || !gfx_area_intersect(out, out, &bounds)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void gfx_obj_cache_free(gfx_obj_t *obj)
+{
+    GFX_RETURN_IF_NULL_VOID(obj);
+
+    free(obj->cache.buf);
+    free(obj->cache.mask);
+    obj->cache.buf = NULL;
+    obj->cache.mask = NULL;
+    obj->cache.width = 0;
+    obj->cache.height = 0;
+    obj->cache.valid = false;
+}
+
 /* Generic getters */
 
 esp_err_t gfx_obj_get_pos(gfx_obj_t *obj, gfx_coord_t *x, gfx_coord_t *y)
@@ -381,6 +617,11 @@ esp_err_t gfx_obj_get_pos(gfx_obj_t *obj, gfx_coord_t *x, gfx_coord_t *y)
 
     *x = obj->geometry.x;
     *y = obj->geometry.y;
+    if (obj->parent != NULL) {
+        gfx_obj_calc_pos_in_parent(obj);
+        *x = obj->geometry.x - obj->parent->geometry.x;
+        *y = obj->geometry.y - obj->parent->geometry.y;
+    }
     return ESP_OK;
 }
 
@@ -434,7 +675,11 @@ esp_err_t gfx_obj_delete(gfx_obj_t *obj)
     GFX_RETURN_IF_NULL(obj, ESP_ERR_INVALID_ARG);
 
     if (GFX_NOT_NULL(obj->disp)) {
+        gfx_obj_delete_children(obj);
         gfx_disp_remove_child(obj->disp, obj);
+        if (GFX_NOT_NULL(obj->disp->ctx)) {
+            gfx_cmd_queue_cancel_obj(obj->disp->ctx, obj);
+        }
     }
 
     gfx_obj_detach_aligned_dependents(obj);
@@ -446,6 +691,7 @@ esp_err_t gfx_obj_delete(gfx_obj_t *obj)
         obj->vfunc.delete(obj);
     }
 
+    gfx_obj_cache_free(obj);
     free(obj);
     return ESP_OK;
 }
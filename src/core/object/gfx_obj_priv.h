@@ -7,7 +7,9 @@
 #pragma once
 
 #include <stdint.h>
+#include "common/gfx_config_internal.h"
 #include "core/gfx_obj.h"
+#include "core/gfx_disp.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,12 +36,14 @@ typedef struct gfx_draw_ctx {
     gfx_area_t clip_area;       /**< Half-open screen rect [x1, x2) x [y1, y2) for this draw pass */
     int stride;                 /**< Row stride in pixels (chunk width or h_res) */
     bool swap;                  /**< Color byte swap */
+    uint8_t stripe;             /**< 0 on the render task, i + 1 on stripe worker i; indexes per-stripe widget state */
 } gfx_draw_ctx_t;
 
 typedef esp_err_t (*gfx_obj_draw_fn_t)(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx);
 typedef esp_err_t (*gfx_obj_delete_fn_t)(gfx_obj_t *obj);
 typedef esp_err_t (*gfx_obj_update_fn_t)(gfx_obj_t *obj);
 typedef void (*gfx_obj_touch_fn_t)(gfx_obj_t *obj, const void *event);
+typedef bool (*gfx_obj_opaque_fn_t)(gfx_obj_t *obj);
 
 typedef struct gfx_widget_class {
     uint8_t type;                  /**< Stable object type id */
@@ -48,6 +52,7 @@ typedef struct gfx_widget_class {
     gfx_obj_delete_fn_t delete;    /**< Delete callback */
     gfx_obj_update_fn_t update;    /**< Update callback */
     gfx_obj_touch_fn_t touch_event;/**< Touch callback */
+    gfx_obj_opaque_fn_t is_opaque; /**< true = draw overwrites every pixel of geometry (optional) */
 } gfx_widget_class_t;
 
 struct gfx_obj {
@@ -63,6 +68,12 @@ struct gfx_obj {
         uint16_t height;        /**< Object height */
     } geometry;
 
+    gfx_obj_t *parent;          /**< Container this object is positioned in and clipped to; NULL = display */
+    struct {
+        gfx_coord_t x;          /**< Position inside parent when not aligned */
+        gfx_coord_t y;
+    } local;
+
     struct {
         uint8_t type;           /**< Alignment type (see GFX_ALIGN_* constants) */
         gfx_coord_t x_ofs;      /**< X offset for alignment */
@@ -82,8 +93,18 @@ struct gfx_obj {
         gfx_obj_delete_fn_t delete;   /**< Delete function pointer */
         gfx_obj_update_fn_t update;   /**< Update function pointer */
         gfx_obj_touch_fn_t touch_event; /**< Touch event (optional, NULL = no handler) */
+        gfx_obj_opaque_fn_t is_opaque;  /**< Opaque coverage hint (optional, NULL = never opaque) */
     } vfunc;
 
+    struct {
+        gfx_color_t *buf;           /**< Rendered object, stride = width (NULL until first built) */
+        gfx_opa_t *mask;            /**< Per-pixel coverage; NULL when every pixel is opaque */
+        uint16_t width;             /**< Size the buffers were allocated for */
+        uint16_t height;
+        bool enabled: 1;            /**< gfx_obj_set_cache_as_bitmap() */
+        bool valid: 1;              /**< buf matches the current content; cleared by gfx_obj_invalidate() */
+    } cache;
+
     /** Application touch callback (from gfx_obj_set_touch_cb) */
     gfx_obj_touch_cb_t user_touch_cb;
     void *user_touch_data;
@@ -93,12 +114,14 @@ struct gfx_obj {
         const char *class_name;         /**< Widget class name */
         const char *create_tag;         /**< Creation annotation tag */
     } trace;
-};
 
-typedef struct gfx_obj_child_t {
-    void *src;
-    struct gfx_obj_child_t *next;
-} gfx_obj_child_t;
+#if GFX_RENDER_OBJ_PERF
+    struct {
+        gfx_perf_counter_t draw;        /**< Accumulated by the render dispatch, see gfx_disp_get_obj_perf_stats() */
+        gfx_perf_counter_t update;
+    } perf;
+#endif
+};
 
 /**********************
  *   INTERNAL API
@@ -113,6 +136,11 @@ esp_err_t gfx_obj_create_class_instance(gfx_disp_t *disp, const gfx_widget_class
 
 void gfx_obj_cal_aligned_pos(gfx_obj_t *obj, uint32_t parent_width, uint32_t parent_height, gfx_coord_t *x, gfx_coord_t *y);
 void gfx_obj_calc_pos_in_parent(gfx_obj_t *obj);
+/** true when anc is obj's parent, grandparent, ... */
+bool gfx_obj_is_ancestor(const gfx_obj_t *anc, const gfx_obj_t *obj);
+/** Resolve obj's position; false if a parent container is hidden, otherwise out = inclusive bounds of its ancestors */
+bool gfx_obj_get_ancestor_clip(gfx_obj_t *obj, gfx_area_t *out);
+void gfx_obj_cache_free(gfx_obj_t *obj);
 
 #ifdef __cplusplus
 }
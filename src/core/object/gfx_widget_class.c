@@ -63,6 +63,7 @@ esp_err_t gfx_obj_init_class_instance(gfx_obj_t *obj, gfx_disp_t *disp, const gf
     obj->vfunc.delete = obj->klass->delete;
     obj->vfunc.update = obj->klass->update;
     obj->vfunc.touch_event = obj->klass->touch_event;
+    obj->vfunc.is_opaque = obj->klass->is_opaque;
     obj->trace.create_seq = ++s_obj_create_seq;
     obj->trace.class_name = (obj->klass->name != NULL) ? obj->klass->name : "unknown";
     obj->trace.create_tag = obj->trace.class_name;
@@ -0,0 +1,471 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_check.h"
+
+#include "common/gfx_config_internal.h"
+#define GFX_LOG_MODULE GFX_LOG_MODULE_CORE
+#include "common/gfx_log_priv.h"
+#include "core/runtime/gfx_cmd_priv.h"
+#include "widget/gfx_anim.h"
+#include "widget/gfx_label.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    GFX_CMD_NOP = 0,            /**< Cancelled by gfx_obj_delete() */
+    GFX_CMD_SET_POS,
+    GFX_CMD_SET_SIZE,
+    GFX_CMD_SET_VISIBLE,
+    GFX_CMD_SET_TEXT,
+    GFX_CMD_ANIM_START,
+    GFX_CMD_ANIM_STOP,
+    GFX_CMD_CALL,
+} gfx_cmd_type_t;
+
+typedef struct {
+    uint8_t type;               /**< gfx_cmd_type_t */
+    gfx_obj_t *obj;
+    uint32_t obj_seq;           /**< obj->trace.create_seq when posted, tells a reused address apart */
+    union {
+        struct {
+            gfx_coord_t x;
+            gfx_coord_t y;
+        } pos;
+        struct {
+            uint16_t w;
+            uint16_t h;
+        } size;
+        bool visible;
+        char *text;             /**< Owned copy, freed once applied or dropped */
+        struct {
+            gfx_cmd_cb_t cb;
+            void *user_data;
+        } call;
+    } arg;
+} gfx_cmd_t;
+
+/*
+ * Bounded MPSC ring with a sequence number per slot: seq == pos means free
+ * for the producer that claims pos, seq == pos + 1 means committed and ready
+ * for the consumer. Producers claim with a CAS on head; the render task is
+ * the only consumer and owns tail.
+ */
+typedef struct {
+    uint32_t seq;
+    gfx_cmd_t cmd;
+} gfx_cmd_slot_t;
+
+typedef struct gfx_cmd_queue {
+    gfx_cmd_slot_t *slots;
+    gfx_cmd_t *batch;           /**< Commands taken out of the ring by the running drain */
+    uint32_t mask;              /**< Capacity - 1 */
+    uint32_t head;              /**< Next position to claim (producers) */
+    uint32_t tail;              /**< Next position to consume (render task) */
+    uint32_t batch_pos;         /**< Entry being applied */
+    uint32_t batch_count;
+    uint32_t verify_end;        /**< Slots claimed before this may target an object deleted mid-post */
+    bool verify;
+    bool draining;
+    gfx_cmd_stats_t stats;
+} gfx_cmd_queue_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const char *TAG = "cmd";
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static gfx_core_context_t *gfx_cmd_obj_ctx(gfx_obj_t *obj);
+static esp_err_t gfx_cmd_post(gfx_core_context_t *ctx, const gfx_cmd_t *cmd);
+static uint8_t gfx_cmd_coalesce_key(uint8_t type);
+static bool gfx_cmd_is_superseded(const gfx_cmd_queue_t *q, uint32_t idx);
+static bool gfx_cmd_obj_alive(gfx_core_context_t *ctx, const gfx_cmd_t *cmd);
+static void gfx_cmd_release(gfx_cmd_t *cmd);
+static void gfx_cmd_apply(const gfx_cmd_t *cmd);
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static gfx_core_context_t *gfx_cmd_obj_ctx(gfx_obj_t *obj)
+{
+    if (obj == NULL || obj->disp == NULL || obj->disp->ctx == NULL || obj->disp->ctx->cmdq == NULL) {
+        return NULL;
+    }
+    return obj->disp->ctx;
+}
+
+static esp_err_t gfx_cmd_post(gfx_core_context_t *ctx, const gfx_cmd_t *cmd)
+{
+    gfx_cmd_queue_t *q = ctx->cmdq;
+    gfx_cmd_slot_t *slot;
+    uint32_t pos = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+
+    for (;;) {
+        slot = &q->slots[pos & q->mask];
+        uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        int32_t diff = (int32_t)(seq - pos);
+
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&q->head, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* Slot not consumed yet: the ring is full */
+            __atomic_fetch_add(&q->stats.dropped, 1, __ATOMIC_RELAXED);
+            return ESP_ERR_NO_MEM;
+        } else {
+            pos = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    slot->cmd = *cmd;
+    if (cmd->obj != NULL) {
+        slot->cmd.obj_seq = cmd->obj->trace.create_seq;
+    }
+    __atomic_store_n(&slot->seq, pos + 1, __ATOMIC_RELEASE);
+    __atomic_fetch_add(&q->stats.posted, 1, __ATOMIC_RELAXED);
+
+    gfx_core_wake(ctx, GFX_EVENT_CMD);
+    return ESP_OK;
+}
+
+/** Commands with the same non-zero key on the same object overwrite each other */
+static uint8_t gfx_cmd_coalesce_key(uint8_t type)
+{
+    switch (type) {
+    case GFX_CMD_ANIM_START:
+    case GFX_CMD_ANIM_STOP:
+        return GFX_CMD_ANIM_START;
+    case GFX_CMD_NOP:
+    case GFX_CMD_CALL:
+        return 0;
+    default:
+        return type;
+    }
+}
+
+/** A later command of the same kind on the same object, before any call barrier */
+static bool gfx_cmd_is_superseded(const gfx_cmd_queue_t *q, uint32_t idx)
+{
+    const gfx_cmd_t *cmd = &q->batch[idx];
+    uint8_t key = gfx_cmd_coalesce_key(cmd->type);
+
+    if (key == 0) {
+        return false;
+    }
+    for (uint32_t i = idx + 1; i < q->batch_count; i++) {
+        const gfx_cmd_t *later = &q->batch[i];
+        if (later->type == GFX_CMD_CALL) {
+            return false;
+        }
+        if (later->obj == cmd->obj && gfx_cmd_coalesce_key(later->type) == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** The command's object is still on one of ctx's displays and is the one it was posted for */
+static bool gfx_cmd_obj_alive(gfx_core_context_t *ctx, const gfx_cmd_t *cmd)
+{
+    for (gfx_disp_t *disp = ctx->disp; disp != NULL; disp = disp->next) {
+        for (uint16_t i = 0; i < disp->children.count; i++) {
+            if (disp->children.objs[i] == cmd->obj) {
+                return cmd->obj->trace.create_seq == cmd->obj_seq;
+            }
+        }
+    }
+    return false;
+}
+
+static void gfx_cmd_release(gfx_cmd_t *cmd)
+{
+    if (cmd->type == GFX_CMD_SET_TEXT) {
+        free(cmd->arg.text);
+        cmd->arg.text = NULL;
+    }
+    cmd->type = GFX_CMD_NOP;
+}
+
+static void gfx_cmd_apply(const gfx_cmd_t *cmd)
+{
+    esp_err_t ret = ESP_OK;
+
+    switch (cmd->type) {
+    case GFX_CMD_SET_POS:
+        ret = gfx_obj_set_pos(cmd->obj, cmd->arg.pos.x, cmd->arg.pos.y);
+        break;
+    case GFX_CMD_SET_SIZE:
+        ret = gfx_obj_set_size(cmd->obj, cmd->arg.size.w, cmd->arg.size.h);
+        break;
+    case GFX_CMD_SET_VISIBLE:
+        ret = gfx_obj_set_visible(cmd->obj, cmd->arg.visible);
+        break;
+    case GFX_CMD_SET_TEXT:
+        ret = gfx_label_set_text(cmd->obj, cmd->arg.text);
+        break;
+    case GFX_CMD_ANIM_START:
+        ret = gfx_anim_start(cmd->obj);
+        break;
+    case GFX_CMD_ANIM_STOP:
+        ret = gfx_anim_stop(cmd->obj);
+        break;
+    case GFX_CMD_CALL:
+        cmd->arg.call.cb(cmd->arg.call.user_data);
+        break;
+    default:
+        break;
+    }
+
+    if (ret != ESP_OK) {
+        GFX_LOGW(TAG, "command %u on %p failed: %s", (unsigned)cmd->type, (void *)cmd->obj, esp_err_to_name(ret));
+    }
+}
+
+/**********************
+ *   PUBLIC FUNCTIONS
+ **********************/
+
+esp_err_t gfx_cmd_queue_init(gfx_core_context_t *ctx)
+{
+    uint32_t capacity = 1;
+    gfx_cmd_queue_t *q;
+
+    while (capacity < GFX_CMD_QUEUE_LEN) {
+        capacity <<= 1;
+    }
+
+    q = calloc(1, sizeof(gfx_cmd_queue_t));
+    if (q == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    q->slots = calloc(capacity, sizeof(gfx_cmd_slot_t));
+    q->batch = calloc(capacity, sizeof(gfx_cmd_t));
+    if (q->slots == NULL || q->batch == NULL) {
+        free(q->slots);
+        free(q->batch);
+        free(q);
+        return ESP_ERR_NO_MEM;
+    }
+
+    q->mask = capacity - 1;
+    for (uint32_t i = 0; i < capacity; i++) {
+        q->slots[i].seq = i;
+    }
+    ctx->cmdq = q;
+    return ESP_OK;
+}
+
+void gfx_cmd_queue_deinit(gfx_core_context_t *ctx)
+{
+    gfx_cmd_queue_t *q = ctx->cmdq;
+
+    if (q == NULL) {
+        return;
+    }
+    for (uint32_t pos = q->tail; q->slots[pos & q->mask].seq == pos + 1; pos++) {
+        gfx_cmd_release(&q->slots[pos & q->mask].cmd);
+    }
+    free(q->slots);
+    free(q->batch);
+    free(q);
+    ctx->cmdq = NULL;
+}
+
+void gfx_cmd_queue_drain(gfx_core_context_t *ctx)
+{
+    gfx_cmd_queue_t *q = ctx->cmdq;
+    uint32_t pos;
+
+    /* A gfx_cmd_call() callback may refresh synchronously; leave the rest to the outer drain */
+    if (q == NULL || q->draining) {
+        return;
+    }
+
+    pos = q->tail;
+    q->batch_count = 0;
+    while (q->batch_count <= q->mask) {
+        gfx_cmd_slot_t *slot = &q->slots[pos & q->mask];
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != pos + 1) {
+            break;
+        }
+        gfx_cmd_t *cmd = &q->batch[q->batch_count++];
+        *cmd = slot->cmd;
+        __atomic_store_n(&slot->seq, pos + q->mask + 1, __ATOMIC_RELEASE);
+        if (q->verify && (int32_t)(pos - q->verify_end) < 0 && cmd->obj != NULL && !gfx_cmd_obj_alive(ctx, cmd)) {
+            gfx_cmd_release(cmd);
+        }
+        pos++;
+    }
+    q->tail = pos;
+    if (q->verify && (int32_t)(pos - q->verify_end) >= 0) {
+        q->verify = false;
+    }
+
+    q->draining = true;
+    for (q->batch_pos = 0; q->batch_pos < q->batch_count; q->batch_pos++) {
+        gfx_cmd_t *cmd = &q->batch[q->batch_pos];
+
+        if (cmd->type == GFX_CMD_NOP) {
+            continue;
+        }
+        if (gfx_cmd_is_superseded(q, q->batch_pos)) {
+            __atomic_fetch_add(&q->stats.coalesced, 1, __ATOMIC_RELAXED);
+        } else {
+            gfx_cmd_apply(cmd);
+            __atomic_fetch_add(&q->stats.applied, 1, __ATOMIC_RELAXED);
+        }
+        gfx_cmd_release(cmd);
+    }
+    q->batch_count = 0;
+    q->draining = false;
+}
+
+void gfx_cmd_queue_cancel_obj(gfx_core_context_t *ctx, gfx_obj_t *obj)
+{
+    gfx_cmd_queue_t *q = ctx->cmdq;
+
+    if (q == NULL) {
+        return;
+    }
+
+    /* Not yet applied by a running drain (a call callback deleting objects) */
+    for (uint32_t i = q->batch_pos + 1; i < q->batch_count; i++) {
+        if (q->batch[i].obj == obj) {
+            gfx_cmd_release(&q->batch[i]);
+        }
+    }
+
+    /*
+     * Committed slots stay untouched by producers until the render task
+     * consumes them. A slot still being written may be committed behind later
+     * ones and hold obj as well; the drain checks those against the live
+     * objects instead.
+     */
+    uint32_t head = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+    for (uint32_t pos = q->tail; pos != head; pos++) {
+        gfx_cmd_slot_t *slot = &q->slots[pos & q->mask];
+        if (__atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) != pos + 1) {
+            if (!q->verify || (int32_t)(head - q->verify_end) > 0) {
+                q->verify_end = head;
+            }
+            q->verify = true;
+            continue;
+        }
+        if (slot->cmd.obj == obj) {
+            gfx_cmd_release(&slot->cmd);
+        }
+    }
+}
+
+esp_err_t gfx_cmd_set_pos(gfx_obj_t *obj, gfx_coord_t x, gfx_coord_t y)
+{
+    gfx_core_context_t *ctx = gfx_cmd_obj_ctx(obj);
+    gfx_cmd_t cmd = {.type = GFX_CMD_SET_POS, .obj = obj, .arg.pos = {x, y}};
+
+    ESP_RETURN_ON_FALSE(ctx != NULL, ESP_ERR_INVALID_ARG, TAG, "set_pos: object not on a display");
+    return gfx_cmd_post(ctx, &cmd);
+}
+
+esp_err_t gfx_cmd_set_size(gfx_obj_t *obj, uint16_t w, uint16_t h)
+{
+    gfx_core_context_t *ctx = gfx_cmd_obj_ctx(obj);
+    gfx_cmd_t cmd = {.type = GFX_CMD_SET_SIZE, .obj = obj, .arg.size = {w, h}};
+
+    ESP_RETURN_ON_FALSE(ctx != NULL, ESP_ERR_INVALID_ARG, TAG, "set_size: object not on a display");
+    return gfx_cmd_post(ctx, &cmd);
+}
+
+esp_err_t gfx_cmd_set_visible(gfx_obj_t *obj, bool visible)
+{
+    gfx_core_context_t *ctx = gfx_cmd_obj_ctx(obj);
+    gfx_cmd_t cmd = {.type = GFX_CMD_SET_VISIBLE, .obj = obj, .arg.visible = visible};
+
+    ESP_RETURN_ON_FALSE(ctx != NULL, ESP_ERR_INVALID_ARG, TAG, "set_visible: object not on a display");
+    return gfx_cmd_post(ctx, &cmd);
+}
+
+esp_err_t gfx_cmd_set_text(gfx_obj_t *obj, const char *text)
+{
+    gfx_core_context_t *ctx = gfx_cmd_obj_ctx(obj);
+    gfx_cmd_t cmd = {.type = GFX_CMD_SET_TEXT, .obj = obj};
+    esp_err_t ret;
+
+    ESP_RETURN_ON_FALSE(ctx != NULL && text != NULL, ESP_ERR_INVALID_ARG, TAG, "set_text: invalid argument");
+
+    size_t len = strlen(text) + 1;
+    cmd.arg.text = malloc(len);
+    ESP_RETURN_ON_FALSE(cmd.arg.text != NULL, ESP_ERR_NO_MEM, TAG, "set_text: no mem for %zu bytes", len);
+    memcpy(cmd.arg.text, text, len);
+
+    ret = gfx_cmd_post(ctx, &cmd);
+    if (ret != ESP_OK) {
+        free(cmd.arg.text);
+    }
+    return ret;
+}
+
+esp_err_t gfx_cmd_anim_start(gfx_obj_t *obj)
+{
+    gfx_core_context_t *ctx = gfx_cmd_obj_ctx(obj);
+    gfx_cmd_t cmd = {.type = GFX_CMD_ANIM_START, .obj = obj};
+
+    ESP_RETURN_ON_FALSE(ctx != NULL, ESP_ERR_INVALID_ARG, TAG, "anim_start: object not on a display");
+    return gfx_cmd_post(ctx, &cmd);
+}
+
+esp_err_t gfx_cmd_anim_stop(gfx_obj_t *obj)
+{
+    gfx_core_context_t *ctx = gfx_cmd_obj_ctx(obj);
+    gfx_cmd_t cmd = {.type = GFX_CMD_ANIM_STOP, .obj = obj};
+
+    ESP_RETURN_ON_FALSE(ctx != NULL, ESP_ERR_INVALID_ARG, TAG, "anim_stop: object not on a display");
+    return gfx_cmd_post(ctx, &cmd);
+}
+
+esp_err_t gfx_cmd_call(gfx_handle_t handle, gfx_cmd_cb_t cb, void *user_data)
+{
+    gfx_core_context_t *ctx = (gfx_core_context_t *)handle;
+    gfx_cmd_t cmd = {.type = GFX_CMD_CALL, .arg.call = {cb, user_data}};
+
+    ESP_RETURN_ON_FALSE(ctx != NULL && ctx->cmdq != NULL && cb != NULL, ESP_ERR_INVALID_ARG, TAG,
+                        "call: invalid argument");
+    return gfx_cmd_post(ctx, &cmd);
+}
+
+esp_err_t gfx_cmd_get_stats(gfx_handle_t handle, gfx_cmd_stats_t *out)
+{
+    gfx_core_context_t *ctx = (gfx_core_context_t *)handle;
+
+    ESP_RETURN_ON_FALSE(ctx != NULL && ctx->cmdq != NULL && out != NULL, ESP_ERR_INVALID_ARG, TAG,
+                        "get_stats: invalid argument");
+
+    gfx_cmd_queue_t *q = ctx->cmdq;
+    out->posted = __atomic_load_n(&q->stats.posted, __ATOMIC_RELAXED);
+    out->dropped = __atomic_load_n(&q->stats.dropped, __ATOMIC_RELAXED);
+    out->applied = __atomic_load_n(&q->stats.applied, __ATOMIC_RELAXED);
+    out->coalesced = __atomic_load_n(&q->stats.coalesced, __ATOMIC_RELAXED);
+    return ESP_OK;
+}
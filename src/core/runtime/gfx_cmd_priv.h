@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include "core/gfx_cmd.h"
+#include "core/runtime/gfx_core_priv.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *   INTERNAL API
+ *********************/
+
+/**
+ * @brief Allocate the command ring (CONFIG_GFX_CMD_QUEUE_LEN, rounded up to a power of two)
+ * @return ESP_OK, ESP_ERR_NO_MEM on failure
+ */
+esp_err_t gfx_cmd_queue_init(gfx_core_context_t *ctx);
+
+/**
+ * @brief Free the ring and any text still queued; producers must have stopped
+ */
+void gfx_cmd_queue_deinit(gfx_core_context_t *ctx);
+
+/**
+ * @brief Apply every committed command, skipping superseded ones
+ *
+ * Render task only, with the render mutex held. Commands posted while the
+ * drain runs wait for the next frame.
+ */
+void gfx_cmd_queue_drain(gfx_core_context_t *ctx);
+
+/**
+ * @brief Turn pending commands targeting obj into no-ops (render mutex held)
+ *
+ * Call after obj has left its display's child list: commands still being
+ * written by a producer are dropped by the next drain when their object is
+ * no longer on a display.
+ */
+void gfx_cmd_queue_cancel_obj(gfx_core_context_t *ctx, gfx_obj_t *obj);
+
+#ifdef __cplusplus
+}
+#endif
@@ -8,20 +8,25 @@
  *      INCLUDES
  *********************/
 #include <stdbool.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/event_groups.h"
+#include "esp_attr.h"
 #include "esp_timer.h"
 #include "esp_check.h"
+#include "esp_heap_caps.h"
 #define GFX_LOG_MODULE GFX_LOG_MODULE_CORE
 #include "common/gfx_log_priv.h"
 
 #include "core/gfx_obj.h"
 #include "core/display/gfx_refr_priv.h"
 #include "core/display/gfx_render_priv.h"
+#include "core/display/gfx_render_stripe_priv.h"
 #include "core/object/gfx_obj_priv.h"
+#include "core/runtime/gfx_cmd_priv.h"
 #include "core/runtime/gfx_timer_priv.h"
 #include "core/runtime/gfx_touch_priv.h"
 
@@ -36,6 +41,12 @@
  *      TYPEDEFS
  **********************/
 
+/** Per-display state saved around gfx_refr_batch() */
+typedef struct {
+    gfx_disp_flush_cb_t flush_cb;
+    uint32_t frame_count;
+} gfx_refr_batch_disp_t;
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -51,33 +62,34 @@ static uint32_t gfx_cal_task_delay(uint32_t timer_delay);
 static void gfx_do_refr_now_impl(gfx_core_context_t *ctx);
 static inline TickType_t gfx_block_ticks(uint32_t ms);
 static void gfx_wait_for_work(gfx_core_context_t *ctx, uint32_t next_sleep_ms, EventBits_t *out_triggered);
+static uint32_t gfx_frame_count_sum(const gfx_core_context_t *ctx);
+static void gfx_wake_record(gfx_core_context_t *ctx, EventBits_t evt, int64_t sleep_start_us, uint32_t sleep_ms);
+static void gfx_refr_batch_flush_none(gfx_disp_t *disp, int x1, int y1, int x2, int y2, const void *data);
+static void gfx_refr_batch_flush_memcpy(gfx_disp_t *disp, int x1, int y1, int x2, int y2, const void *data);
+static esp_err_t gfx_refr_batch_run(gfx_core_context_t *ctx, const gfx_refr_batch_config_t *cfg,
+                                    gfx_refr_batch_disp_t *disp_state, gfx_refr_batch_stats_t *stats);
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
-/** Convert ms to block time in ticks; minimum 1 tick. */
+/** Convert ms to block time in ticks; minimum 1 tick, ANIM_NO_TIMER_READY blocks until woken. */
 static inline TickType_t gfx_block_ticks(uint32_t ms)
 {
+    if (ms == ANIM_NO_TIMER_READY) {
+        return portMAX_DELAY;
+    }
     TickType_t t = pdMS_TO_TICKS(ms);
     return (t >= 1) ? t : 1;
 }
 
 /**
- * Wait for render work or lifecycle exit. Checks NEED_DELETE first (no block);
- * if set, signals DELETE_DONE and deletes the task (never returns).
- * Otherwise waits on render_events for up to next_sleep_ms and returns evt_invalidate bits.
+ * Wait on render_events for up to next_sleep_ms and return the triggered bits.
+ * Then checks NEED_DELETE (gfx_emote_deinit also sets GFX_EVENT_LIFECYCLE so an
+ * idle wait returns); if set, signals DELETE_DONE and deletes the task (never returns).
  */
 static void gfx_wait_for_work(gfx_core_context_t *ctx, uint32_t next_sleep_ms, EventBits_t *out_triggered)
 {
-    EventBits_t life = xEventGroupWaitBits(ctx->sync.lifecycle_events, NEED_DELETE,
-                                           pdTRUE, pdFALSE, 0);
-    if (life & NEED_DELETE) {
-        xEventGroupSetBits(ctx->sync.lifecycle_events, DELETE_DONE);
-        vTaskDeleteWithCaps(NULL);
-        /* never returns */
-    }
-
     if (ctx->sync.render_events != NULL) {
         *out_triggered = xEventGroupWaitBits(ctx->sync.render_events, GFX_EVENT_ALL,
                                              pdTRUE, pdFALSE, gfx_block_ticks(next_sleep_ms));
@@ -85,6 +97,14 @@ static void gfx_wait_for_work(gfx_core_context_t *ctx, uint32_t next_sleep_ms, E
         vTaskDelay(gfx_block_ticks(next_sleep_ms));
         *out_triggered = 0;
     }
+
+    EventBits_t life = xEventGroupWaitBits(ctx->sync.lifecycle_events, NEED_DELETE,
+                                           pdTRUE, pdFALSE, 0);
+    if (life & NEED_DELETE) {
+        xEventGroupSetBits(ctx->sync.lifecycle_events, DELETE_DONE);
+        vTaskDeleteWithCaps(NULL);
+        /* never returns */
+    }
 }
 
 static uint32_t gfx_cal_task_delay(uint32_t timer_delay)
@@ -92,12 +112,48 @@ static uint32_t gfx_cal_task_delay(uint32_t timer_delay)
     uint32_t min_delay_ms = (1000 / configTICK_RATE_HZ) + 1; // At least one tick + 1ms
 
     if (timer_delay == ANIM_NO_TIMER_READY) {
-        return (min_delay_ms > 5) ? min_delay_ms : 5;
+        /* Nothing is animating: sleep until an invalidation, command, timer change or touch IRQ */
+        return ANIM_NO_TIMER_READY;
     } else {
         return (timer_delay < min_delay_ms) ? min_delay_ms : timer_delay;
     }
 }
 
+static uint32_t gfx_frame_count_sum(const gfx_core_context_t *ctx)
+{
+    uint32_t frames = 0;
+
+    for (const gfx_disp_t *disp = ctx->disp; disp != NULL; disp = disp->next) {
+        frames += disp->render.frame_count;
+    }
+    return frames;
+}
+
+/** Account one render task wakeup; called with the render mutex held */
+static void gfx_wake_record(gfx_core_context_t *ctx, EventBits_t evt, int64_t sleep_start_us, uint32_t sleep_ms)
+{
+    int64_t now_us = esp_timer_get_time();
+    uint32_t request_us = __atomic_exchange_n(&ctx->wake.request_us, 0, __ATOMIC_RELAXED);
+    int64_t latency_us = -1;
+
+    ctx->wake.wakeups++;
+    if (request_us != 0) {
+        latency_us = (int64_t)(uint32_t)((uint32_t)now_us - request_us);
+    } else if (evt == 0 && sleep_ms != ANIM_NO_TIMER_READY) {
+        /* Timed out: how late the task runs against the deadline it slept for */
+        latency_us = now_us - (sleep_start_us + (int64_t)sleep_ms * 1000);
+        latency_us = (latency_us > 0) ? latency_us : 0;
+    }
+
+#if GFX_DISP_PERF_HIST
+    if (latency_us >= 0) {
+        gfx_perf_hist_record(&ctx->wake.latency, (uint64_t)latency_us);
+    }
+#else
+    (void)latency_us;
+#endif
+}
+
 static void gfx_render_loop_task(void *arg)
 {
     gfx_core_context_t *ctx = (gfx_core_context_t *)arg;
@@ -112,8 +168,9 @@ static void gfx_render_loop_task(void *arg)
     vTaskDelay(pdMS_TO_TICKS(GFX_RENDER_TASK_IDLE_SLEEP_MS));
 
     for (;;) {
-        EventBits_t evt_invalidate;
-        gfx_wait_for_work(ctx, next_sleep_ms, &evt_invalidate);
+        EventBits_t evt;
+        int64_t sleep_start_us = esp_timer_get_time();
+        gfx_wait_for_work(ctx, next_sleep_ms, &evt);
 
         bool locked = (mutex != NULL && xSemaphoreTakeRecursive(mutex, portMAX_DELAY) == pdTRUE);
         if (!locked) {
@@ -122,27 +179,124 @@ static void gfx_render_loop_task(void *arg)
             continue;
         }
 
+        gfx_wake_record(ctx, evt, sleep_start_us, next_sleep_ms);
+        if (evt & GFX_EVENT_TOUCH) {
+            gfx_touch_service_irq(ctx);
+        }
+
+        /* Timer changes made before this point are seen by gfx_timer_handler() */
+        xEventGroupClearBits(ctx->sync.render_events, GFX_EVENT_TIMER);
         bool evt_refr;
         uint32_t time_until_next = gfx_timer_handler(&ctx->timer_mgr, &evt_refr);
-        bool need_refr = (evt_invalidate != 0) || evt_refr;
+        bool need_refr = (evt & GFX_EVENT_RENDER) || evt_refr;
 
         if (need_refr) {
+            uint32_t frames = gfx_frame_count_sum(ctx);
+
+            /* Invalidations so far (timer callbacks included) land in this frame; later ones wake us again */
+            xEventGroupClearBits(ctx->sync.render_events, GFX_EVENT_INVALIDATE | GFX_EVENT_CMD);
+            __atomic_store_n(&ctx->wake.request_us, 0, __ATOMIC_RELAXED);
+            int64_t render_start_us = esp_timer_get_time();
             gfx_do_refr_now_impl(ctx);
+            if (gfx_frame_count_sum(ctx) != frames) {
+                ctx->wake.render_wakeups++;
+                gfx_timer_sched_record(&ctx->timer_mgr, (uint32_t)(esp_timer_get_time() - render_start_us));
+            }
         }
 
         next_sleep_ms = gfx_cal_task_delay(time_until_next);
+        if (next_sleep_ms == ANIM_NO_TIMER_READY) {
+            ctx->wake.idle_blocks++;
+        }
         xSemaphoreGiveRecursive(mutex);
-        vTaskDelay(pdMS_TO_TICKS(1));
+        /* Hand the lock to an equal-priority task waiting for it before the next frame */
+        taskYIELD();
     }
 }
 
 static void gfx_do_refr_now_impl(gfx_core_context_t *ctx)
 {
+    gfx_cmd_queue_drain(ctx);
     if (ctx->disp != NULL) {
         gfx_render_handler(ctx);
     }
 }
 
+static void gfx_refr_batch_flush_none(gfx_disp_t *disp, int x1, int y1, int x2, int y2, const void *data)
+{
+    (void)x1;
+    (void)y1;
+    (void)x2;
+    (void)y2;
+    (void)data;
+    gfx_disp_flush_ready(disp, true);
+}
+
+/** Same row layout as the render loop: full_frame passes the whole frame, partial mode the chunk only */
+static void gfx_refr_batch_flush_memcpy(gfx_disp_t *disp, int x1, int y1, int x2, int y2, const void *data)
+{
+    uint16_t *frame = disp->ctx->batch_frame;
+    const uint16_t *src = (const uint16_t *)data;
+    size_t row_bytes = (size_t)(x2 - x1) * sizeof(uint16_t);
+
+    for (int y = y1; y < y2; y++) {
+        const uint16_t *row = disp->flags.full_frame
+                              ? src + (size_t)y * disp->res.h_res + x1
+                              : src + (size_t)(y - y1) * (x2 - x1);
+        memcpy(frame + (size_t)y * disp->res.h_res + x1, row, row_bytes);
+    }
+    gfx_disp_flush_ready(disp, true);
+}
+
+/** Caller holds the render mutex; disp_state holds one entry per display */
+static esp_err_t gfx_refr_batch_run(gfx_core_context_t *ctx, const gfx_refr_batch_config_t *cfg,
+                                    gfx_refr_batch_disp_t *disp_state, gfx_refr_batch_stats_t *stats)
+{
+    int64_t start_us = esp_timer_get_time();
+    esp_err_t ret = ESP_OK;
+
+    for (uint32_t i = 0; i < cfg->frames; i++) {
+        gfx_disp_t *disp;
+        size_t d;
+        bool rendered = false;
+
+        if (cfg->step_ms > 0) {
+            ret = gfx_timer_step(ctx, cfg->step_ms);
+            if (ret != ESP_OK) {
+                break;
+            }
+        }
+
+        for (disp = ctx->disp, d = 0; disp != NULL; disp = disp->next, d++) {
+            if (cfg->invalidate_all) {
+                gfx_disp_refresh_all(disp);
+            }
+            disp_state[d].frame_count = disp->render.frame_count;
+        }
+
+        gfx_do_refr_now_impl(ctx);
+
+        for (disp = ctx->disp, d = 0; disp != NULL; disp = disp->next, d++) {
+            if (disp->render.frame_count == disp_state[d].frame_count) {
+                continue;
+            }
+            rendered = true;
+            stats->render_us += disp->render.render_time_us;
+            stats->flush_us += disp->render.flush_time_us;
+            stats->pixels += disp->render.dirty_pixels;
+        }
+        if (rendered) {
+            stats->rendered_frames++;
+        }
+    }
+
+    stats->total_us = (uint64_t)(esp_timer_get_time() - start_us);
+    if (stats->total_us > 0) {
+        stats->fps = (uint32_t)(((uint64_t)cfg->frames * 1000000ULL) / stats->total_us);
+    }
+    return ret;
+}
+
 /**********************
  *   PUBLIC FUNCTIONS
  **********************/
@@ -155,6 +309,8 @@ gfx_handle_t gfx_emote_init(const gfx_core_config_t *cfg)
     bool lifecycle_events_created = false;
     bool mutex_created = false;
     bool decoder_inited = false;
+    bool stripes_inited = false;
+    bool cmdq_inited = false;
 #ifdef CONFIG_GFX_FONT_FREETYPE_SUPPORT
     bool font_lib_created = false;
 #endif
@@ -183,12 +339,20 @@ gfx_handle_t gfx_emote_init(const gfx_core_config_t *cfg)
     font_lib_created = true;
 #endif
 
-    gfx_timer_mgr_init(&disp_ctx->timer_mgr, cfg->fps);
+    gfx_timer_mgr_init(&disp_ctx->timer_mgr, disp_ctx, cfg->fps);
 
     ret = gfx_image_decoder_init();
     ESP_GOTO_ON_ERROR(ret, err, TAG, "Failed to initialize image decoder");
     decoder_inited = true;
 
+    ret = gfx_render_stripe_init(disp_ctx, cfg);
+    ESP_GOTO_ON_ERROR(ret, err, TAG, "Failed to create stripe render workers");
+    stripes_inited = true;
+
+    ret = gfx_cmd_queue_init(disp_ctx);
+    ESP_GOTO_ON_ERROR(ret, err, TAG, "Failed to create command queue");
+    cmdq_inited = true;
+
     const uint32_t stack_caps = cfg->task.task_stack_caps ? cfg->task.task_stack_caps : (MALLOC_CAP_INTERNAL | MALLOC_CAP_DEFAULT);
     if (cfg->task.task_affinity < 0) {
         task_ret = xTaskCreateWithCaps(gfx_render_loop_task, "gfx_render", cfg->task.task_stack,
@@ -202,6 +366,12 @@ gfx_handle_t gfx_emote_init(const gfx_core_config_t *cfg)
     return (gfx_handle_t)disp_ctx;
 
 err:
+    if (cmdq_inited) {
+        gfx_cmd_queue_deinit(disp_ctx);
+    }
+    if (stripes_inited) {
+        gfx_render_stripe_deinit(disp_ctx);
+    }
     if (decoder_inited) {
         gfx_image_decoder_deinit();
     }
@@ -233,7 +403,9 @@ void gfx_emote_deinit(gfx_handle_t handle)
     }
 
     xEventGroupSetBits(ctx->sync.lifecycle_events, NEED_DELETE);
+    xEventGroupSetBits(ctx->sync.render_events, GFX_EVENT_LIFECYCLE);
     xEventGroupWaitBits(ctx->sync.lifecycle_events, DELETE_DONE, pdTRUE, pdFALSE, portMAX_DELAY);
+    gfx_render_stripe_deinit(ctx);
 
     while (ctx->disp != NULL) {
         gfx_disp_t *d = ctx->disp;
@@ -249,6 +421,7 @@ void gfx_emote_deinit(gfx_handle_t handle)
     }
 
     gfx_timer_mgr_deinit(&ctx->timer_mgr);
+    gfx_cmd_queue_deinit(ctx);
 
 #ifdef CONFIG_GFX_FONT_FREETYPE_SUPPORT
     gfx_ft_lib_cleanup();
@@ -297,6 +470,143 @@ esp_err_t gfx_refr_now(gfx_handle_t handle)
     return ESP_OK;
 }
 
+esp_err_t gfx_refr_batch(gfx_handle_t handle, const gfx_refr_batch_config_t *cfg, gfx_refr_batch_stats_t *out)
+{
+    gfx_core_context_t *ctx = (gfx_core_context_t *)handle;
+    gfx_refr_batch_stats_t stats = {0};
+    gfx_refr_batch_disp_t *disp_state = NULL;
+    size_t disp_count = 0;
+    size_t frame_px = 0;
+    esp_err_t ret = ESP_OK;
+
+    ESP_RETURN_ON_FALSE(ctx != NULL && ctx->sync.render_mutex != NULL && cfg != NULL, ESP_ERR_INVALID_ARG, TAG,
+                        "batch: invalid argument");
+    ESP_RETURN_ON_FALSE(cfg->flush <= GFX_REFR_BATCH_FLUSH_MEMCPY, ESP_ERR_INVALID_ARG, TAG, "batch: bad flush mode");
+    ESP_RETURN_ON_FALSE(xSemaphoreTakeRecursive(ctx->sync.render_mutex, portMAX_DELAY) == pdTRUE, ESP_ERR_TIMEOUT, TAG,
+                        "batch: acquire mutex failed");
+
+    for (gfx_disp_t *disp = ctx->disp; disp != NULL; disp = disp->next) {
+        size_t px = (size_t)disp->res.h_res * disp->res.v_res;
+        frame_px = (px > frame_px) ? px : frame_px;
+        disp_count++;
+    }
+
+    disp_state = calloc(disp_count > 0 ? disp_count : 1, sizeof(gfx_refr_batch_disp_t));
+    ESP_GOTO_ON_FALSE(disp_state != NULL, ESP_ERR_NO_MEM, out_unlock, TAG, "batch: no mem for display state");
+    if (cfg->flush == GFX_REFR_BATCH_FLUSH_MEMCPY) {
+        ctx->batch_frame = heap_caps_malloc(frame_px * sizeof(uint16_t), MALLOC_CAP_DEFAULT);
+        ESP_GOTO_ON_FALSE(ctx->batch_frame != NULL || frame_px == 0, ESP_ERR_NO_MEM, out_free, TAG,
+                          "batch: no mem for %zu px frame", frame_px);
+    }
+
+    if (cfg->flush != GFX_REFR_BATCH_FLUSH_DISPLAY) {
+        gfx_disp_flush_cb_t batch_cb = (cfg->flush == GFX_REFR_BATCH_FLUSH_MEMCPY)
+                                       ? gfx_refr_batch_flush_memcpy : gfx_refr_batch_flush_none;
+        size_t d = 0;
+        for (gfx_disp_t *disp = ctx->disp; disp != NULL; disp = disp->next, d++) {
+            disp_state[d].flush_cb = disp->cb.flush_cb;
+            disp->cb.flush_cb = batch_cb;
+        }
+    }
+
+    stats.frames = cfg->frames;
+    ret = gfx_refr_batch_run(ctx, cfg, disp_state, &stats);
+
+    if (cfg->flush != GFX_REFR_BATCH_FLUSH_DISPLAY) {
+        size_t d = 0;
+        for (gfx_disp_t *disp = ctx->disp; disp != NULL; disp = disp->next, d++) {
+            disp->cb.flush_cb = disp_state[d].flush_cb;
+        }
+    }
+
+out_free:
+    heap_caps_free(ctx->batch_frame);
+    ctx->batch_frame = NULL;
+    free(disp_state);
+out_unlock:
+    xSemaphoreGiveRecursive(ctx->sync.render_mutex);
+    if (out != NULL) {
+        *out = stats;
+    }
+    return ret;
+}
+
+esp_err_t gfx_emote_get_wake_stats(gfx_handle_t handle, gfx_wake_stats_t *out)
+{
+    gfx_core_context_t *ctx = (gfx_core_context_t *)handle;
+
+    ESP_RETURN_ON_FALSE(ctx != NULL && ctx->sync.render_mutex != NULL && out != NULL, ESP_ERR_INVALID_ARG, TAG,
+                        "wake stats: invalid argument");
+    ESP_RETURN_ON_FALSE(xSemaphoreTakeRecursive(ctx->sync.render_mutex, portMAX_DELAY) == pdTRUE, ESP_ERR_TIMEOUT, TAG,
+                        "wake stats: acquire mutex failed");
+
+    memset(out, 0, sizeof(*out));
+    out->wakeups = ctx->wake.wakeups;
+    out->render_wakeups = ctx->wake.render_wakeups;
+    out->idle_blocks = ctx->wake.idle_blocks;
+#if GFX_DISP_PERF_HIST
+    gfx_perf_hist_summary(&ctx->wake.latency, &out->latency_us);
+#endif
+
+    xSemaphoreGiveRecursive(ctx->sync.render_mutex);
+    return ESP_OK;
+}
+
+esp_err_t gfx_emote_reset_wake_stats(gfx_handle_t handle)
+{
+    gfx_core_context_t *ctx = (gfx_core_context_t *)handle;
+
+    ESP_RETURN_ON_FALSE(ctx != NULL && ctx->sync.render_mutex != NULL, ESP_ERR_INVALID_ARG, TAG,
+                        "wake stats: invalid argument");
+    ESP_RETURN_ON_FALSE(xSemaphoreTakeRecursive(ctx->sync.render_mutex, portMAX_DELAY) == pdTRUE, ESP_ERR_TIMEOUT, TAG,
+                        "wake stats: acquire mutex failed");
+
+    ctx->wake.wakeups = 0;
+    ctx->wake.render_wakeups = 0;
+    ctx->wake.idle_blocks = 0;
+#if GFX_DISP_PERF_HIST
+    gfx_perf_hist_reset(&ctx->wake.latency);
+#endif
+
+    xSemaphoreGiveRecursive(ctx->sync.render_mutex);
+    return ESP_OK;
+}
+
+void gfx_core_wake(gfx_core_context_t *ctx, EventBits_t bits)
+{
+    uint32_t expected = 0;
+    uint32_t now_us;
+
+    if (ctx == NULL || ctx->sync.render_events == NULL) {
+        return;
+    }
+
+    /* 0 means "no request pending", so a request stamped at 0 us reads as 1 us */
+    now_us = (uint32_t)esp_timer_get_time();
+    __atomic_compare_exchange_n(&ctx->wake.request_us, &expected, now_us ? now_us : 1, false,
+                                __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    xEventGroupSetBits(ctx->sync.render_events, bits);
+}
+
+void IRAM_ATTR gfx_core_wake_from_isr(gfx_core_context_t *ctx, EventBits_t bits)
+{
+    BaseType_t higher_prio_woken = pdFALSE;
+    uint32_t expected = 0;
+    uint32_t now_us;
+
+    if (ctx == NULL || ctx->sync.render_events == NULL) {
+        return;
+    }
+
+    now_us = (uint32_t)esp_timer_get_time();
+    __atomic_compare_exchange_n(&ctx->wake.request_us, &expected, now_us ? now_us : 1, false,
+                                __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    xEventGroupSetBitsFromISR(ctx->sync.render_events, bits, &higher_prio_woken);
+    if (higher_prio_woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
 esp_err_t gfx_emote_lock(gfx_handle_t handle)
 {
     gfx_core_context_t *ctx = (gfx_core_context_t *)handle;
@@ -13,6 +13,7 @@
 #include "core/gfx_core.h"
 #include "core/gfx_touch.h"
 #include "core/display/gfx_disp_priv.h"
+#include "core/display/gfx_perf_hist_priv.h"
 #include "core/object/gfx_obj_priv.h"
 #include "core/runtime/gfx_timer_priv.h"
 
@@ -28,9 +29,15 @@ extern "C" {
 #define WAIT_FLUSH_DONE     BIT2
 
 #define GFX_EVENT_INVALIDATE    BIT0
+#define GFX_EVENT_CMD           BIT1
+#define GFX_EVENT_TIMER         BIT2    /**< Timer added or rearmed: recompute the sleep */
+#define GFX_EVENT_TOUCH         BIT3    /**< Touch interrupt pending */
+#define GFX_EVENT_LIFECYCLE     BIT4    /**< NEED_DELETE was set on lifecycle_events */
 #define GFX_EVENT_ALL           0xFF
+/** Wakeups that call the render handler even when no frame is due */
+#define GFX_EVENT_RENDER        (GFX_EVENT_INVALIDATE | GFX_EVENT_CMD | GFX_EVENT_TOUCH)
 
-#define ANIM_NO_TIMER_READY 0xFFFFFFFF
+#define ANIM_NO_TIMER_READY 0xFFFFFFFF     /**< Also the render task's sleep time for "until woken" */
 
 #define GFX_RENDER_TASK_IDLE_SLEEP_MS  100
 
@@ -47,12 +54,39 @@ typedef struct gfx_core_context {
     gfx_timer_mgr_t timer_mgr;             /**< Timer manager (see gfx_timer_priv.h) */
     gfx_disp_t *disp;                      /**< Display list (one per screen, malloc'd) */
     gfx_touch_t *touch;                    /**< Touch list (multiple touch devices, malloc'd) */
+    struct gfx_render_stripe_pool *stripes; /**< Stripe render workers (NULL = render task draws alone) */
+    struct gfx_cmd_queue *cmdq;            /**< Cross-task command ring (see gfx_cmd_priv.h) */
+    uint16_t *batch_frame;                 /**< Target of GFX_REFR_BATCH_FLUSH_MEMCPY while gfx_refr_batch() runs */
+
+    /* Render task wakeups, see gfx_emote_get_wake_stats() */
+    struct {
+        uint32_t request_us;               /**< Low 32 bits of the first gfx_core_wake() time since the last wakeup; 0 = none */
+        uint32_t wakeups;
+        uint32_t render_wakeups;
+        uint32_t idle_blocks;
+#if GFX_DISP_PERF_HIST
+        gfx_perf_hist_t latency;
+#endif
+    } wake;
 } gfx_core_context_t;
 
 /*********************
  *   INTERNAL API
  *********************/
 
+/**
+ * @brief Wake the render task (task context)
+ *
+ * Stamps the request time for the wake latency histogram unless an earlier
+ * request is still pending, then sets bits on render_events.
+ */
+void gfx_core_wake(gfx_core_context_t *ctx, EventBits_t bits);
+
+/**
+ * @brief gfx_core_wake() for interrupt handlers
+ */
+void gfx_core_wake_from_isr(gfx_core_context_t *ctx, EventBits_t bits);
+
 #ifdef __cplusplus
 }
 #endif
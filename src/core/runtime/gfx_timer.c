@@ -7,12 +7,17 @@
 /*********************
  *      INCLUDES
  *********************/
+#include <string.h>
+
+#include "esp_attr.h"
 #include "esp_timer.h"
 #include "esp_err.h"
+#include "esp_check.h"
 #include "esp_log.h"
 #define GFX_LOG_MODULE GFX_LOG_MODULE_TIMER
 #include "common/gfx_log_priv.h"
 
+#include "common/gfx_trace_priv.h"
 #include "core/runtime/gfx_core_priv.h"
 
 /*********************
@@ -35,10 +40,175 @@ static const char *TAG = "timer";
  *  STATIC PROTOTYPES
  **********************/
 
+static uint32_t gfx_timer_virtual_clock(void *user_data);
+static uint32_t gfx_timer_run_due(gfx_timer_mgr_t *timer_mgr);
+static void gfx_timer_mgr_rebase(gfx_timer_mgr_t *timer_mgr);
+static uint32_t gfx_timer_sched_period_us(const gfx_timer_mgr_t *timer_mgr);
+static void gfx_timer_sched_set_next(gfx_timer_mgr_t *timer_mgr, uint32_t now_ms, int64_t rel_us);
+static void gfx_timer_sched_sync_vsync(gfx_timer_mgr_t *timer_mgr, uint32_t now_ms);
+static bool gfx_timer_sched_due(gfx_timer_mgr_t *timer_mgr, uint32_t *out_remaining_ms);
+static esp_err_t gfx_timer_set_clock_locked(gfx_core_context_t *ctx, gfx_timer_clock_cb_t clock_cb, void *user_data);
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static uint32_t gfx_timer_virtual_clock(void *user_data)
+{
+    return ((const gfx_timer_mgr_t *)user_data)->clock.virtual_ms;
+}
+
+/** Execute due timers; returns ms until the next one is due (GFX_NO_TIMER_READY if none runs) */
+static uint32_t gfx_timer_run_due(gfx_timer_mgr_t *timer_mgr)
+{
+    uint32_t min_timer_remaining_ms = GFX_NO_TIMER_READY;
+    gfx_timer_t *timer_node = timer_mgr->timer_list;
+    gfx_timer_t *next_timer = NULL;
+
+    while (timer_node != NULL) {
+        next_timer = timer_node->next;
+
+        gfx_timer_exec(timer_node);
+
+        if (!timer_node->paused && timer_node->repeat_count != 0) {
+            uint32_t timer_elapsed_ms = gfx_timer_tick_elaps(timer_mgr, timer_node->last_run);
+            uint32_t timer_remaining_ms = (timer_elapsed_ms >= timer_node->period)
+                                          ? 0
+                                          : (timer_node->period - timer_elapsed_ms);
+
+            if (timer_remaining_ms < min_timer_remaining_ms) {
+                min_timer_remaining_ms = timer_remaining_ms;
+            }
+        }
+
+        timer_node = next_timer;
+    }
+
+    return min_timer_remaining_ms;
+}
+
+/** Restart every timer period and the FPS pacing from the current tick (after a clock switch) */
+static void gfx_timer_mgr_rebase(gfx_timer_mgr_t *timer_mgr)
+{
+    uint32_t now = gfx_timer_mgr_tick_get(timer_mgr);
+
+    for (gfx_timer_t *timer = timer_mgr->timer_list; timer != NULL; timer = timer->next) {
+        timer->last_run = now;
+    }
+    timer_mgr->sched.started = false;
+    timer_mgr->fps_last_tick = 0;
+    timer_mgr->fps_samples = 0;
+    timer_mgr->fps_elapsed_ms = 0;
+}
+
+/** Frame period: 1000/fps ms, snapped to the nearest whole number of vsync periods when one is set */
+static uint32_t gfx_timer_sched_period_us(const gfx_timer_mgr_t *timer_mgr)
+{
+    uint32_t period_us = (timer_mgr->fps > 0) ? (1000000U / timer_mgr->fps) : 30000U;
+    uint32_t vsync_us = timer_mgr->sched.vsync_period_us;
+
+    if (vsync_us != 0) {
+        uint32_t n = (period_us + vsync_us / 2) / vsync_us;
+        period_us = ((n > 0) ? n : 1) * vsync_us;
+    }
+    return period_us;
+}
+
+/** Put the next frame slot rel_us (may be negative) away from now_ms */
+static void gfx_timer_sched_set_next(gfx_timer_mgr_t *timer_mgr, uint32_t now_ms, int64_t rel_us)
+{
+    int64_t rel_ms = (rel_us >= 0) ? (rel_us / 1000) : -((-rel_us + 999) / 1000);
+
+    timer_mgr->sched.next_ms = now_ms + (uint32_t)(int32_t)rel_ms;
+    timer_mgr->sched.next_frac_us = (uint32_t)(rel_us - rel_ms * 1000);
+}
+
+/** Shift the frame phase onto the vsync edges after a new TE notification, keeping the frame period */
+static void gfx_timer_sched_sync_vsync(gfx_timer_mgr_t *timer_mgr, uint32_t now_ms)
+{
+    uint32_t vsync_period_us = timer_mgr->sched.vsync_period_us;
+    uint32_t vsync_us = __atomic_load_n(&timer_mgr->sched.vsync_us, __ATOMIC_RELAXED);
+
+    if (vsync_period_us == 0 || timer_mgr->clock.cb != NULL || !timer_mgr->sched.started ||
+            vsync_us == 0 || vsync_us == timer_mgr->sched.vsync_seen) {
+        return;
+    }
+    timer_mgr->sched.vsync_seen = vsync_us;
+
+    uint32_t age_us = (uint32_t)esp_timer_get_time() - vsync_us;
+    int64_t edge_rel_us = (int64_t)(vsync_period_us - (age_us % vsync_period_us));
+    int64_t next_rel_us = (int64_t)(int32_t)(timer_mgr->sched.next_ms - now_ms) * 1000 + timer_mgr->sched.next_frac_us;
+
+    /* Smallest move that puts the slot on an edge: within half a vsync period either way */
+    int64_t diff = (next_rel_us - edge_rel_us) % vsync_period_us;
+    if (diff < 0) {
+        diff += vsync_period_us;
+    }
+    if (diff >= vsync_period_us / 2) {
+        diff -= vsync_period_us;
+    }
+    gfx_timer_sched_set_next(timer_mgr, now_ms, next_rel_us - diff);
+}
+
+/**
+ * Decide whether a frame is due and move to the next slot when it is.
+ * Slots advance by whole periods from the previous slot, so a late frame does
+ * not push every later one back; slots already in the past are skipped.
+ */
+static bool gfx_timer_sched_due(gfx_timer_mgr_t *timer_mgr, uint32_t *out_remaining_ms)
+{
+    uint32_t now = gfx_timer_mgr_tick_get(timer_mgr);
+    uint32_t period_us = gfx_timer_sched_period_us(timer_mgr);
+    uint32_t lead_ms = 0;
+
+    if (!timer_mgr->sched.started) {
+        timer_mgr->sched.started = true;
+        timer_mgr->sched.next_ms = now;
+        timer_mgr->sched.next_frac_us = 0;
+    }
+    gfx_timer_sched_sync_vsync(timer_mgr, now);
+
+    if (timer_mgr->sched.vsync_period_us != 0) {
+        /* Start early enough that the frame is done by the edge */
+        uint32_t budget_us = (timer_mgr->sched.budget_us < period_us) ? timer_mgr->sched.budget_us : period_us;
+        lead_ms = (budget_us + 999U) / 1000U;
+    }
+
+    int32_t until_ms = (int32_t)(timer_mgr->sched.next_ms - lead_ms - now);
+    if (until_ms > 0) {
+        *out_remaining_ms = (uint32_t)until_ms;
+        return false;
+    }
+
+    int64_t next_rel_us = (int64_t)(int32_t)(timer_mgr->sched.next_ms - now) * 1000 + timer_mgr->sched.next_frac_us;
+    int64_t slots = (next_rel_us < 0) ? (-next_rel_us / period_us + 1) : 1;
+    gfx_timer_sched_set_next(timer_mgr, now, next_rel_us + slots * period_us);
+
+    until_ms = (int32_t)(timer_mgr->sched.next_ms - lead_ms - now);
+    *out_remaining_ms = (until_ms > 0) ? (uint32_t)until_ms : 0;
+    return true;
+}
+
+static esp_err_t gfx_timer_set_clock_locked(gfx_core_context_t *ctx, gfx_timer_clock_cb_t clock_cb, void *user_data)
+{
+    SemaphoreHandle_t mutex = ctx->sync.render_mutex;
+    gfx_timer_mgr_t *timer_mgr = &ctx->timer_mgr;
+
+    ESP_RETURN_ON_FALSE(mutex != NULL, ESP_ERR_INVALID_STATE, TAG, "set clock: mutex is NULL");
+    ESP_RETURN_ON_FALSE(xSemaphoreTakeRecursive(mutex, portMAX_DELAY) == pdTRUE, ESP_ERR_TIMEOUT, TAG,
+                        "set clock: acquire mutex failed");
+
+    if (clock_cb == gfx_timer_virtual_clock) {
+        timer_mgr->clock.virtual_ms = GFX_TIMER_VIRTUAL_CLOCK_START;
+    }
+    timer_mgr->clock.cb = clock_cb;
+    timer_mgr->clock.user_data = user_data;
+    gfx_timer_mgr_rebase(timer_mgr);
+
+    xSemaphoreGiveRecursive(mutex);
+    return ESP_OK;
+}
+
 /**********************
  *   PUBLIC FUNCTIONS
  **********************/
@@ -48,9 +218,17 @@ uint32_t gfx_timer_tick_get(void)
     return (uint32_t)(esp_timer_get_time() / 1000); // Convert microseconds to milliseconds
 }
 
-uint32_t gfx_timer_tick_elaps(uint32_t prev_tick)
+uint32_t gfx_timer_mgr_tick_get(const gfx_timer_mgr_t *timer_mgr)
+{
+    if (timer_mgr->clock.cb != NULL) {
+        return timer_mgr->clock.cb(timer_mgr->clock.user_data);
+    }
+    return gfx_timer_tick_get();
+}
+
+uint32_t gfx_timer_tick_elaps(const gfx_timer_mgr_t *timer_mgr, uint32_t prev_tick)
 {
-    uint32_t act_time = gfx_timer_tick_get();
+    uint32_t act_time = gfx_timer_mgr_tick_get(timer_mgr);
 
     /*If there is no overflow in sys_time simple subtract*/
     if (act_time >= prev_tick) {
@@ -75,13 +253,16 @@ bool gfx_timer_exec(gfx_timer_t *timer)
         return false;
     }
 
-    uint32_t time_elapsed = gfx_timer_tick_elaps(timer->last_run);
+    uint32_t time_elapsed = gfx_timer_tick_elaps(timer->mgr, timer->last_run);
 
     if (time_elapsed >= timer->period) {
-        timer->last_run = gfx_timer_tick_get() - (time_elapsed % timer->period);
+        timer->periods = (timer->period > 0) ? (time_elapsed / timer->period) : 1;
+        timer->last_run = gfx_timer_mgr_tick_get(timer->mgr) - (time_elapsed % timer->period);
 
         if (timer->timer_cb) {
+            GFX_TRACE_BEGIN("timer_cb", timer->period);
             timer->timer_cb(timer->user_data);
+            GFX_TRACE_END("timer_cb");
         }
 
         if (timer->repeat_count > 0) {
@@ -97,52 +278,16 @@ bool gfx_timer_exec(gfx_timer_t *timer)
 uint32_t gfx_timer_handler(gfx_timer_mgr_t *timer_mgr, bool *out_should_render)
 {
     /* Step 1: execute timers and find the minimum remaining time */
-    uint32_t min_timer_remaining_ms = GFX_NO_TIMER_READY;
-    gfx_timer_t *timer_node = timer_mgr->timer_list;
-    gfx_timer_t *next_timer = NULL;
+    uint32_t min_timer_remaining_ms = gfx_timer_run_due(timer_mgr);
 
-    while (timer_node != NULL) {
-        next_timer = timer_node->next;
-
-        gfx_timer_exec(timer_node);
-
-        if (!timer_node->paused && timer_node->repeat_count != 0) {
-            uint32_t timer_elapsed_ms = gfx_timer_tick_elaps(timer_node->last_run);
-            uint32_t timer_remaining_ms = (timer_elapsed_ms >= timer_node->period)
-                                          ? 0
-                                          : (timer_node->period - timer_elapsed_ms);
-
-            if (timer_remaining_ms < min_timer_remaining_ms) {
-                min_timer_remaining_ms = timer_remaining_ms;
-            }
-        }
-
-        timer_node = next_timer;
-    }
-
-    /* Step 2: update FPS period and render due state */
-    uint32_t fps_period_ms = (timer_mgr->fps > 0) ? (1000 / timer_mgr->fps) : 30;
-    uint32_t fps_elapsed_ms;
+    /* Step 2: advance the frame schedule */
     uint32_t fps_remaining_ms;
-    bool render_due;
+    bool render_due = gfx_timer_sched_due(timer_mgr, &fps_remaining_ms);
 
-    if (timer_mgr->last_tick == 0) {
-        render_due = true;
-        timer_mgr->last_tick = gfx_timer_tick_get();
-        fps_remaining_ms = fps_period_ms;
-    } else {
-        fps_elapsed_ms = gfx_timer_tick_elaps(timer_mgr->last_tick);
-        fps_remaining_ms = (fps_elapsed_ms >= fps_period_ms) ? 0 : (fps_period_ms - fps_elapsed_ms);
-        render_due = (fps_remaining_ms == 0);
-        if (render_due) {
-            timer_mgr->last_tick = gfx_timer_tick_get();
-        }
-    }
-
-    /* Step 3: calculate the next task delay */
+    /* Step 3: calculate the next task delay; with no active timer nothing changes until someone wakes the task */
     uint32_t task_delay_ms;
     if (min_timer_remaining_ms == GFX_NO_TIMER_READY) {
-        task_delay_ms = (fps_remaining_ms > 0) ? fps_remaining_ms : 1;
+        task_delay_ms = GFX_NO_TIMER_READY;
     } else {
         task_delay_ms = (min_timer_remaining_ms < fps_remaining_ms)
                         ? min_timer_remaining_ms
@@ -176,12 +321,14 @@ gfx_timer_handle_t gfx_timer_create(void *handle, gfx_timer_cb_t timer_cb, uint3
         return NULL;
     }
 
+    new_timer->mgr = timer_mgr;
     new_timer->period = period;
     new_timer->timer_cb = timer_cb;
     new_timer->user_data = user_data;
     new_timer->repeat_count = -1;
+    new_timer->periods = 0;
     new_timer->paused = false;
-    new_timer->last_run = gfx_timer_tick_get();
+    new_timer->last_run = gfx_timer_mgr_tick_get(timer_mgr);
     new_timer->next = NULL;
 
     if (timer_mgr->timer_list == NULL) {
@@ -194,6 +341,7 @@ gfx_timer_handle_t gfx_timer_create(void *handle, gfx_timer_cb_t timer_cb, uint3
         current_timer->next = new_timer;
     }
 
+    gfx_core_wake(ctx, GFX_EVENT_TIMER);
     return (gfx_timer_handle_t)new_timer;
 }
 
@@ -240,11 +388,12 @@ void gfx_timer_resume(gfx_timer_handle_t timer_handle)
     if (timer_handle != NULL) {
         gfx_timer_t *timer = (gfx_timer_t *)timer_handle;
         timer->paused = false;
-        timer->last_run = gfx_timer_tick_get();
+        timer->last_run = gfx_timer_mgr_tick_get(timer->mgr);
 
         if (timer->repeat_count == 0) {
             timer->repeat_count = -1;
         }
+        gfx_core_wake(timer->mgr->ctx, GFX_EVENT_TIMER);
     }
 }
 
@@ -253,6 +402,7 @@ void gfx_timer_set_repeat_count(gfx_timer_handle_t timer_handle, int32_t repeat_
     if (timer_handle != NULL) {
         gfx_timer_t *timer = (gfx_timer_t *)timer_handle;
         timer->repeat_count = repeat_count;
+        gfx_core_wake(timer->mgr->ctx, GFX_EVENT_TIMER);
     }
 }
 
@@ -261,6 +411,7 @@ void gfx_timer_set_period(gfx_timer_handle_t timer_handle, uint32_t period)
     if (timer_handle != NULL) {
         gfx_timer_t *timer = (gfx_timer_t *)timer_handle;
         timer->period = period;
+        gfx_core_wake(timer->mgr->ctx, GFX_EVENT_TIMER);
     }
 }
 
@@ -268,10 +419,19 @@ void gfx_timer_reset(gfx_timer_handle_t timer_handle)
 {
     if (timer_handle != NULL) {
         gfx_timer_t *timer = (gfx_timer_t *)timer_handle;
-        timer->last_run = gfx_timer_tick_get();
+        timer->last_run = gfx_timer_mgr_tick_get(timer->mgr);
+        gfx_core_wake(timer->mgr->ctx, GFX_EVENT_TIMER);
     }
 }
 
+uint32_t gfx_timer_get_elapsed_periods(gfx_timer_handle_t timer_handle)
+{
+    if (timer_handle == NULL) {
+        return 0;
+    }
+    return ((gfx_timer_t *)timer_handle)->periods;
+}
+
 bool gfx_timer_is_running(gfx_timer_handle_t timer_handle)
 {
     if (timer_handle != NULL) {
@@ -281,14 +441,40 @@ bool gfx_timer_is_running(gfx_timer_handle_t timer_handle)
     return false;
 }
 
-void gfx_timer_mgr_init(gfx_timer_mgr_t *timer_mgr, uint32_t fps)
+void gfx_timer_sched_record(gfx_timer_mgr_t *timer_mgr, uint32_t render_us)
+{
+    uint32_t period_us = gfx_timer_sched_period_us(timer_mgr);
+
+    if (timer_mgr->sched.frames == 0) {
+        timer_mgr->sched.budget_us = render_us;
+    } else {
+        int32_t delta = (int32_t)(render_us - timer_mgr->sched.budget_us);
+        timer_mgr->sched.budget_us += delta / (1 << GFX_TIMER_SCHED_BUDGET_SHIFT);
+    }
+    timer_mgr->sched.frames++;
+
+    if (render_us > period_us) {
+        /* Every slot that went by while this frame rendered is lost */
+        timer_mgr->sched.overruns++;
+        timer_mgr->sched.dropped += render_us / period_us;
+    }
+}
+
+void gfx_timer_mgr_init(gfx_timer_mgr_t *timer_mgr, struct gfx_core_context *ctx, uint32_t fps)
 {
     if (timer_mgr != NULL) {
+        timer_mgr->ctx = ctx;
         timer_mgr->timer_list = NULL;
         timer_mgr->time_until_next = GFX_NO_TIMER_READY;
-        timer_mgr->last_tick = 0;
         timer_mgr->fps = fps;
         timer_mgr->actual_fps = 0;
+        timer_mgr->fps_last_tick = 0;
+        timer_mgr->fps_samples = 0;
+        timer_mgr->fps_elapsed_ms = 0;
+        timer_mgr->clock.cb = NULL;
+        timer_mgr->clock.user_data = NULL;
+        timer_mgr->clock.virtual_ms = 0;
+        memset(&timer_mgr->sched, 0, sizeof(timer_mgr->sched));
         GFX_LOGI(TAG, "init timer manager: fps=%"PRIu32" period=%"PRIu32" ms", fps, (fps > 0) ? (1000 / fps) : 30);
     }
 }
@@ -320,3 +506,115 @@ uint32_t gfx_timer_get_actual_fps(void *handle)
 
     return timer_mgr->actual_fps;
 }
+
+esp_err_t gfx_timer_set_clock(void *handle, gfx_timer_clock_cb_t clock_cb, void *user_data)
+{
+    ESP_RETURN_ON_FALSE(handle != NULL, ESP_ERR_INVALID_ARG, TAG, "set clock: handle is NULL");
+    return gfx_timer_set_clock_locked((gfx_core_context_t *)handle, clock_cb, user_data);
+}
+
+esp_err_t gfx_timer_set_virtual_clock(void *handle, bool enable)
+{
+    ESP_RETURN_ON_FALSE(handle != NULL, ESP_ERR_INVALID_ARG, TAG, "set virtual clock: handle is NULL");
+    gfx_core_context_t *ctx = (gfx_core_context_t *)handle;
+
+    if (!enable) {
+        return gfx_timer_set_clock_locked(ctx, NULL, NULL);
+    }
+    return gfx_timer_set_clock_locked(ctx, gfx_timer_virtual_clock, &ctx->timer_mgr);
+}
+
+esp_err_t gfx_timer_step(void *handle, uint32_t ms)
+{
+    ESP_RETURN_ON_FALSE(handle != NULL, ESP_ERR_INVALID_ARG, TAG, "step: handle is NULL");
+    gfx_core_context_t *ctx = (gfx_core_context_t *)handle;
+    gfx_timer_mgr_t *timer_mgr = &ctx->timer_mgr;
+    SemaphoreHandle_t mutex = ctx->sync.render_mutex;
+
+    ESP_RETURN_ON_FALSE(mutex != NULL, ESP_ERR_INVALID_STATE, TAG, "step: mutex is NULL");
+    ESP_RETURN_ON_FALSE(xSemaphoreTakeRecursive(mutex, portMAX_DELAY) == pdTRUE, ESP_ERR_TIMEOUT, TAG,
+                        "step: acquire mutex failed");
+
+    if (timer_mgr->clock.cb != gfx_timer_virtual_clock) {
+        xSemaphoreGiveRecursive(mutex);
+        GFX_LOGE(TAG, "step: virtual clock is not enabled");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    /* Advance to each timer deadline in turn so every period fires, whatever the step size */
+    uint32_t remaining = ms;
+    for (;;) {
+        uint32_t next_ms = gfx_timer_run_due(timer_mgr);
+        if (remaining == 0) {
+            break;
+        }
+        uint32_t dt = (next_ms < remaining) ? next_ms : remaining;
+        if (dt == 0) {
+            dt = 1;
+        }
+        timer_mgr->clock.virtual_ms += dt;
+        remaining -= dt;
+    }
+
+    xSemaphoreGiveRecursive(mutex);
+    return ESP_OK;
+}
+
+uint32_t gfx_timer_clock_get(void *handle)
+{
+    if (handle == NULL) {
+        return 0;
+    }
+    return gfx_timer_mgr_tick_get(&((gfx_core_context_t *)handle)->timer_mgr);
+}
+
+esp_err_t gfx_timer_set_vsync(void *handle, uint32_t period_us)
+{
+    ESP_RETURN_ON_FALSE(handle != NULL, ESP_ERR_INVALID_ARG, TAG, "set vsync: handle is NULL");
+    gfx_core_context_t *ctx = (gfx_core_context_t *)handle;
+    SemaphoreHandle_t mutex = ctx->sync.render_mutex;
+
+    ESP_RETURN_ON_FALSE(mutex != NULL, ESP_ERR_INVALID_STATE, TAG, "set vsync: mutex is NULL");
+    ESP_RETURN_ON_FALSE(xSemaphoreTakeRecursive(mutex, portMAX_DELAY) == pdTRUE, ESP_ERR_TIMEOUT, TAG,
+                        "set vsync: acquire mutex failed");
+
+    ctx->timer_mgr.sched.vsync_period_us = period_us;
+    ctx->timer_mgr.sched.vsync_seen = 0;
+    gfx_core_wake(ctx, GFX_EVENT_TIMER);
+
+    xSemaphoreGiveRecursive(mutex);
+    GFX_LOGI(TAG, "set vsync: period=%"PRIu32" us frame=%"PRIu32" us", period_us,
+             gfx_timer_sched_period_us(&ctx->timer_mgr));
+    return ESP_OK;
+}
+
+void IRAM_ATTR gfx_timer_vsync_notify_from_isr(void *handle)
+{
+    if (handle == NULL) {
+        return;
+    }
+
+    uint32_t now_us = (uint32_t)esp_timer_get_time();
+    __atomic_store_n(&((gfx_core_context_t *)handle)->timer_mgr.sched.vsync_us, (now_us != 0) ? now_us : 1U,
+                     __ATOMIC_RELAXED);
+}
+
+esp_err_t gfx_timer_get_sched_stats(void *handle, gfx_timer_sched_stats_t *out)
+{
+    ESP_RETURN_ON_FALSE(handle != NULL && out != NULL, ESP_ERR_INVALID_ARG, TAG, "get sched stats: invalid argument");
+    gfx_core_context_t *ctx = (gfx_core_context_t *)handle;
+    SemaphoreHandle_t mutex = ctx->sync.render_mutex;
+
+    ESP_RETURN_ON_FALSE(mutex != NULL, ESP_ERR_INVALID_STATE, TAG, "get sched stats: mutex is NULL");
+    ESP_RETURN_ON_FALSE(xSemaphoreTakeRecursive(mutex, portMAX_DELAY) == pdTRUE, ESP_ERR_TIMEOUT, TAG,
+                        "get sched stats: acquire mutex failed");
+
+    out->frames = ctx->timer_mgr.sched.frames;
+    out->dropped = ctx->timer_mgr.sched.dropped;
+    out->overruns = ctx->timer_mgr.sched.overruns;
+    out->budget_us = ctx->timer_mgr.sched.budget_us;
+    out->period_us = gfx_timer_sched_period_us(&ctx->timer_mgr);
+
+    xSemaphoreGiveRecursive(mutex);
+    return ESP_OK;
+}
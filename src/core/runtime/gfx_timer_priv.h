@@ -17,6 +17,10 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define GFX_TIMER_FPS_SAMPLE_WINDOW 100   /**< Render handler calls averaged into actual_fps */
+#define GFX_TIMER_VIRTUAL_CLOCK_START 1     /**< First tick of the virtual clock */
+#define GFX_TIMER_SCHED_BUDGET_SHIFT 3      /**< Render budget EWMA weight: 1/8 per frame */
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -24,27 +28,52 @@ extern "C" {
 /* Timer handle type for external use */
 typedef void *gfx_timer_handle_t;
 
+struct gfx_timer_mgr_s;
+struct gfx_core_context;
+
 /* Timer structure (internal use) */
 typedef struct gfx_timer_s {
+    struct gfx_timer_mgr_s *mgr;    ///< Owning manager, for its clock
     uint32_t period;
     uint32_t last_run;
     gfx_timer_cb_t timer_cb;
     void *user_data;
     int32_t repeat_count;
+    uint32_t periods;               ///< Periods elapsed at the last firing (>1 when it ran late)
     bool paused;
     struct gfx_timer_s *next;
 } gfx_timer_t;
 
 /* Timer manager structure (internal use) */
-typedef struct {
+typedef struct gfx_timer_mgr_s {
+    struct gfx_core_context *ctx;   ///< Owner, woken when a timer is added or rearmed
     gfx_timer_t *timer_list;
     uint32_t time_until_next;
-    uint32_t last_tick;
     uint32_t fps; ///< Target FPS for timer scheduling
     uint32_t actual_fps; ///< Actual measured FPS
-    /* FPS statistics */
-    uint32_t fps_last_report_tick;
-    uint32_t fps_report_interval_ms;
+    /* FPS statistics, sampled once per gfx_render_handler() call */
+    uint32_t fps_last_tick;
+    uint32_t fps_samples;
+    uint32_t fps_elapsed_ms;
+    /* Clock source for timers and FPS pacing; NULL cb = esp_timer wall clock */
+    struct {
+        gfx_timer_clock_cb_t cb;
+        void *user_data;
+        uint32_t virtual_ms;    ///< Current time of the built-in virtual clock
+    } clock;
+    /* Frame scheduler: fixed-phase frame slots, optionally locked to the panel vsync */
+    struct {
+        bool started;
+        uint32_t next_ms;       ///< Clock tick of the next frame slot
+        uint32_t next_frac_us;  ///< Sub-millisecond part of next_ms
+        uint32_t vsync_period_us;   ///< 0 = pace by fps only
+        uint32_t vsync_us;      ///< Last TE edge (esp_timer, low 32 bits, never 0), written from ISR
+        uint32_t vsync_seen;    ///< vsync_us already used to re-anchor next_ms
+        uint32_t budget_us;     ///< Smoothed render time of one frame
+        uint32_t frames;
+        uint32_t dropped;
+        uint32_t overruns;
+    } sched;
 } gfx_timer_mgr_t;
 
 /**********************
@@ -60,12 +89,20 @@ typedef struct {
  */
 uint32_t gfx_timer_tick_get(void);
 
+/**
+ * @brief Get the current tick of a timer manager's clock (internal)
+ * @param timer_mgr Timer manager
+ * @return Current tick value in milliseconds
+ */
+uint32_t gfx_timer_mgr_tick_get(const gfx_timer_mgr_t *timer_mgr);
+
 /**
  * @brief Calculate elapsed time since previous tick (internal)
+ * @param timer_mgr Timer manager whose clock prev_tick came from
  * @param prev_tick Previous tick value
  * @return Elapsed time in milliseconds
  */
-uint32_t gfx_timer_tick_elaps(uint32_t prev_tick);
+uint32_t gfx_timer_tick_elaps(const gfx_timer_mgr_t *timer_mgr, uint32_t prev_tick);
 
 /**
  * @brief Execute a timer
@@ -77,17 +114,27 @@ bool gfx_timer_exec(gfx_timer_t *timer);
 /**
  * @brief Handle timer manager operations
  * @param timer_mgr Timer manager
- * @param out_should_render If non-NULL, set to true when a render is due this frame (FPS interval elapsed)
- * @return Time in ms until next timer or FPS tick (for task sleep)
+ * @param out_should_render If non-NULL, set to true when a render is due (a frame slot has started;
+ *                          with vsync, the render budget before the next edge)
+ * @return Time in ms until next timer or FPS tick (for task sleep), ANIM_NO_TIMER_READY
+ *         when no timer is active (sleep until woken)
  */
 uint32_t gfx_timer_handler(gfx_timer_mgr_t *timer_mgr, bool *out_should_render);
 
+/**
+ * @brief Account one frame rendered by the render task
+ * @param timer_mgr Timer manager
+ * @param render_us Time spent rendering and flushing the frame
+ */
+void gfx_timer_sched_record(gfx_timer_mgr_t *timer_mgr, uint32_t render_us);
+
 /**
  * @brief Initialize timer manager
  * @param timer_mgr Timer manager to initialize
+ * @param ctx Owning context
  * @param fps Target FPS for timer scheduling
  */
-void gfx_timer_mgr_init(gfx_timer_mgr_t *timer_mgr, uint32_t fps);
+void gfx_timer_mgr_init(gfx_timer_mgr_t *timer_mgr, struct gfx_core_context *ctx, uint32_t fps);
 
 /**
  * @brief Deinitialize timer manager
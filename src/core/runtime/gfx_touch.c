@@ -55,16 +55,20 @@ static void gfx_touch_poll_cb(void *user_data);
  *   STATIC FUNCTIONS
  **********************/
 
-/** Return topmost visible object on disp that contains (x, y), or NULL (same order as render = last in list = front) */
-static gfx_obj_t *gfx_touch_hit_test(gfx_disp_t *disp, uint16_t x, uint16_t y)
+/**
+ * Return topmost visible child of parent (NULL = top level) that contains (x, y), or NULL.
+ * Same order as render: later in list = front, children in front of their container.
+ * Containers clip their children, so a container is only searched when the point is inside it.
+ */
+static gfx_obj_t *gfx_touch_hit_test_in(gfx_disp_t *disp, const gfx_obj_t *parent, uint16_t x, uint16_t y)
 {
     gfx_obj_t *hit = NULL;
-    for (gfx_obj_child_t *n = disp->child_list; n != NULL; n = n->next) {
-        gfx_obj_t *obj = (gfx_obj_t *)n->src;
-        if (!obj->state.is_visible) {
+    for (uint16_t i = 0; i < disp->children.count; i++) {
+        gfx_obj_t *obj = disp->children.objs[i];
+        if (obj->parent != parent || !obj->state.is_visible) {
             continue;
         }
-        if (obj->align.enabled || obj->state.layout_dirty) {
+        if (obj->align.enabled || obj->state.layout_dirty || obj->parent != NULL) {
             gfx_obj_calc_pos_in_parent(obj);
         }
         int32_t ox = obj->geometry.x;
@@ -76,11 +80,22 @@ static gfx_obj_t *gfx_touch_hit_test(gfx_disp_t *disp, uint16_t x, uint16_t y)
         }
         if ((int32_t)x >= ox && (int32_t)x < ox + (int32_t)w && (int32_t)y >= oy && (int32_t)y < oy + (int32_t)h) {
             hit = obj;
+            if (obj->type == GFX_OBJ_TYPE_CONTAINER) {
+                gfx_obj_t *child_hit = gfx_touch_hit_test_in(disp, obj, x, y);
+                if (child_hit != NULL) {
+                    hit = child_hit;
+                }
+            }
         }
     }
     return hit;
 }
 
+static gfx_obj_t *gfx_touch_hit_test(gfx_disp_t *disp, uint16_t x, uint16_t y)
+{
+    return gfx_touch_hit_test_in(disp, NULL, x, y);
+}
+
 static uint32_t gfx_touch_now_ms(void)
 {
     return (uint32_t)(esp_timer_get_time() / 1000);
@@ -155,6 +170,7 @@ static void IRAM_ATTR gfx_touch_isr(esp_lcd_touch_handle_t tp)
     }
 
     isr_ctx->touch->irq_pending = true;
+    gfx_core_wake_from_isr(isr_ctx->touch->ctx, GFX_EVENT_TOUCH);
 }
 
 static esp_err_t gfx_touch_enable_interrupt(gfx_touch_t *touch)
@@ -335,11 +351,24 @@ esp_err_t gfx_touch_start(gfx_touch_t *touch, const gfx_touch_config_t *cfg)
         }
         return ESP_ERR_NO_MEM;
     }
+    if (touch->irq_enabled) {
+        /* The ISR wakes the render task (gfx_touch_service_irq); polling would keep it from idling */
+        gfx_timer_pause(touch->poll_timer);
+    }
 
     GFX_LOGD(TAG, "init touch: polling started (%"PRIu32" ms)", touch->poll_ms);
     return ESP_OK;
 }
 
+void gfx_touch_service_irq(struct gfx_core_context *ctx)
+{
+    for (gfx_touch_t *touch = ctx->touch; touch != NULL; touch = touch->next) {
+        if (touch->irq_enabled && touch->irq_pending) {
+            gfx_touch_poll_cb(touch);
+        }
+    }
+}
+
 void gfx_touch_del(gfx_touch_t *touch)
 {
     if (!touch) {
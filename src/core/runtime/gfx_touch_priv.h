@@ -57,6 +57,11 @@ struct gfx_touch {
  *********************/
 esp_err_t gfx_touch_start(gfx_touch_t *touch, const gfx_touch_config_t *cfg);
 
+/**
+ * @brief Read and dispatch every touch device whose interrupt fired (render task, lock held)
+ */
+void gfx_touch_service_irq(struct gfx_core_context *ctx);
+
 #ifdef __cplusplus
 }
 #endif
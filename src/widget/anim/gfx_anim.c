@@ -11,6 +11,7 @@
 #include <inttypes.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
+#include "freertos/semphr.h"
 #include "esp_check.h"
 #include "esp_err.h"
 #include "esp_heap_caps.h"
@@ -18,6 +19,8 @@
 #define GFX_LOG_MODULE GFX_LOG_MODULE_ANIM
 #include "common/gfx_log_priv.h"
 #include "common/gfx_comm.h"
+#include "common/gfx_config_internal.h"
+#include "common/gfx_trace_priv.h"
 #include "core/display/gfx_refr_priv.h"
 #include "core/object/gfx_obj_priv.h"
 #include "widget/gfx_anim.h"
@@ -59,6 +62,10 @@ typedef struct {
     uint8_t *pixel_buffer;
     uint32_t *color_palette;
     int last_block;
+#if GFX_RENDER_STRIPE_WORKERS > 0
+    uint8_t *stripe_buffer[GFX_RENDER_STRIPE_WORKERS];  /**< Block buffer of stripe worker i, allocated on its first draw */
+    int stripe_block[GFX_RENDER_STRIPE_WORKERS];        /**< Block resident in stripe_buffer[i] */
+#endif
 } gfx_anim_frame_info_t;
 
 typedef struct {
@@ -75,7 +82,9 @@ typedef struct {
     size_t pending_segment_index;
     bool segment_paused;
     bool drain_remaining_segments;
+    bool frame_skip;                        /**< Advance one frame per elapsed timer period, not per callback */
     EventGroupHandle_t event_group;
+    SemaphoreHandle_t decode_lock;          /**< Serializes decoder calls from stripe workers; blending runs unlocked */
     gfx_timer_handle_t timer;
     gfx_anim_src_t src;
     const gfx_anim_decoder_ops_t *decoder;
@@ -105,6 +114,8 @@ typedef void (*gfx_anim_pixel_renderer_cb_t)(
 
 static esp_err_t gfx_anim_delete(gfx_obj_t *obj);
 static esp_err_t gfx_anim_update(gfx_obj_t *obj);
+static esp_err_t gfx_anim_draw_block(gfx_anim_t *anim, const gfx_draw_ctx_t *ctx, int block_idx,
+                                     gfx_area_t *clip_block, int src_offset_x, int src_offset_y);
 static esp_err_t gfx_draw_animation(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx);
 static void gfx_anim_free_frame_buffers(gfx_anim_frame_info_t *frame);
 static void gfx_anim_reset_runtime_state(gfx_anim_t *anim);
@@ -125,6 +136,7 @@ static esp_err_t gfx_anim_set_src_desc_with_decoder_internal(gfx_obj_t *obj, con
         const gfx_anim_src_t *src_desc);
 static void gfx_anim_calculate_offsets(const gfx_anim_frame_desc_t *frame_desc, uint32_t *offsets);
 static size_t gfx_anim_get_pixel_buffer_size(const gfx_anim_frame_desc_t *frame_desc);
+static uint8_t *gfx_anim_alloc_pixel_buffer(const gfx_anim_frame_desc_t *frame_desc, size_t size);
 static esp_err_t gfx_anim_init_palette_cache(gfx_obj_t *obj, gfx_anim_t *anim);
 static void gfx_anim_update_geometry(gfx_obj_t *obj, gfx_anim_t *anim);
 static esp_err_t gfx_anim_render_pixels(uint8_t bit_depth,
@@ -149,6 +161,7 @@ static void gfx_anim_render_24bit_pixels(gfx_color_t *dest_pixels, gfx_coord_t d
         gfx_area_t *clip_area,
         gfx_mirror_mode_t mirror_mode, int16_t mirror_offset, int dest_x_offset);
 static void gfx_anim_timer_callback(void *arg);
+static bool gfx_anim_is_opaque(gfx_obj_t *obj);
 
 /**********************
  *  STATIC VARIABLES
@@ -166,6 +179,7 @@ static const gfx_widget_class_t s_gfx_anim_widget_class = {
     .delete = gfx_anim_delete,
     .update = gfx_anim_update,
     .touch_event = NULL,
+    .is_opaque = gfx_anim_is_opaque,
 };
 
 /**********************
@@ -186,6 +200,12 @@ static void gfx_anim_free_frame_buffers(gfx_anim_frame_info_t *frame)
         free(frame->color_palette);
         frame->color_palette = NULL;
     }
+#if GFX_RENDER_STRIPE_WORKERS > 0
+    for (int i = 0; i < GFX_RENDER_STRIPE_WORKERS; i++) {
+        free(frame->stripe_buffer[i]);
+        frame->stripe_buffer[i] = NULL;
+    }
+#endif
 }
 
 static void gfx_anim_reset_runtime_state(gfx_anim_t *anim)
@@ -383,6 +403,14 @@ static size_t gfx_anim_get_pixel_buffer_size(const gfx_anim_frame_desc_t *frame_
     return 0;
 }
 
+static uint8_t *gfx_anim_alloc_pixel_buffer(const gfx_anim_frame_desc_t *frame_desc, size_t size)
+{
+    if (frame_desc->bit_depth == GFX_ANIM_DEPTH_24BIT) {
+        return heap_caps_aligned_alloc(16, size, MALLOC_CAP_DEFAULT);
+    }
+    return malloc(size);
+}
+
 static esp_err_t gfx_anim_init_palette_cache(gfx_obj_t *obj, gfx_anim_t *anim)
 {
     const gfx_anim_frame_desc_t *frame_desc = &anim->frame.desc;
@@ -458,11 +486,7 @@ static esp_err_t gfx_anim_prepare_frame(gfx_obj_t *obj)
     anim->frame.block_offsets = malloc(anim->frame.desc.blocks * sizeof(uint32_t));
     ESP_GOTO_ON_FALSE(anim->frame.block_offsets != NULL, ESP_ERR_NO_MEM, err, TAG, "prepare frame: failed to allocate block offsets");
 
-    if (anim->frame.desc.bit_depth == GFX_ANIM_DEPTH_24BIT) {
-        anim->frame.pixel_buffer = heap_caps_aligned_alloc(16, pixel_buffer_size, MALLOC_CAP_DEFAULT);
-    } else {
-        anim->frame.pixel_buffer = malloc(pixel_buffer_size);
-    }
+    anim->frame.pixel_buffer = gfx_anim_alloc_pixel_buffer(&anim->frame.desc, pixel_buffer_size);
     ESP_GOTO_ON_FALSE(anim->frame.pixel_buffer != NULL, ESP_ERR_NO_MEM, err, TAG, "prepare frame: failed to allocate pixel buffer");
 
     ESP_GOTO_ON_ERROR(gfx_anim_init_palette_cache(obj, anim), err, TAG, "prepare frame: failed to initialize palette cache");
@@ -684,6 +708,77 @@ static void gfx_anim_render_24bit_pixels(gfx_color_t *dest_pixels, gfx_coord_t d
     }
 }
 
+/**
+ * Decode one block into the drawing stripe's block buffer (unless already resident) and blend clip_block.
+ * Each stripe owns its buffer, so only the decoder call is serialized by decode_lock.
+ */
+static esp_err_t gfx_anim_draw_block(gfx_anim_t *anim, const gfx_draw_ctx_t *ctx, int block_idx,
+                                     gfx_area_t *clip_block, int src_offset_x, int src_offset_y)
+{
+    const gfx_anim_frame_desc_t *frame_desc = &anim->frame.desc;
+    uint8_t *pixel_buffer = anim->frame.pixel_buffer;
+    int *resident_block = &anim->frame.last_block;
+
+#if GFX_RENDER_STRIPE_WORKERS > 0
+    if (ctx->stripe > 0 && ctx->stripe <= GFX_RENDER_STRIPE_WORKERS) {
+        int worker = ctx->stripe - 1;
+
+        if (anim->frame.stripe_buffer[worker] == NULL) {
+            anim->frame.stripe_buffer[worker] = gfx_anim_alloc_pixel_buffer(frame_desc, gfx_anim_get_pixel_buffer_size(frame_desc));
+            ESP_RETURN_ON_FALSE(anim->frame.stripe_buffer[worker] != NULL, ESP_ERR_NO_MEM, TAG,
+                                "draw animation: failed to allocate stripe %d block buffer", worker);
+            anim->frame.stripe_block[worker] = -1;
+        }
+        pixel_buffer = anim->frame.stripe_buffer[worker];
+        resident_block = &anim->frame.stripe_block[worker];
+    }
+#endif
+
+    if (block_idx != *resident_block) {
+        const uint8_t *block_data = (const uint8_t *)anim->frame.frame_data + anim->frame.block_offsets[block_idx];
+        int block_len = frame_desc->block_len[block_idx];
+
+        if (anim->decode_lock != NULL) {
+            xSemaphoreTake(anim->decode_lock, portMAX_DELAY);
+        }
+        GFX_TRACE_BEGIN("decode_block", block_idx);
+        esp_err_t decode_result = anim->decoder->decode_block(frame_desc, block_data, block_len, pixel_buffer, ctx->swap);
+        GFX_TRACE_END("decode_block");
+        if (anim->decode_lock != NULL) {
+            xSemaphoreGive(anim->decode_lock);
+        }
+        if (decode_result != ESP_OK) {
+            *resident_block = -1;
+            return decode_result;
+        }
+        *resident_block = block_idx;
+    }
+
+    gfx_coord_t src_stride = frame_desc->width;
+    uint8_t *src_pixels = NULL;
+
+    if (frame_desc->bit_depth == GFX_ANIM_DEPTH_24BIT) {
+        src_pixels = GFX_BUFFER_OFFSET_16BPP(pixel_buffer, src_offset_y, src_stride, src_offset_x);
+    } else if (frame_desc->bit_depth == GFX_ANIM_DEPTH_4BIT) {
+        src_pixels = GFX_BUFFER_OFFSET_4BPP(pixel_buffer, src_offset_y, src_stride, src_offset_x);
+    } else if (frame_desc->bit_depth == GFX_ANIM_DEPTH_8BIT) {
+        src_pixels = GFX_BUFFER_OFFSET_8BPP(pixel_buffer, src_offset_y, src_stride, src_offset_x);
+    } else {
+        GFX_LOGE(TAG, "draw animation: unsupported bit depth %d", frame_desc->bit_depth);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    gfx_color_t *dest_pixels = GFX_DRAW_CTX_DEST_PTR(ctx, clip_block->x1, clip_block->y1);
+    int dest_x_offset = clip_block->x1 - ctx->buf_area.x1;
+
+    return gfx_anim_render_pixels(frame_desc->bit_depth,
+                                  dest_pixels, ctx->stride,
+                                  src_pixels, src_stride,
+                                  frame_desc, anim->frame.color_palette,
+                                  clip_block,
+                                  anim->mirror_mode, anim->mirror_offset, dest_x_offset);
+}
+
 static esp_err_t gfx_draw_animation(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
 {
     if (obj == NULL || obj->src == NULL || ctx == NULL) {
@@ -709,12 +804,8 @@ static esp_err_t gfx_draw_animation(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
     }
 
     const gfx_anim_frame_desc_t *frame_desc = &anim->frame.desc;
-    uint8_t *pixel_buffer = anim->frame.pixel_buffer;
-    uint32_t *block_offsets = anim->frame.block_offsets;
-    uint32_t *palette_cache = anim->frame.color_palette;
-    int *last_block_idx = &anim->frame.last_block;
 
-    if (block_offsets == NULL || pixel_buffer == NULL) {
+    if (anim->frame.block_offsets == NULL || anim->frame.pixel_buffer == NULL) {
         GFX_LOGE(TAG, "draw animation: frame[%" PRIu32 "] decode resources are not ready", anim->current_frame);
         return ESP_ERR_INVALID_STATE;
     }
@@ -724,8 +815,6 @@ static esp_err_t gfx_draw_animation(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
     int block_height = frame_desc->block_height;
     int num_blocks = frame_desc->blocks;
 
-    gfx_obj_calc_pos_in_parent(obj);
-
     gfx_area_t render_area = ctx->clip_area;
     gfx_area_t obj_area = {
         obj->geometry.x,
@@ -765,45 +854,25 @@ static esp_err_t gfx_draw_animation(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
             continue;
         }
 
-        if (block_idx != *last_block_idx) {
-            const uint8_t *block_data = (const uint8_t *)anim->frame.frame_data + block_offsets[block_idx];
-            int block_len = frame_desc->block_len[block_idx];
-            esp_err_t decode_result = anim->decoder->decode_block(frame_desc, block_data, block_len, pixel_buffer, ctx->swap);
-            if (decode_result != ESP_OK) {
-                continue;
-            }
-            *last_block_idx = block_idx;
+        esp_err_t block_ret = gfx_anim_draw_block(anim, ctx, block_idx, &clip_block, src_offset_x, src_offset_y);
+        if (block_ret == ESP_ERR_INVALID_ARG || block_ret == ESP_ERR_NO_MEM) {
+            return block_ret;
         }
+    }
 
-        gfx_coord_t src_stride = frame_width;
-        uint8_t *src_pixels = NULL;
-
-        if (frame_desc->bit_depth == GFX_ANIM_DEPTH_24BIT) {
-            src_pixels = GFX_BUFFER_OFFSET_16BPP(pixel_buffer, src_offset_y, src_stride, src_offset_x);
-        } else if (frame_desc->bit_depth == GFX_ANIM_DEPTH_4BIT) {
-            src_pixels = GFX_BUFFER_OFFSET_4BPP(pixel_buffer, src_offset_y, src_stride, src_offset_x);
-        } else if (frame_desc->bit_depth == GFX_ANIM_DEPTH_8BIT) {
-            src_pixels = GFX_BUFFER_OFFSET_8BPP(pixel_buffer, src_offset_y, src_stride, src_offset_x);
-        } else {
-            GFX_LOGE(TAG, "draw animation: unsupported bit depth %d", frame_desc->bit_depth);
-            return ESP_ERR_INVALID_ARG;
-        }
+    return ESP_OK;
+}
 
-        gfx_color_t *dest_pixels = GFX_DRAW_CTX_DEST_PTR(ctx, clip_block.x1, clip_block.y1);
-        int dest_x_offset = clip_block.x1 - ctx->buf_area.x1;
+static bool gfx_anim_is_opaque(gfx_obj_t *obj)
+{
+    gfx_anim_t *anim = (gfx_anim_t *)obj->src;
 
-        esp_err_t render_result = gfx_anim_render_pixels(frame_desc->bit_depth,
-                                  dest_pixels, ctx->stride,
-                                  src_pixels, src_stride,
-                                  frame_desc, palette_cache,
-                                  &clip_block,
-                                  anim->mirror_mode, anim->mirror_offset, dest_x_offset);
-        if (render_result != ESP_OK) {
-            continue;
-        }
+    if (!gfx_anim_has_source(anim) || anim->frame.frame_data == NULL || anim->frame.pixel_buffer == NULL) {
+        return false;
     }
 
-    return ESP_OK;
+    /* Palette depths may carry transparent indices; mirroring leaves a gap between the halves */
+    return anim->frame.desc.bit_depth == GFX_ANIM_DEPTH_24BIT && anim->mirror_mode == GFX_MIRROR_DISABLED;
 }
 
 static esp_err_t gfx_anim_delete(gfx_obj_t *obj)
@@ -826,6 +895,11 @@ static esp_err_t gfx_anim_delete(gfx_obj_t *obj)
             anim->event_group = NULL;
         }
 
+        if (anim->decode_lock != NULL) {
+            vSemaphoreDelete(anim->decode_lock);
+            anim->decode_lock = NULL;
+        }
+
         gfx_anim_release_source(anim);
         free(anim);
     }
@@ -903,6 +977,10 @@ static void gfx_anim_timer_callback(void *arg)
         }
     } else {
         uint32_t frame_step = anim->drain_remaining_segments ? GFX_ANIM_DRAIN_FRAME_STEP : 1U;
+        if (anim->frame_skip) {
+            /* Catch up with wall-clock time when rendering held the timer back */
+            frame_step *= gfx_timer_get_elapsed_periods(anim->timer);
+        }
         uint32_t frames_left = anim->end_frame - anim->current_frame;
 
         anim->current_frame += MIN(frame_step, frames_left);
@@ -942,6 +1020,7 @@ gfx_obj_t *gfx_anim_create(gfx_disp_t *disp)
     memset(anim, 0, sizeof(gfx_anim_t));
     anim->fps = 30;
     anim->repeat = true;
+    anim->frame_skip = true;
     anim->frame.last_block = -1;
     anim->event_group = xEventGroupCreate();
     if (anim->event_group == NULL) {
@@ -950,11 +1029,24 @@ gfx_obj_t *gfx_anim_create(gfx_disp_t *disp)
         return NULL;
     }
 
+#if GFX_RENDER_STRIPE_WORKERS > 0
+    anim->decode_lock = xSemaphoreCreateMutex();
+    if (anim->decode_lock == NULL) {
+        GFX_LOGE(TAG, "create animation: failed to create decode lock");
+        vEventGroupDelete(anim->event_group);
+        free(anim);
+        return NULL;
+    }
+#endif
+
     period_ms = 1000 / anim->fps;
     if (gfx_obj_create_class_instance(disp, &s_gfx_anim_widget_class,
                                       anim, 0, 0, "gfx_anim_create", &obj) != ESP_OK) {
         GFX_LOGE(TAG, "create animation: failed to create object");
         vEventGroupDelete(anim->event_group);
+        if (anim->decode_lock != NULL) {
+            vSemaphoreDelete(anim->decode_lock);
+        }
         free(anim);
         return NULL;
     }
@@ -1199,3 +1291,16 @@ esp_err_t gfx_anim_set_auto_mirror(gfx_obj_t *obj, bool enabled)
     GFX_LOGD(TAG, "set auto mirror: %s", enabled ? "enabled" : "disabled");
     return ESP_OK;
 }
+
+esp_err_t gfx_anim_set_frame_skip(gfx_obj_t *obj, bool enabled)
+{
+    CHECK_OBJ_TYPE_ANIMATION(obj);
+
+    gfx_anim_t *anim = (gfx_anim_t *)obj->src;
+    ESP_RETURN_ON_FALSE(anim != NULL, ESP_ERR_INVALID_STATE, TAG, "set frame skip: animation context is NULL");
+
+    anim->frame_skip = enabled;
+
+    GFX_LOGD(TAG, "set frame skip: %s", enabled ? "enabled" : "disabled");
+    return ESP_OK;
+}
@@ -72,6 +72,7 @@ static esp_err_t gfx_button_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx);
 static esp_err_t gfx_button_update(gfx_obj_t *obj);
 static esp_err_t gfx_button_delete_impl(gfx_obj_t *obj);
 static void gfx_button_touch_event(gfx_obj_t *obj, const void *event_data);
+static bool gfx_button_is_opaque(gfx_obj_t *obj);
 static esp_err_t gfx_button_call_label_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx);
 static esp_err_t gfx_button_call_label_update(gfx_obj_t *obj);
 static esp_err_t gfx_button_call_label_delete(gfx_obj_t *obj);
@@ -83,6 +84,7 @@ static const gfx_widget_class_t s_gfx_button_widget_class = {
     .delete = gfx_button_delete_impl,
     .update = gfx_button_update,
     .touch_event = gfx_button_touch_event,
+    .is_opaque = gfx_button_is_opaque,
 };
 
 /**********************
@@ -190,7 +192,7 @@ static esp_err_t gfx_button_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
     gfx_area_t obj_area;
     gfx_area_t clip_area;
     gfx_area_t fill_area;
-    gfx_area_t saved_geometry;
+    gfx_obj_t label_obj;
     gfx_color_t fill_color;
     uint16_t fill_color_raw;
 
@@ -200,8 +202,6 @@ static esp_err_t gfx_button_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
     button = (gfx_button_t *)obj->src;
     GFX_RETURN_IF_NULL(button, ESP_ERR_INVALID_STATE);
 
-    gfx_obj_calc_pos_in_parent(obj);
-
     obj_area.x1 = obj->geometry.x;
     obj_area.y1 = obj->geometry.y;
     obj_area.x2 = obj->geometry.x + obj->geometry.width;
@@ -230,18 +230,10 @@ static esp_err_t gfx_button_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
                             0xFF,
                             ctx->swap);
 
-    saved_geometry = (gfx_area_t) {
-        .x1 = obj->geometry.x,
-        .y1 = obj->geometry.y,
-        .x2 = obj->geometry.width,
-        .y2 = obj->geometry.height,
-    };
-    gfx_button_apply_label_geometry(obj);
-    gfx_button_call_label_draw(obj, ctx);
-    obj->geometry.x = saved_geometry.x1;
-    obj->geometry.y = saved_geometry.y1;
-    obj->geometry.width = (uint16_t)saved_geometry.x2;
-    obj->geometry.height = (uint16_t)saved_geometry.y2;
+    /* Draw the label through a copy so obj stays untouched while stripe workers draw it */
+    label_obj = *obj;
+    gfx_button_apply_label_geometry(&label_obj);
+    gfx_button_call_label_draw(&label_obj, ctx);
 
     return ESP_OK;
 }
@@ -272,6 +264,12 @@ static esp_err_t gfx_button_update(gfx_obj_t *obj)
     return ret;
 }
 
+static bool gfx_button_is_opaque(gfx_obj_t *obj)
+{
+    /* Background is always filled over the full button bounds */
+    return obj->src != NULL;
+}
+
 static esp_err_t gfx_button_delete_impl(gfx_obj_t *obj)
 {
     CHECK_OBJ_TYPE_BUTTON(obj);
@@ -0,0 +1,172 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdlib.h>
+
+#include "esp_check.h"
+#include "esp_log.h"
+#define GFX_LOG_MODULE GFX_LOG_MODULE_CONT
+#include "common/gfx_log_priv.h"
+
+#include "common/gfx_comm.h"
+#include "core/display/gfx_refr_priv.h"
+#include "core/draw/gfx_blend_priv.h"
+#include "core/object/gfx_obj_priv.h"
+#include "widget/gfx_cont.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CHECK_OBJ_TYPE_CONT(obj) CHECK_OBJ_TYPE(obj, GFX_OBJ_TYPE_CONTAINER, TAG)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    struct {
+        gfx_color_t bg_color;
+        bool bg_enable;
+    } style;
+} gfx_cont_t;
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+static const char *TAG = "cont";
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static esp_err_t gfx_cont_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx);
+static esp_err_t gfx_cont_delete_impl(gfx_obj_t *obj);
+static bool gfx_cont_is_opaque(gfx_obj_t *obj);
+
+static const gfx_widget_class_t s_gfx_cont_widget_class = {
+    .type = GFX_OBJ_TYPE_CONTAINER,
+    .name = "container",
+    .draw = gfx_cont_draw,
+    .delete = gfx_cont_delete_impl,
+    .update = NULL,
+    .touch_event = NULL,
+    .is_opaque = gfx_cont_is_opaque,
+};
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/* Children are drawn by the render loop right after the container, clipped to its bounds */
+static esp_err_t gfx_cont_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
+{
+    gfx_cont_t *cont;
+    gfx_area_t obj_area;
+    gfx_area_t clip_area;
+    gfx_area_t fill_area;
+
+    CHECK_OBJ_TYPE_CONT(obj);
+    GFX_RETURN_IF_NULL(ctx, ESP_ERR_INVALID_ARG);
+
+    cont = (gfx_cont_t *)obj->src;
+    GFX_RETURN_IF_NULL(cont, ESP_ERR_INVALID_STATE);
+
+    if (!cont->style.bg_enable) {
+        return ESP_OK;
+    }
+
+    obj_area.x1 = obj->geometry.x;
+    obj_area.y1 = obj->geometry.y;
+    obj_area.x2 = obj->geometry.x + obj->geometry.width;
+    obj_area.y2 = obj->geometry.y + obj->geometry.height;
+
+    if (!gfx_area_intersect_exclusive(&clip_area, &ctx->clip_area, &obj_area)) {
+        return ESP_OK;
+    }
+
+    fill_area.x1 = clip_area.x1 - ctx->buf_area.x1;
+    fill_area.y1 = clip_area.y1 - ctx->buf_area.y1;
+    fill_area.x2 = clip_area.x2 - ctx->buf_area.x1;
+    fill_area.y2 = clip_area.y2 - ctx->buf_area.y1;
+    gfx_sw_blend_fill_area((uint16_t *)ctx->buf, ctx->stride, &fill_area,
+                           gfx_color_to_native_u16(cont->style.bg_color, ctx->swap));
+
+    return ESP_OK;
+}
+
+static bool gfx_cont_is_opaque(gfx_obj_t *obj)
+{
+    gfx_cont_t *cont = (gfx_cont_t *)obj->src;
+
+    return cont != NULL && cont->style.bg_enable;
+}
+
+static esp_err_t gfx_cont_delete_impl(gfx_obj_t *obj)
+{
+    CHECK_OBJ_TYPE_CONT(obj);
+
+    free(obj->src);
+    obj->src = NULL;
+    return ESP_OK;
+}
+
+/**********************
+ *   PUBLIC FUNCTIONS
+ **********************/
+
+gfx_obj_t *gfx_cont_create(gfx_disp_t *disp)
+{
+    gfx_obj_t *obj;
+    gfx_cont_t *cont;
+
+    if (disp == NULL) {
+        GFX_LOGE(TAG, "create container: display is NULL");
+        return NULL;
+    }
+
+    cont = calloc(1, sizeof(gfx_cont_t));
+    if (cont == NULL) {
+        GFX_LOGE(TAG, "create container: no mem for state");
+        return NULL;
+    }
+    cont->style.bg_color = GFX_COLOR_HEX(0x000000);
+
+    if (gfx_obj_create_class_instance(disp, &s_gfx_cont_widget_class, cont,
+                                      gfx_disp_get_hor_res(disp), gfx_disp_get_ver_res(disp),
+                                      "gfx_cont_create", &obj) != ESP_OK) {
+        free(cont);
+        GFX_LOGE(TAG, "create container: no mem for object");
+        return NULL;
+    }
+
+    GFX_LOGD(TAG, "create container: object created");
+    return obj;
+}
+
+esp_err_t gfx_cont_set_bg_color(gfx_obj_t *obj, gfx_color_t color)
+{
+    CHECK_OBJ_TYPE_CONT(obj);
+    GFX_RETURN_IF_NULL(obj->src, ESP_ERR_INVALID_STATE);
+
+    ((gfx_cont_t *)obj->src)->style.bg_color = color;
+    gfx_obj_invalidate(obj);
+    return ESP_OK;
+}
+
+esp_err_t gfx_cont_set_bg_enable(gfx_obj_t *obj, bool enable)
+{
+    CHECK_OBJ_TYPE_CONT(obj);
+    GFX_RETURN_IF_NULL(obj->src, ESP_ERR_INVALID_STATE);
+
+    ((gfx_cont_t *)obj->src)->style.bg_enable = enable;
+    gfx_obj_invalidate(obj);
+    return ESP_OK;
+}
@@ -58,7 +58,9 @@ static const char *TAG = "qrcode";
  **********************/
 
 static esp_err_t gfx_qrcode_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx);
+static esp_err_t gfx_qrcode_update(gfx_obj_t *obj);
 static esp_err_t gfx_qrcode_delete_impl(gfx_obj_t *obj);
+static bool gfx_qrcode_is_opaque(gfx_obj_t *obj);
 static void gfx_qrcode_generate_callback(qrcode_wrapper_handle_t qrcode, void *user_data);
 static esp_err_t gfx_qrcode_generate(gfx_obj_t *obj, bool swap);
 static void gfx_qrcode_blend(gfx_obj_t *obj, gfx_qrcode_t *qrcode, const gfx_draw_ctx_t *ctx);
@@ -69,8 +71,9 @@ static const gfx_widget_class_t s_gfx_qrcode_widget_class = {
     .name = "qrcode",
     .draw = gfx_qrcode_draw,
     .delete = gfx_qrcode_delete_impl,
-    .update = NULL,
+    .update = gfx_qrcode_update,
     .touch_event = NULL,
+    .is_opaque = gfx_qrcode_is_opaque,
 };
 
 /**********************
@@ -211,8 +214,6 @@ static esp_err_t gfx_qrcode_generate(gfx_obj_t *obj, bool swap)
 
 static void gfx_qrcode_blend(gfx_obj_t *obj, gfx_qrcode_t *qrcode, const gfx_draw_ctx_t *ctx)
 {
-    gfx_obj_calc_pos_in_parent(obj);
-
     gfx_area_t render_area = ctx->clip_area;
     gfx_area_t obj_area = {obj->geometry.x, obj->geometry.y,
                            obj->geometry.x + qrcode->scaled_size,
@@ -274,6 +275,33 @@ static esp_err_t gfx_qrcode_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
     return ESP_OK;
 }
 
+/* Regenerate before drawing starts so chunk/stripe draws only read qr_modules */
+static esp_err_t gfx_qrcode_update(gfx_obj_t *obj)
+{
+    CHECK_OBJ_TYPE_QRCODE(obj);
+
+    gfx_qrcode_t *qrcode = (gfx_qrcode_t *)obj->src;
+    if (qrcode == NULL || !qrcode->needs_update || obj->disp == NULL) {
+        return ESP_OK;
+    }
+
+    esp_err_t ret = gfx_qrcode_generate(obj, obj->disp->flags.swap);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    qrcode->needs_update = false;
+    return ESP_OK;
+}
+
+static bool gfx_qrcode_is_opaque(gfx_obj_t *obj)
+{
+    gfx_qrcode_t *qrcode = (gfx_qrcode_t *)obj->src;
+
+    /* Modules are copied without alpha; only trust an already generated buffer */
+    return qrcode != NULL && qrcode->qr_modules != NULL && !qrcode->needs_update &&
+           qrcode->scaled_size >= obj->geometry.width && qrcode->scaled_size >= obj->geometry.height;
+}
+
 static esp_err_t gfx_qrcode_delete_impl(gfx_obj_t *obj)
 {
     CHECK_OBJ_TYPE_QRCODE(obj);
@@ -44,6 +44,7 @@ static const char *TAG = "img";
  **********************/
 static esp_err_t gfx_img_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx);
 static esp_err_t gfx_img_delete_impl(gfx_obj_t *obj);
+static bool gfx_img_is_opaque(gfx_obj_t *obj);
 static esp_err_t gfx_img_resolve_src_payload(const gfx_img_src_t *src, const void **out_payload);
 
 static const gfx_widget_class_t s_gfx_img_widget_class = {
@@ -53,6 +54,7 @@ static const gfx_widget_class_t s_gfx_img_widget_class = {
     .delete = gfx_img_delete_impl,
     .update = NULL,
     .touch_event = NULL,
+    .is_opaque = gfx_img_is_opaque,
 };
 
 /**********************
@@ -122,8 +124,6 @@ static esp_err_t gfx_img_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
         return ESP_ERR_INVALID_STATE;
     }
 
-    gfx_obj_calc_pos_in_parent(obj);
-
     gfx_area_t render_area = ctx->clip_area;
     gfx_area_t obj_area = {obj->geometry.x, obj->geometry.y, obj->geometry.x + image_width, obj->geometry.y + image_height};
     gfx_area_t clip_area;
@@ -150,6 +150,13 @@ static esp_err_t gfx_img_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
                      clip_area.x1 - obj->geometry.x);
     }
 
+    if (alpha_mask != NULL && (header.flags & GFX_IMAGE_FLAGS_PREMULTIPLIED)) {
+        gfx_sw_blend_img_premul_draw(dest_pixels, ctx->stride, src_pixels, src_stride,
+                                     alpha_mask, src_stride, &clip_area, ctx->swap);
+        gfx_image_decoder_close(&decoder_dsc);
+        return ESP_OK;
+    }
+
     gfx_sw_blend_img_draw(
         dest_pixels,
         ctx->stride,
@@ -165,6 +172,27 @@ static esp_err_t gfx_img_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
     return ESP_OK;
 }
 
+static bool gfx_img_is_opaque(gfx_obj_t *obj)
+{
+    gfx_img_t *image = (gfx_img_t *)obj->src;
+    gfx_image_header_t header;
+
+    if (image == NULL || image->src.data == NULL) {
+        return false;
+    }
+
+    gfx_image_decoder_dsc_t dsc = {
+        .src = image->src,
+    };
+    if (gfx_image_decoder_info(&dsc, &header) != ESP_OK) {
+        return false;
+    }
+
+    /* Plain RGB565 is copied as-is; the image must span the whole object */
+    return header.cf == GFX_COLOR_FORMAT_RGB565 &&
+           header.w >= obj->geometry.width && header.h >= obj->geometry.height;
+}
+
 static esp_err_t gfx_img_resolve_src_payload(const gfx_img_src_t *src, const void **out_payload)
 {
     ESP_RETURN_ON_FALSE(src != NULL, ESP_ERR_INVALID_ARG, TAG, "resolve image src: descriptor is NULL");
@@ -66,6 +66,7 @@ typedef struct {
     int32_t *scanline_vx;
     int32_t *scanline_vy;
     size_t scanline_capacity;
+    int scanline_count;             /**< Vertices resolved into scanline_vx/vy this frame (0 = none) */
 } gfx_mesh_img_t;
 
 /**********************
@@ -79,6 +80,7 @@ static const char *TAG = "mesh_img";
  **********************/
 
 static esp_err_t gfx_mesh_img_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx);
+static esp_err_t gfx_mesh_img_update(gfx_obj_t *obj);
 static esp_err_t gfx_mesh_img_delete_impl(gfx_obj_t *obj);
 static void gfx_mesh_img_free_points(gfx_mesh_img_t *mesh);
 static void gfx_mesh_img_free_scratch(gfx_mesh_img_t *mesh);
@@ -97,8 +99,9 @@ static const gfx_widget_class_t s_gfx_mesh_img_widget_class = {
     .name = "mesh_img",
     .draw = gfx_mesh_img_draw,
     .delete = gfx_mesh_img_delete_impl,
-    .update = NULL,
+    .update = gfx_mesh_img_update,
     .touch_event = NULL,
+    .is_opaque = NULL,
 };
 
 /**********************
@@ -343,7 +346,6 @@ static void gfx_mesh_img_get_draw_origin_q8(gfx_obj_t *obj, const gfx_mesh_img_t
         return;
     }
 
-    gfx_obj_calc_pos_in_parent(obj);
     *x_q8 = ((int32_t)obj->geometry.x << GFX_MESH_IMG_Q8_SHIFT) - mesh->bounds_min_x_q8;
     *y_q8 = ((int32_t)obj->geometry.y << GFX_MESH_IMG_Q8_SHIFT) - mesh->bounds_min_y_q8;
 }
@@ -488,33 +490,16 @@ static esp_err_t gfx_mesh_img_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
     if (mesh->scanline_fill && mesh->grid_rows == 1U && mesh->points != NULL) {
         int cols = mesh->grid_cols;
         int poly_n = mesh->wrap_cols ? (cols + 1) : ((cols + 1) * 2);
-        int32_t *pvx = mesh->scanline_vx;
-        int32_t *pvy = mesh->scanline_vy;
         bool scanline_drawn = false;
 
-        if (pvx != NULL && pvy != NULL && poly_n <= (int)mesh->scanline_capacity) {
-            if (mesh->wrap_cols) {
-                int row1 = cols + 1;
-                for (int c = 0; c <= cols; c++) {
-                    pvx[c] = origin_x_q8 + mesh->points[row1 + c].x_q8;
-                    pvy[c] = origin_y_q8 + mesh->points[row1 + c].y_q8;
-                }
-            } else {
-                for (int c = 0; c <= cols; c++) {
-                    pvx[c] = origin_x_q8 + mesh->points[c].x_q8;
-                    pvy[c] = origin_y_q8 + mesh->points[c].y_q8;
-                }
-                for (int c = 0; c <= cols; c++) {
-                    int src_idx = 2 * cols + 1 - c;
-                    pvx[cols + 1 + c] = origin_x_q8 + mesh->points[src_idx].x_q8;
-                    pvy[cols + 1 + c] = origin_y_q8 + mesh->points[src_idx].y_q8;
-                }
-            }
+        /* Polygon was resolved by gfx_mesh_img_update(); draw only reads it */
+        if (mesh->scanline_count == poly_n) {
             gfx_sw_blend_polygon_fill((gfx_color_t *)ctx->buf, ctx->stride,
                                       &ctx->buf_area, &clip_area,
                                       mesh->scanline_color,
                                       mesh->opacity,
-                                      pvx, pvy, poly_n, ctx->swap);
+                                      mesh->scanline_vx, mesh->scanline_vy, poly_n,
+                                      GFX_SW_BLEND_FILL_EVEN_ODD, ctx->swap);
             scanline_drawn = true;
         } else {
             GFX_LOGW(TAG, "draw mesh image: scanline fill capacity too small (%d > %u)",
@@ -789,6 +774,56 @@ static esp_err_t gfx_mesh_img_draw(gfx_obj_t *obj, const gfx_draw_ctx_t *ctx)
     return ESP_OK;
 }
 
+static esp_err_t gfx_mesh_img_update(gfx_obj_t *obj)
+{
+    gfx_mesh_img_t *mesh;
+    int32_t origin_x_q8;
+    int32_t origin_y_q8;
+
+    CHECK_OBJ_TYPE_MESH_IMAGE(obj);
+    mesh = (gfx_mesh_img_t *)obj->src;
+    GFX_RETURN_IF_NULL(mesh, ESP_ERR_INVALID_STATE);
+
+    mesh->scanline_count = 0;
+    if (!mesh->scanline_fill || mesh->grid_rows != 1U || mesh->points == NULL ||
+            mesh->scanline_vx == NULL || mesh->scanline_vy == NULL) {
+        return ESP_OK;
+    }
+
+    int cols = mesh->grid_cols;
+    int poly_n = mesh->wrap_cols ? (cols + 1) : ((cols + 1) * 2);
+    int32_t *pvx = mesh->scanline_vx;
+    int32_t *pvy = mesh->scanline_vy;
+
+    if (poly_n > (int)mesh->scanline_capacity) {
+        return ESP_OK;
+    }
+
+    /* Resolve the outline once per frame so concurrent stripe draws share it read-only */
+    gfx_obj_calc_pos_in_parent(obj);
+    gfx_mesh_img_get_draw_origin_q8(obj, mesh, &origin_x_q8, &origin_y_q8);
+    if (mesh->wrap_cols) {
+        int row1 = cols + 1;
+        for (int c = 0; c <= cols; c++) {
+            pvx[c] = origin_x_q8 + mesh->points[row1 + c].x_q8;
+            pvy[c] = origin_y_q8 + mesh->points[row1 + c].y_q8;
+        }
+    } else {
+        for (int c = 0; c <= cols; c++) {
+            pvx[c] = origin_x_q8 + mesh->points[c].x_q8;
+            pvy[c] = origin_y_q8 + mesh->points[c].y_q8;
+        }
+        for (int c = 0; c <= cols; c++) {
+            int src_idx = 2 * cols + 1 - c;
+            pvx[cols + 1 + c] = origin_x_q8 + mesh->points[src_idx].x_q8;
+            pvy[cols + 1 + c] = origin_y_q8 + mesh->points[src_idx].y_q8;
+        }
+    }
+    mesh->scanline_count = poly_n;
+
+    return ESP_OK;
+}
+
 static esp_err_t gfx_mesh_img_delete_impl(gfx_obj_t *obj)
 {
     gfx_mesh_img_t *mesh;
@@ -858,6 +893,9 @@ esp_err_t gfx_mesh_img_set_src_desc(gfx_obj_t *obj, const gfx_img_src_t *src)
     ESP_RETURN_ON_ERROR(gfx_mesh_img_load_header(src, &header), TAG, "set mesh image src: query header failed");
     ESP_RETURN_ON_FALSE(header.cf == GFX_COLOR_FORMAT_RGB565 || header.cf == GFX_COLOR_FORMAT_RGB565A8,
                         ESP_ERR_NOT_SUPPORTED, TAG, "set mesh image src: unsupported color format");
+    /* Triangle spans mix straight alpha; premultiplied texels would come out dark */
+    ESP_RETURN_ON_FALSE(!(header.flags & GFX_IMAGE_FLAGS_PREMULTIPLIED), ESP_ERR_NOT_SUPPORTED, TAG,
+                        "set mesh image src: premultiplied alpha is not supported");
 
     gfx_obj_invalidate(obj);
 
@@ -943,6 +981,7 @@ esp_err_t gfx_mesh_img_get_point_screen(gfx_obj_t *obj, size_t point_idx, gfx_co
     ESP_RETURN_ON_FALSE(mesh != NULL, ESP_ERR_INVALID_STATE, TAG, "get mesh point screen: state is NULL");
     ESP_RETURN_ON_FALSE(point_idx < mesh->point_count, ESP_ERR_INVALID_ARG, TAG, "get mesh point screen: index out of range");
 
+    gfx_obj_calc_pos_in_parent(obj);
     gfx_mesh_img_get_draw_origin_q8(obj, mesh, &origin_x_q8, &origin_y_q8);
     *x = gfx_mesh_img_round_q8_to_coord(origin_x_q8 + mesh->points[point_idx].x_q8);
     *y = gfx_mesh_img_round_q8_to_coord(origin_y_q8 + mesh->points[point_idx].y_q8);
@@ -977,6 +1016,7 @@ esp_err_t gfx_mesh_img_get_point_screen_q8(gfx_obj_t *obj, size_t point_idx, int
     ESP_RETURN_ON_FALSE(mesh != NULL, ESP_ERR_INVALID_STATE, TAG, "get mesh point screen q8: state is NULL");
     ESP_RETURN_ON_FALSE(point_idx < mesh->point_count, ESP_ERR_INVALID_ARG, TAG, "get mesh point screen q8: index out of range");
 
+    gfx_obj_calc_pos_in_parent(obj);
     gfx_mesh_img_get_draw_origin_q8(obj, mesh, &origin_x_q8, &origin_y_q8);
     *x_q8 = origin_x_q8 + mesh->points[point_idx].x_q8;
     *y_q8 = origin_y_q8 + mesh->points[point_idx].y_q8;
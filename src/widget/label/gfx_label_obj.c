@@ -35,6 +35,7 @@ static const char *TAG = "label_obj";
  **********************/
 
 static void gfx_label_init_default_state(gfx_label_t *label);
+static bool gfx_label_is_opaque(gfx_obj_t *obj);
 
 static const gfx_widget_class_t s_gfx_label_widget_class = {
     .type = GFX_OBJ_TYPE_LABEL,
@@ -43,12 +44,21 @@ static const gfx_widget_class_t s_gfx_label_widget_class = {
     .delete = gfx_label_delete_impl,
     .update = gfx_label_update_impl,
     .touch_event = NULL,
+    .is_opaque = gfx_label_is_opaque,
 };
 
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static bool gfx_label_is_opaque(gfx_obj_t *obj)
+{
+    gfx_label_t *label = (gfx_label_t *)obj->src;
+
+    /* gfx_draw_label() only paints the background when there is text */
+    return label != NULL && label->style.bg_enable && label->text.text != NULL;
+}
+
 static void gfx_label_init_default_state(gfx_label_t *label)
 {
     label->style.opa = 0xFF;
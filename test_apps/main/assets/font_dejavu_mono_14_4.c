@@ -0,0 +1,707 @@
+/*
+ * SPDX-FileCopyrightText: 2003 Bitstream, Inc.
+ * SPDX-FileContributor: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Bitstream-Vera
+ */
+
+/*
+ * DejaVu Sans Mono, 14 px, 4 bpp, printable ASCII (0x20-0x7E), in the
+ * lv_font_conv C layout. A C array so the label bench scene runs on the
+ * host too, where no font partition is mounted. The glyph bitmaps are
+ * rasterized from DejaVuSansMono.ttf (https://dejavu-fonts.github.io/)
+ * and are distributed under its license, reproduced below.
+ *
+ * Copyright (c) 2003 by Bitstream, Inc. All Rights Reserved. Bitstream Vera
+ * is a trademark of Bitstream, Inc. DejaVu changes are in public domain.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of the fonts accompanying this license ("Fonts") and associated
+ * documentation files (the "Font Software"), to reproduce and distribute the
+ * Font Software, including without limitation the rights to use, copy,
+ * merge, publish, distribute, and/or sell copies of the Font Software, and
+ * to permit persons to whom the Font Software is furnished to do so, subject
+ * to the following conditions:
+ *
+ * The above copyright and trademark notices and this permission notice shall
+ * be included in all copies of one or more of the Font Software typefaces.
+ *
+ * The Font Software may be modified, altered, or added to, and in particular
+ * the designs of glyphs or characters in the Fonts may be modified and
+ * additional glyphs or characters may be added to the Fonts, only if the
+ * fonts are renamed to names not containing either the words "Bitstream" or
+ * the word "Vera".
+ *
+ * This License becomes null and void to the extent applicable to Fonts or
+ * Font Software that has been modified and is distributed under the
+ * "Bitstream Vera" names.
+ *
+ * The Font Software may be sold as part of a larger software package but no
+ * copy of one or more of the Font Software typefaces may be sold by itself.
+ *
+ * THE FONT SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO ANY WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT OF
+ * COPYRIGHT, PATENT, TRADEMARK, OR OTHER RIGHT. IN NO EVENT SHALL BITSTREAM
+ * OR THE GNOME FOUNDATION BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, INCLUDING ANY GENERAL, SPECIAL, INDIRECT, INCIDENTAL, OR
+ * CONSEQUENTIAL DAMAGES, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF THE USE OR INABILITY TO USE THE FONT
+ * SOFTWARE OR FROM OTHER DEALINGS IN THE FONT SOFTWARE.
+ *
+ * Except as contained in this notice, the names of Gnome, the Gnome
+ * Foundation, and Bitstream Inc., shall not be used in advertising or
+ * otherwise to promote the sale, use or other dealings in this Font Software
+ * without prior written authorization from the Gnome Foundation or Bitstream
+ * Inc., respectively. For further information, contact: fonts at gnome dot
+ * org.
+ */
+
+#include "lvgl.h"
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x6d, 0x5c, 0x01, 0x5b, 0x7e,
+
+    /* U+0022 """ */
+    0xa8, 0x1f, 0x2a, 0x81, 0xf2, 0xa8, 0x1f, 0x29, 0x61, 0xd2,
+
+    /* U+0023 "#" */
+    0x00, 0x08, 0x80, 0xb5, 0x00, 0x00, 0xc5, 0x0f, 0x10, 0x00, 0x0f, 0x13,
+    0xd0, 0x03, 0xee, 0xfe, 0xef, 0xe6, 0x02, 0x9a, 0x2c, 0x72, 0x10, 0x0c,
+    0x51, 0xe1, 0x00, 0xee, 0xfe, 0xef, 0xe9, 0x02, 0x6c, 0x29, 0x92, 0x10,
+    0x09, 0x80, 0xc4, 0x00, 0x00, 0xc4, 0x1f, 0x10, 0x00,
+
+    /* U+0024 "$" */
+    0x00, 0x0a, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x08, 0xdf, 0xda, 0x07, 0xc1,
+    0xa1, 0x60, 0xa9, 0x0a, 0x00, 0x06, 0xe6, 0xb0, 0x00, 0x06, 0xbf, 0xe7,
+    0x00, 0x00, 0xb5, 0xe5, 0x00, 0x0a, 0x0b, 0x87, 0x51, 0xa3, 0xe5, 0x5b,
+    0xef, 0xd7, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x0a, 0x00, 0x00,
+
+    /* U+0025 "%" */
+    0x2b, 0xea, 0x10, 0x00, 0x0a, 0x60, 0x97, 0x00, 0x00, 0xa6, 0x09, 0x70,
+    0x01, 0x02, 0xbe, 0xa1, 0x19, 0x80, 0x00, 0x01, 0x8a, 0x20, 0x00, 0x07,
+    0xb4, 0x00, 0x00, 0x3b, 0x50, 0x5d, 0xd5, 0x01, 0x00, 0x1d, 0x22, 0xd1,
+    0x00, 0x01, 0xd1, 0x1d, 0x10, 0x00, 0x06, 0xee, 0x60,
+
+    /* U+0026 "&" */
+    0x00, 0x8e, 0xfc, 0x00, 0x00, 0x4e, 0x42, 0x50, 0x00, 0x05, 0xe0, 0x00,
+    0x00, 0x00, 0x0e, 0x60, 0x00, 0x00, 0x08, 0xbe, 0x30, 0x04, 0x14, 0xd1,
+    0x5d, 0x10, 0xe3, 0x89, 0x00, 0xab, 0x1f, 0x17, 0xb0, 0x01, 0xdc, 0xb0,
+    0x2e, 0x70, 0x08, 0xf6, 0x00, 0x3b, 0xed, 0xa8, 0xe1,
+
+    /* U+0027 "'" */
+    0x6c, 0x6c, 0x6c, 0x5a,
+
+    /* U+0028 "(" */
+    0x00, 0x5c, 0x00, 0x0d, 0x40, 0x05, 0xd0, 0x00, 0xa9, 0x00, 0x0e, 0x60,
+    0x00, 0xf5, 0x00, 0x1f, 0x40, 0x00, 0xf5, 0x00, 0x0c, 0x80, 0x00, 0x8b,
+    0x00, 0x02, 0xf2, 0x00, 0x09, 0x80, 0x00, 0x17, 0x00,
+
+    /* U+0029 ")" */
+    0x6b, 0x00, 0x0d, 0x40, 0x07, 0xb0, 0x03, 0xf1, 0x00, 0xe5, 0x00, 0xd7,
+    0x00, 0xd7, 0x00, 0xe6, 0x01, 0xf3, 0x05, 0xe0, 0x0a, 0x80, 0x2e, 0x10,
+    0x45, 0x00,
+
+    /* U+002A "*" */
+    0x00, 0x39, 0x00, 0x07, 0x33, 0x91, 0x81, 0x2a, 0xac, 0xb5, 0x00, 0x2c,
+    0xf6, 0x00, 0x7a, 0x59, 0x7b, 0x11, 0x03, 0x90, 0x10, 0x00, 0x15, 0x00,
+    0x00,
+
+    /* U+002B "+" */
+    0x00, 0x02, 0x50, 0x00, 0x00, 0x05, 0xc0, 0x00, 0x00, 0x05, 0xc0, 0x00,
+    0x00, 0x05, 0xc0, 0x00, 0x6f, 0xff, 0xff, 0xfc, 0x13, 0x37, 0xc3, 0x32,
+    0x00, 0x05, 0xc0, 0x00, 0x00, 0x05, 0xc0, 0x00,
+
+    /* U+002C "," */
+    0x01, 0x20, 0x08, 0xf2, 0x09, 0xf1, 0x0d, 0x80, 0x2f, 0x10,
+
+    /* U+002D "-" */
+    0x8f, 0xff, 0x12, 0x22,
+
+    /* U+002E "." */
+    0x12, 0x0a, 0xf1, 0xaf, 0x10,
+
+    /* U+002F "/" */
+    0x00, 0x00, 0x02, 0xf2, 0x00, 0x00, 0x09, 0xa0, 0x00, 0x00, 0x2f, 0x30,
+    0x00, 0x00, 0x8b, 0x00, 0x00, 0x01, 0xe4, 0x00, 0x00, 0x07, 0xc0, 0x00,
+    0x00, 0x1e, 0x50, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0xd6, 0x00, 0x00,
+    0x05, 0xe0, 0x00, 0x00, 0x0c, 0x70, 0x00, 0x00, 0x18, 0x10, 0x00, 0x00,
+
+    /* U+0030 "0" */
+    0x00, 0x7e, 0xeb, 0x20, 0x06, 0xf6, 0x3c, 0xc0, 0x0c, 0x90, 0x03, 0xf3,
+    0x0f, 0x60, 0x00, 0xf6, 0x1f, 0x58, 0xd1, 0xd7, 0x1f, 0x56, 0xb0, 0xe7,
+    0x0f, 0x60, 0x00, 0xf6, 0x0c, 0xa0, 0x03, 0xf3, 0x06, 0xf6, 0x3c, 0xc0,
+    0x00, 0x7e, 0xfb, 0x20,
+
+    /* U+0031 "1" */
+    0x2a, 0xdf, 0x50, 0x03, 0x85, 0xf5, 0x00, 0x00, 0x0f, 0x50, 0x00, 0x00,
+    0xf5, 0x00, 0x00, 0x0f, 0x50, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x0f, 0x50,
+    0x00, 0x00, 0xf5, 0x00, 0x03, 0x3f, 0x73, 0x12, 0xff, 0xff, 0xf7,
+
+    /* U+0032 "2" */
+    0x6c, 0xee, 0xa1, 0x0b, 0x74, 0x5d, 0xc0, 0x00, 0x00, 0x5f, 0x20, 0x00,
+    0x06, 0xf1, 0x00, 0x01, 0xd8, 0x00, 0x00, 0xab, 0x00, 0x00, 0xac, 0x10,
+    0x00, 0xac, 0x10, 0x00, 0x9d, 0x43, 0x33, 0x1e, 0xff, 0xff, 0xf4,
+
+    /* U+0033 "3" */
+    0x07, 0xde, 0xea, 0x20, 0x06, 0x53, 0x4c, 0xc0, 0x00, 0x00, 0x04, 0xf1,
+    0x00, 0x00, 0x1a, 0xd0, 0x00, 0x4f, 0xfc, 0x20, 0x00, 0x13, 0x4c, 0xb0,
+    0x00, 0x00, 0x01, 0xf4, 0x00, 0x00, 0x02, 0xf4, 0x1a, 0x53, 0x5c, 0xe1,
+    0x0a, 0xdf, 0xea, 0x30,
+
+    /* U+0034 "4" */
+    0x00, 0x00, 0x8f, 0x60, 0x00, 0x04, 0xcf, 0x60, 0x00, 0x1d, 0x2f, 0x60,
+    0x00, 0xa7, 0x0f, 0x60, 0x05, 0xc0, 0x0f, 0x60, 0x2e, 0x30, 0x0f, 0x60,
+    0x4f, 0xff, 0xff, 0xfb, 0x12, 0x22, 0x2f, 0x72, 0x00, 0x00, 0x0f, 0x60,
+    0x00, 0x00, 0x0f, 0x60,
+
+    /* U+0035 "5" */
+    0x09, 0xff, 0xff, 0x90, 0x09, 0xb3, 0x33, 0x20, 0x09, 0xa0, 0x00, 0x00,
+    0x09, 0xee, 0xd9, 0x10, 0x05, 0x53, 0x6e, 0xb0, 0x00, 0x00, 0x05, 0xf2,
+    0x00, 0x00, 0x02, 0xf4, 0x00, 0x00, 0x05, 0xf2, 0x0a, 0x53, 0x6d, 0xb0,
+    0x0a, 0xef, 0xd9, 0x10,
+
+    /* U+0036 "6" */
+    0x00, 0x4c, 0xfe, 0x80, 0x03, 0xf9, 0x44, 0x50, 0x0b, 0x90, 0x00, 0x00,
+    0x0e, 0x7b, 0xeb, 0x30, 0x1f, 0xe6, 0x39, 0xe1, 0x1f, 0x90, 0x01, 0xe6,
+    0x0f, 0x70, 0x00, 0xd7, 0x0c, 0x90, 0x00, 0xe6, 0x06, 0xe5, 0x29, 0xe1,
+    0x00, 0x7d, 0xec, 0x30,
+
+    /* U+0037 "7" */
+    0x1f, 0xff, 0xff, 0xf5, 0x03, 0x33, 0x37, 0xe1, 0x00, 0x00, 0x0a, 0xa0,
+    0x00, 0x00, 0x2f, 0x40, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xd7, 0x00,
+    0x00, 0x05, 0xf1, 0x00, 0x00, 0x0b, 0xa0, 0x00, 0x00, 0x2f, 0x50, 0x00,
+    0x00, 0x8d, 0x00, 0x00,
+
+    /* U+0038 "8" */
+    0x01, 0x9e, 0xec, 0x40, 0x09, 0xd3, 0x29, 0xe1, 0x0c, 0x80, 0x02, 0xf4,
+    0x09, 0xc1, 0x07, 0xd1, 0x00, 0x9f, 0xfd, 0x20, 0x06, 0xd4, 0x39, 0xd1,
+    0x0e, 0x60, 0x00, 0xe6, 0x1f, 0x50, 0x00, 0xe7, 0x0c, 0xd4, 0x28, 0xf3,
+    0x02, 0xae, 0xec, 0x40,
+
+    /* U+0039 "9" */
+    0x01, 0xae, 0xea, 0x20, 0x0b, 0xc3, 0x3b, 0xc0, 0x1f, 0x50, 0x02, 0xf3,
+    0x1f, 0x40, 0x02, 0xf6, 0x0c, 0xb1, 0x19, 0xf7, 0x03, 0xcf, 0xf9, 0xd7,
+    0x00, 0x01, 0x10, 0xf5, 0x00, 0x00, 0x06, 0xf2, 0x04, 0x63, 0x6e, 0x90,
+    0x04, 0xdf, 0xd8, 0x00,
+
+    /* U+003A ":" */
+    0x12, 0x0a, 0xf1, 0xaf, 0x10, 0x00, 0x00, 0x01, 0x20, 0xaf, 0x1a, 0xf1,
+
+    /* U+003B ";" */
+    0x01, 0x20, 0x0a, 0xf1, 0x0a, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20,
+    0x08, 0xf2, 0x09, 0xf1, 0x0d, 0x80, 0x2f, 0x10,
+
+    /* U+003C "<" */
+    0x00, 0x00, 0x01, 0x6a, 0x00, 0x03, 0x9e, 0xc6, 0x16, 0xce, 0x93, 0x00,
+    0x6f, 0x91, 0x00, 0x00, 0x17, 0xdd, 0x82, 0x00, 0x00, 0x04, 0xaf, 0xc5,
+    0x00, 0x00, 0x01, 0x7b, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+003D "=" */
+    0x6f, 0xff, 0xff, 0xfc, 0x13, 0x33, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00,
+    0x6f, 0xff, 0xff, 0xfc, 0x13, 0x33, 0x33, 0x32,
+
+    /* U+003E ">" */
+    0x59, 0x30, 0x00, 0x00, 0x2a, 0xec, 0x61, 0x00, 0x00, 0x16, 0xce, 0x93,
+    0x00, 0x00, 0x05, 0xec, 0x00, 0x15, 0xbe, 0xa3, 0x29, 0xed, 0x71, 0x00,
+    0x5a, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    /* U+003F "?" */
+    0x19, 0xde, 0xc3, 0x05, 0x94, 0x3b, 0xe0, 0x00, 0x00, 0x5f, 0x10, 0x00,
+    0x1c, 0xa0, 0x00, 0x1c, 0xb0, 0x00, 0x07, 0xd0, 0x00, 0x00, 0x9a, 0x00,
+    0x00, 0x03, 0x30, 0x00, 0x00, 0x88, 0x00, 0x00, 0x0a, 0xb0, 0x00,
+
+    /* U+0040 "@" */
+    0x00, 0x4b, 0xed, 0x80, 0x00, 0x6d, 0x40, 0x2b, 0x80, 0x1e, 0x20, 0x00,
+    0x2d, 0x07, 0xa0, 0x2a, 0xd7, 0xe0, 0xa6, 0x0c, 0x82, 0x8f, 0x1c, 0x42,
+    0xe0, 0x00, 0xf1, 0xc4, 0x2e, 0x00, 0x0e, 0x1a, 0x60, 0xc6, 0x06, 0xf1,
+    0x6a, 0x02, 0xbd, 0x9d, 0x11, 0xe4, 0x00, 0x00, 0x00, 0x04, 0xe7, 0x10,
+    0x20, 0x00, 0x02, 0x9d, 0xec, 0x10,
+
+    /* U+0041 "A" */
+    0x00, 0x0c, 0xf3, 0x00, 0x00, 0x01, 0xe9, 0x80, 0x00, 0x00, 0x6b, 0x4c,
+    0x00, 0x00, 0x0b, 0x71, 0xf2, 0x00, 0x01, 0xf3, 0x0b, 0x70, 0x00, 0x5d,
+    0x00, 0x7b, 0x00, 0x0a, 0xff, 0xff, 0xf1, 0x00, 0xe6, 0x22, 0x2e, 0x60,
+    0x4f, 0x10, 0x00, 0xab, 0x09, 0xc0, 0x00, 0x06, 0xf1,
+
+    /* U+0042 "B" */
+    0xdf, 0xfe, 0xc5, 0x0d, 0x92, 0x38, 0xf3, 0xd8, 0x00, 0x0f, 0x6d, 0x80,
+    0x06, 0xf3, 0xdf, 0xff, 0xe6, 0x0d, 0x92, 0x37, 0xe3, 0xd8, 0x00, 0x0b,
+    0xad, 0x80, 0x00, 0xab, 0xd9, 0x23, 0x6f, 0x6d, 0xff, 0xed, 0x70,
+
+    /* U+0043 "C" */
+    0x00, 0x2a, 0xee, 0xb2, 0x02, 0xeb, 0x43, 0x74, 0x09, 0xd0, 0x00, 0x00,
+    0x0e, 0x80, 0x00, 0x00, 0x0f, 0x70, 0x00, 0x00, 0x0f, 0x70, 0x00, 0x00,
+    0x0e, 0x80, 0x00, 0x00, 0x09, 0xd0, 0x00, 0x00, 0x02, 0xeb, 0x43, 0x74,
+    0x00, 0x3b, 0xee, 0xb2,
+
+    /* U+0044 "D" */
+    0x1f, 0xfe, 0xc7, 0x00, 0x1f, 0x63, 0x6e, 0xa0, 0x1f, 0x50, 0x05, 0xf3,
+    0x1f, 0x50, 0x00, 0xf6, 0x1f, 0x50, 0x00, 0xe8, 0x1f, 0x50, 0x00, 0xe8,
+    0x1f, 0x50, 0x00, 0xf6, 0x1f, 0x50, 0x05, 0xf3, 0x1f, 0x63, 0x6e, 0xa0,
+    0x1f, 0xff, 0xc7, 0x00,
+
+    /* U+0045 "E" */
+    0xaf, 0xff, 0xff, 0x6a, 0xc3, 0x33, 0x31, 0xab, 0x00, 0x00, 0x0a, 0xb0,
+    0x00, 0x00, 0xaf, 0xff, 0xff, 0x3a, 0xc3, 0x33, 0x31, 0xab, 0x00, 0x00,
+    0x0a, 0xb0, 0x00, 0x00, 0xac, 0x33, 0x33, 0x1a, 0xff, 0xff, 0xf8,
+
+    /* U+0046 "F" */
+    0x6f, 0xff, 0xff, 0x96, 0xf3, 0x33, 0x32, 0x6f, 0x00, 0x00, 0x06, 0xf0,
+    0x00, 0x00, 0x6f, 0xff, 0xff, 0x36, 0xf3, 0x33, 0x30, 0x6f, 0x00, 0x00,
+    0x06, 0xf0, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x06, 0xf0, 0x00, 0x00,
+
+    /* U+0047 "G" */
+    0x00, 0x4c, 0xfd, 0x91, 0x05, 0xf8, 0x34, 0x83, 0x0d, 0xa0, 0x00, 0x00,
+    0x2f, 0x50, 0x00, 0x00, 0x4f, 0x30, 0x4f, 0xf8, 0x4f, 0x20, 0x13, 0xc8,
+    0x2f, 0x40, 0x00, 0xc8, 0x0d, 0x90, 0x00, 0xc8, 0x05, 0xf8, 0x34, 0xe8,
+    0x00, 0x5c, 0xfe, 0x91,
+
+    /* U+0048 "H" */
+    0x1f, 0x50, 0x00, 0xd8, 0x1f, 0x50, 0x00, 0xd8, 0x1f, 0x50, 0x00, 0xd8,
+    0x1f, 0x50, 0x00, 0xd8, 0x1f, 0xff, 0xff, 0xf8, 0x1f, 0x73, 0x33, 0xe8,
+    0x1f, 0x50, 0x00, 0xd8, 0x1f, 0x50, 0x00, 0xd8, 0x1f, 0x50, 0x00, 0xd8,
+    0x1f, 0x50, 0x00, 0xd8,
+
+    /* U+0049 "I" */
+    0x9f, 0xff, 0xff, 0x12, 0x39, 0xe3, 0x30, 0x00, 0x7e, 0x00, 0x00, 0x07,
+    0xe0, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x7e, 0x00,
+    0x00, 0x07, 0xe0, 0x00, 0x23, 0x9e, 0x33, 0x09, 0xff, 0xff, 0xf1,
+
+    /* U+004A "J" */
+    0x00, 0x7f, 0xff, 0x80, 0x01, 0x33, 0xd8, 0x00, 0x00, 0x0d, 0x80, 0x00,
+    0x00, 0xd8, 0x00, 0x00, 0x0d, 0x80, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x0d,
+    0x80, 0x00, 0x00, 0xe7, 0x4a, 0x53, 0x7f, 0x32, 0xad, 0xfd, 0x60,
+
+    /* U+004B "K" */
+    0x1f, 0x50, 0x01, 0xcb, 0x11, 0xf5, 0x01, 0xcb, 0x10, 0x1f, 0x51, 0xbc,
+    0x10, 0x01, 0xf5, 0xbc, 0x10, 0x00, 0x1f, 0xef, 0x90, 0x00, 0x01, 0xfc,
+    0x5f, 0x40, 0x00, 0x1f, 0x50, 0x9d, 0x10, 0x01, 0xf5, 0x01, 0xda, 0x00,
+    0x1f, 0x50, 0x04, 0xf5, 0x01, 0xf5, 0x00, 0x09, 0xe1,
+
+    /* U+004C "L" */
+    0x8d, 0x00, 0x00, 0x08, 0xd0, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x08, 0xd0,
+    0x00, 0x00, 0x8d, 0x00, 0x00, 0x08, 0xd0, 0x00, 0x00, 0x8d, 0x00, 0x00,
+    0x08, 0xd0, 0x00, 0x00, 0x8d, 0x33, 0x33, 0x28, 0xff, 0xff, 0xfc,
+
+    /* U+004D "M" */
+    0x6f, 0x90, 0x03, 0xfc, 0x6e, 0xe0, 0x08, 0xdc, 0x6d, 0xa5, 0x0d, 0x8c,
+    0x6d, 0x5a, 0x4b, 0x7c, 0x6d, 0x1e, 0xa6, 0x7c, 0x6d, 0x0a, 0xf1, 0x7c,
+    0x6d, 0x03, 0x50, 0x7c, 0x6d, 0x00, 0x00, 0x7c, 0x6d, 0x00, 0x00, 0x7c,
+    0x6d, 0x00, 0x00, 0x7c,
+
+    /* U+004E "N" */
+    0x1f, 0xd0, 0x00, 0xd7, 0x1f, 0xf5, 0x00, 0xd7, 0x1f, 0xab, 0x00, 0xd7,
+    0x1f, 0x5e, 0x20, 0xd7, 0x1f, 0x49, 0x90, 0xd7, 0x1f, 0x42, 0xe1, 0xd7,
+    0x1f, 0x40, 0xb6, 0xd7, 0x1f, 0x40, 0x5c, 0xd7, 0x1f, 0x40, 0x0d, 0xf7,
+    0x1f, 0x40, 0x07, 0xf7,
+
+    /* U+004F "O" */
+    0x00, 0x8e, 0xfb, 0x20, 0x07, 0xe5, 0x3b, 0xd0, 0x0e, 0x80, 0x02, 0xf5,
+    0x2f, 0x50, 0x00, 0xe8, 0x3f, 0x40, 0x00, 0xc9, 0x3f, 0x40, 0x00, 0xc9,
+    0x2f, 0x50, 0x00, 0xe8, 0x0e, 0x80, 0x02, 0xf5, 0x07, 0xe5, 0x3b, 0xd0,
+    0x00, 0x8e, 0xfb, 0x20,
+
+    /* U+0050 "P" */
+    0xaf, 0xff, 0xd7, 0x0a, 0xc2, 0x37, 0xf6, 0xab, 0x00, 0x0b, 0xaa, 0xb0,
+    0x00, 0xbb, 0xab, 0x00, 0x5f, 0x7a, 0xff, 0xff, 0x90, 0xac, 0x32, 0x00,
+    0x0a, 0xb0, 0x00, 0x00, 0xab, 0x00, 0x00, 0x0a, 0xb0, 0x00, 0x00,
+
+    /* U+0051 "Q" */
+    0x00, 0x8e, 0xfb, 0x20, 0x07, 0xe5, 0x3b, 0xd0, 0x0e, 0x80, 0x02, 0xf5,
+    0x2f, 0x50, 0x00, 0xe8, 0x3f, 0x40, 0x00, 0xc9, 0x3f, 0x40, 0x00, 0xc9,
+    0x2f, 0x50, 0x00, 0xe8, 0x0e, 0x80, 0x02, 0xf4, 0x07, 0xe5, 0x3b, 0xd0,
+    0x00, 0x8e, 0xfe, 0x20, 0x00, 0x00, 0x2e, 0x90, 0x00, 0x00, 0x03, 0x60,
+
+    /* U+0052 "R" */
+    0x0f, 0xff, 0xea, 0x20, 0x00, 0xf7, 0x24, 0xbd, 0x10, 0x0f, 0x50, 0x03,
+    0xf3, 0x00, 0xf5, 0x01, 0x8f, 0x30, 0x0f, 0xff, 0xff, 0xa0, 0x00, 0xf7,
+    0x36, 0xb1, 0x00, 0x0f, 0x50, 0x09, 0x90, 0x00, 0xf5, 0x00, 0x2f, 0x30,
+    0x0f, 0x50, 0x00, 0xaa, 0x00, 0xf5, 0x00, 0x04, 0xf3,
+
+    /* U+0053 "S" */
+    0x01, 0x9d, 0xed, 0x80, 0x0a, 0xd4, 0x35, 0xa0, 0x0f, 0x50, 0x00, 0x00,
+    0x0e, 0x90, 0x00, 0x00, 0x05, 0xee, 0xa6, 0x00, 0x00, 0x15, 0x8d, 0xc1,
+    0x00, 0x00, 0x01, 0xe6, 0x00, 0x00, 0x00, 0xd7, 0x0b, 0x63, 0x39, 0xf3,
+    0x07, 0xce, 0xec, 0x40,
+
+    /* U+0054 "T" */
+    0xaf, 0xff, 0xff, 0xff, 0x22, 0x33, 0x9e, 0x33, 0x30, 0x00, 0x07, 0xe0,
+    0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00,
+    0x7e, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
+    0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
+
+    /* U+0055 "U" */
+    0xf6, 0x00, 0x0f, 0x6f, 0x60, 0x00, 0xf6, 0xf6, 0x00, 0x0f, 0x6f, 0x60,
+    0x00, 0xf6, 0xf6, 0x00, 0x0f, 0x6f, 0x60, 0x00, 0xf6, 0xf6, 0x00, 0x0f,
+    0x6e, 0x70, 0x00, 0xf5, 0xad, 0x43, 0x9f, 0x11, 0x9e, 0xec, 0x40,
+
+    /* U+0056 "V" */
+    0x7e, 0x00, 0x00, 0x8d, 0x02, 0xf3, 0x00, 0x0c, 0x90, 0x0d, 0x70, 0x01,
+    0xf4, 0x00, 0x9b, 0x00, 0x5e, 0x10, 0x04, 0xe0, 0x08, 0xa0, 0x00, 0x0e,
+    0x40, 0xc6, 0x00, 0x00, 0xa8, 0x1f, 0x10, 0x00, 0x06, 0xc5, 0xc0, 0x00,
+    0x00, 0x1f, 0xa7, 0x00, 0x00, 0x00, 0xcf, 0x30, 0x00,
+
+    /* U+0057 "W" */
+    0xe6, 0x00, 0x00, 0x0f, 0x5c, 0x80, 0x00, 0x02, 0xf3, 0x9a, 0x09, 0xf1,
+    0x3f, 0x17, 0xc0, 0xce, 0x35, 0xd0, 0x5e, 0x0e, 0x96, 0x7b, 0x02, 0xf3,
+    0xc5, 0x99, 0x90, 0x0f, 0x89, 0x2c, 0xb7, 0x00, 0xdd, 0x50, 0xed, 0x40,
+    0x0b, 0xf2, 0x0b, 0xf2, 0x00, 0x8e, 0x00, 0x8f, 0x00,
+
+    /* U+0058 "X" */
+    0x2e, 0x60, 0x00, 0xbb, 0x00, 0x7e, 0x10, 0x5e, 0x20, 0x00, 0xc8, 0x1d,
+    0x70, 0x00, 0x03, 0xfa, 0xc0, 0x00, 0x00, 0x0a, 0xf3, 0x00, 0x00, 0x01,
+    0xee, 0x80, 0x00, 0x00, 0x9c, 0x3f, 0x20, 0x00, 0x4f, 0x30, 0xab, 0x00,
+    0x1d, 0x80, 0x02, 0xe6, 0x08, 0xd1, 0x00, 0x07, 0xe1,
+
+    /* U+0059 "Y" */
+    0x7e, 0x10, 0x00, 0x9d, 0x00, 0xd9, 0x00, 0x2f, 0x40, 0x04, 0xf2, 0x0b,
+    0xa0, 0x00, 0x0a, 0xb4, 0xf2, 0x00, 0x00, 0x2e, 0xe8, 0x00, 0x00, 0x00,
+    0x8e, 0x10, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
+    0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
+
+    /* U+005A "Z" */
+    0xcf, 0xff, 0xff, 0xd2, 0x33, 0x34, 0xe8, 0x00, 0x00, 0xad, 0x00, 0x00,
+    0x5f, 0x30, 0x00, 0x1e, 0x70, 0x00, 0x0a, 0xc0, 0x00, 0x05, 0xe2, 0x00,
+    0x01, 0xe6, 0x00, 0x00, 0xac, 0x33, 0x33, 0x3e, 0xff, 0xff, 0xff,
+
+    /* U+005B "[" */
+    0xcf, 0xf1, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00,
+    0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00,
+    0xcf, 0xf1,
+
+    /* U+005C backslash */
+    0x1f, 0x30, 0x00, 0x00, 0x09, 0xb0, 0x00, 0x00, 0x02, 0xf3, 0x00, 0x00,
+    0x00, 0xaa, 0x00, 0x00, 0x00, 0x3f, 0x20, 0x00, 0x00, 0x0b, 0x90, 0x00,
+    0x00, 0x04, 0xe1, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x5e, 0x10,
+    0x00, 0x00, 0x0d, 0x70, 0x00, 0x00, 0x06, 0xd0, 0x00, 0x00, 0x00, 0x72,
+
+    /* U+005D "]" */
+    0xaf, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+    0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4, 0x00, 0xf4,
+    0x9f, 0xf4,
+
+    /* U+005E "^" */
+    0x00, 0x0b, 0xf3, 0x00, 0x00, 0x8d, 0x8d, 0x10, 0x05, 0xe2, 0x09, 0xb0,
+    0x2e, 0x30, 0x00, 0xb8,
+
+    /* U+005F "_" */
+    0x88, 0x88, 0x88, 0x88, 0x40,
+
+    /* U+0060 "`" */
+    0x06, 0x30, 0x00, 0x4d, 0x20, 0x00, 0x5c, 0x00,
+
+    /* U+0061 "a" */
+    0x04, 0xbe, 0xeb, 0x30, 0x06, 0x63, 0x29, 0xd0, 0x00, 0x00, 0x01, 0xf3,
+    0x02, 0xae, 0xff, 0xf3, 0x0c, 0xa2, 0x01, 0xf4, 0x1f, 0x30, 0x03, 0xf4,
+    0x0d, 0x70, 0x1b, 0xf4, 0x03, 0xcd, 0xd5, 0xf4,
+
+    /* U+0062 "b" */
+    0xa9, 0x00, 0x00, 0x0a, 0x90, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x0a, 0xaa,
+    0xfd, 0x40, 0xaf, 0x72, 0x8e, 0x1a, 0xc0, 0x00, 0xe6, 0xa9, 0x00, 0x0c,
+    0x8a, 0x90, 0x00, 0xc8, 0xac, 0x00, 0x0e, 0x6a, 0xf7, 0x28, 0xe1, 0xaa,
+    0xbf, 0xd4, 0x00,
+
+    /* U+0063 "c" */
+    0x02, 0xae, 0xeb, 0x21, 0xdb, 0x32, 0x73, 0x6e, 0x10, 0x00, 0x09, 0xb0,
+    0x00, 0x00, 0x9b, 0x00, 0x00, 0x06, 0xe1, 0x00, 0x00, 0x1d, 0xb3, 0x27,
+    0x30, 0x2a, 0xee, 0xb2,
+
+    /* U+0064 "d" */
+    0x00, 0x00, 0x02, 0xf2, 0x00, 0x00, 0x02, 0xf2, 0x00, 0x00, 0x02, 0xf2,
+    0x01, 0xae, 0xd7, 0xf2, 0x09, 0xd3, 0x3d, 0xf2, 0x0e, 0x60, 0x06, 0xf2,
+    0x1f, 0x30, 0x03, 0xf2, 0x1f, 0x30, 0x03, 0xf2, 0x0e, 0x50, 0x05, 0xf2,
+    0x08, 0xc1, 0x1c, 0xf2, 0x01, 0xae, 0xd7, 0xf2,
+
+    /* U+0065 "e" */
+    0x00, 0x7d, 0xec, 0x40, 0x06, 0xd4, 0x26, 0xe2, 0x0e, 0x50, 0x00, 0xb7,
+    0x1f, 0xff, 0xff, 0xf9, 0x1f, 0x30, 0x00, 0x00, 0x0e, 0x70, 0x00, 0x00,
+    0x06, 0xe6, 0x23, 0x84, 0x00, 0x6d, 0xfd, 0xa2,
+
+    /* U+0066 "f" */
+    0x00, 0x1b, 0xef, 0x40, 0x07, 0xd2, 0x10, 0x00, 0x9a, 0x00, 0x0a, 0xff,
+    0xff, 0xf4, 0x00, 0x9a, 0x00, 0x00, 0x09, 0xa0, 0x00, 0x00, 0x9a, 0x00,
+    0x00, 0x09, 0xa0, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x09, 0xa0, 0x00, 0x00,
+    0x9a, 0x00, 0x00,
+
+    /* U+0067 "g" */
+    0x01, 0xae, 0xd6, 0xf2, 0x08, 0xd4, 0x3d, 0xf2, 0x0e, 0x60, 0x05, 0xf2,
+    0x1f, 0x30, 0x03, 0xf2, 0x1f, 0x30, 0x03, 0xf2, 0x0e, 0x60, 0x05, 0xf2,
+    0x08, 0xd3, 0x3c, 0xf2, 0x01, 0xae, 0xd6, 0xf1, 0x00, 0x00, 0x04, 0xf0,
+    0x03, 0x51, 0x2b, 0x90, 0x03, 0xce, 0xe9, 0x10,
+
+    /* U+0068 "h" */
+    0xa9, 0x00, 0x00, 0x0a, 0x90, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x0a, 0x99,
+    0xed, 0x40, 0xae, 0x73, 0xad, 0x0a, 0xb0, 0x02, 0xf2, 0xa9, 0x00, 0x1f,
+    0x3a, 0x90, 0x01, 0xf3, 0xa9, 0x00, 0x1f, 0x3a, 0x90, 0x01, 0xf3, 0xa9,
+    0x00, 0x1f, 0x30,
+
+    /* U+0069 "i" */
+    0x00, 0x4f, 0x00, 0x00, 0x03, 0x90, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff,
+    0xf0, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x04, 0xf0, 0x00, 0x00, 0x4f, 0x00,
+    0x00, 0x04, 0xf0, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x04, 0xf0, 0x00, 0xcf,
+    0xff, 0xff, 0x70,
+
+    /* U+006A "j" */
+    0x00, 0x0d, 0x50, 0x00, 0x83, 0x00, 0x00, 0x01, 0xff, 0xf5, 0x00, 0x0d,
+    0x50, 0x00, 0xd5, 0x00, 0x0d, 0x50, 0x00, 0xd5, 0x00, 0x0d, 0x50, 0x00,
+    0xd5, 0x00, 0x0d, 0x50, 0x00, 0xe5, 0x11, 0x5f, 0x2b, 0xfe, 0x60,
+
+    /* U+006B "k" */
+    0x6e, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00,
+    0x6e, 0x00, 0x5e, 0x40, 0x6e, 0x04, 0xe4, 0x00, 0x6e, 0x4e, 0x40, 0x00,
+    0x6f, 0xee, 0x20, 0x00, 0x6f, 0x4b, 0xb0, 0x00, 0x6e, 0x02, 0xe7, 0x00,
+    0x6e, 0x00, 0x5f, 0x30, 0x6e, 0x00, 0x0a, 0xd0,
+
+    /* U+006C "l" */
+    0xef, 0xf6, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x0d,
+    0x60, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x0d, 0x60, 0x00, 0x00, 0xd6, 0x00,
+    0x00, 0x0d, 0x60, 0x00, 0x00, 0xd6, 0x00, 0x00, 0x0a, 0xb2, 0x10, 0x00,
+    0x2b, 0xff, 0x10,
+
+    /* U+006D "m" */
+    0x4e, 0xbe, 0x6c, 0xd3, 0x4f, 0x39, 0xf3, 0xa9, 0x4e, 0x05, 0xd0, 0x6b,
+    0x4d, 0x05, 0xc0, 0x6b, 0x4d, 0x05, 0xc0, 0x6c, 0x4d, 0x05, 0xc0, 0x6c,
+    0x4d, 0x05, 0xc0, 0x6c, 0x4d, 0x05, 0xc0, 0x6c,
+
+    /* U+006E "n" */
+    0xaa, 0xae, 0xd4, 0x0a, 0xf4, 0x08, 0xd0, 0xab, 0x00, 0x2f, 0x2a, 0x90,
+    0x01, 0xf3, 0xa9, 0x00, 0x1f, 0x3a, 0x90, 0x01, 0xf3, 0xa9, 0x00, 0x1f,
+    0x3a, 0x90, 0x01, 0xf3,
+
+    /* U+006F "o" */
+    0x00, 0x8e, 0xfb, 0x30, 0x07, 0xe4, 0x2a, 0xd0, 0x0d, 0x70, 0x01, 0xf4,
+    0x0f, 0x50, 0x00, 0xd7, 0x0f, 0x50, 0x00, 0xd7, 0x0d, 0x70, 0x01, 0xf4,
+    0x07, 0xe4, 0x2a, 0xd0, 0x00, 0x8e, 0xfb, 0x30,
+
+    /* U+0070 "p" */
+    0xba, 0xbe, 0xd4, 0x0b, 0xf4, 0x06, 0xe1, 0xbb, 0x00, 0x0e, 0x6b, 0x90,
+    0x00, 0xc8, 0xb9, 0x00, 0x0c, 0x8b, 0xc0, 0x01, 0xe6, 0xbf, 0x72, 0x9e,
+    0x1b, 0x9b, 0xfd, 0x40, 0xb8, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x00, 0xb8,
+    0x00, 0x00, 0x00,
+
+    /* U+0071 "q" */
+    0x00, 0x9e, 0xd6, 0xf3, 0x07, 0xe4, 0x3c, 0xf3, 0x0d, 0x70, 0x04, 0xf3,
+    0x0f, 0x50, 0x01, 0xf3, 0x0f, 0x50, 0x01, 0xf3, 0x0d, 0x70, 0x04, 0xf3,
+    0x07, 0xe4, 0x3c, 0xf3, 0x00, 0x9e, 0xe6, 0xf3, 0x00, 0x00, 0x01, 0xf3,
+    0x00, 0x00, 0x01, 0xf3, 0x00, 0x00, 0x01, 0xf3,
+
+    /* U+0072 "r" */
+    0x8b, 0x6d, 0xfb, 0x8e, 0xa2, 0x15, 0x8e, 0x10, 0x00, 0x8c, 0x00, 0x00,
+    0x8b, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x8b, 0x00, 0x00,
+
+    /* U+0073 "s" */
+    0x08, 0xdf, 0xd6, 0x05, 0xe4, 0x24, 0x60, 0x7d, 0x00, 0x00, 0x02, 0xed,
+    0x95, 0x00, 0x01, 0x59, 0xea, 0x00, 0x00, 0x05, 0xf0, 0x66, 0x22, 0xac,
+    0x05, 0xce, 0xeb, 0x20,
+
+    /* U+0074 "t" */
+    0x00, 0x1f, 0x30, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x2f, 0xff, 0xff, 0xf1,
+    0x00, 0x1f, 0x30, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x00, 0x1f, 0x30, 0x00,
+    0x00, 0x1f, 0x30, 0x00, 0x00, 0x1f, 0x30, 0x00, 0x00, 0x0d, 0x81, 0x00,
+    0x00, 0x05, 0xdf, 0xf1,
+
+    /* U+0075 "u" */
+    0xa9, 0x00, 0x1f, 0x3a, 0x90, 0x01, 0xf3, 0xa9, 0x00, 0x1f, 0x3a, 0x90,
+    0x01, 0xf3, 0xa9, 0x00, 0x1f, 0x39, 0xa0, 0x03, 0xf3, 0x6e, 0x10, 0xaf,
+    0x30, 0xae, 0xd6, 0xf3,
+
+    /* U+0076 "v" */
+    0x2f, 0x20, 0x00, 0xb9, 0x0c, 0x70, 0x01, 0xf4, 0x07, 0xc0, 0x06, 0xd0,
+    0x02, 0xf2, 0x0b, 0x80, 0x00, 0xc7, 0x1f, 0x30, 0x00, 0x7c, 0x6d, 0x00,
+    0x00, 0x2f, 0xc8, 0x00, 0x00, 0x0c, 0xf3, 0x00,
+
+    /* U+0077 "w" */
+    0xd5, 0x00, 0x00, 0x0e, 0x5a, 0x80, 0x00, 0x02, 0xf1, 0x7b, 0x04, 0x80,
+    0x5d, 0x03, 0xe0, 0xae, 0x18, 0xa0, 0x0f, 0x3d, 0x85, 0xb6, 0x00, 0xc8,
+    0xa4, 0x9e, 0x30, 0x08, 0xe6, 0x0e, 0xe0, 0x00, 0x5f, 0x20, 0xbb, 0x00,
+
+    /* U+0078 "x" */
+    0x0c, 0x80, 0x02, 0xe4, 0x03, 0xe4, 0x0c, 0x90, 0x00, 0x6d, 0x8c, 0x00,
+    0x00, 0x0b, 0xf3, 0x00, 0x00, 0x1d, 0xf6, 0x00, 0x00, 0xab, 0x4e, 0x20,
+    0x06, 0xe1, 0x09, 0xc0, 0x2e, 0x50, 0x01, 0xd8,
+
+    /* U+0079 "y" */
+    0x2f, 0x30, 0x00, 0xaa, 0x0b, 0x90, 0x01, 0xe5, 0x05, 0xe0, 0x05, 0xe0,
+    0x00, 0xe5, 0x0b, 0x90, 0x00, 0x9a, 0x1f, 0x30, 0x00, 0x3f, 0x7c, 0x00,
+    0x00, 0x0d, 0xf7, 0x00, 0x00, 0x07, 0xf2, 0x00, 0x00, 0x09, 0xb0, 0x00,
+    0x01, 0x3e, 0x50, 0x00, 0x0b, 0xf9, 0x00, 0x00,
+
+    /* U+007A "z" */
+    0x7f, 0xff, 0xff, 0x20, 0x00, 0x09, 0xc0, 0x00, 0x05, 0xe2, 0x00, 0x02,
+    0xe5, 0x00, 0x01, 0xc9, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x5e, 0x31, 0x11,
+    0x09, 0xff, 0xff, 0xf2,
+
+    /* U+007B "{" */
+    0x00, 0x0a, 0xee, 0x00, 0x4f, 0x30, 0x00, 0x6e, 0x00, 0x00, 0x6e, 0x00,
+    0x00, 0x6d, 0x00, 0x01, 0xbb, 0x00, 0x7f, 0xe2, 0x00, 0x01, 0xbb, 0x00,
+    0x00, 0x6d, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x4f, 0x30,
+    0x00, 0x09, 0xee,
+
+    /* U+007C "|" */
+    0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+    0x6c, 0x6c, 0x36,
+
+    /* U+007D "}" */
+    0x7f, 0xc3, 0x00, 0x01, 0xba, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00,
+    0x00, 0x7c, 0x00, 0x00, 0x4f, 0x30, 0x00, 0x0a, 0xfe, 0x00, 0x4f, 0x30,
+    0x00, 0x7c, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7b, 0x00, 0x01, 0xba, 0x00,
+    0x7f, 0xc3, 0x00,
+
+    /* U+007E "~" */
+    0x1a, 0xec, 0x61, 0x28, 0x67, 0x36, 0xcf, 0xf7, 0x00, 0x00, 0x01, 0x00,
+};
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 128, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 128, .box_w = 2, .box_h = 10, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 10, .adv_w = 128, .box_w = 5, .box_h = 4, .ofs_x = 2, .ofs_y = 6},
+    {.bitmap_index = 20, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 65, .adv_w = 128, .box_w = 7, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 111, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 156, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 201, .adv_w = 128, .box_w = 2, .box_h = 4, .ofs_x = 3, .ofs_y = 6},
+    {.bitmap_index = 205, .adv_w = 128, .box_w = 5, .box_h = 13, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 238, .adv_w = 128, .box_w = 4, .box_h = 13, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 264, .adv_w = 128, .box_w = 7, .box_h = 7, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 289, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 1},
+    {.bitmap_index = 321, .adv_w = 128, .box_w = 4, .box_h = 5, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 331, .adv_w = 128, .box_w = 4, .box_h = 2, .ofs_x = 2, .ofs_y = 3},
+    {.bitmap_index = 335, .adv_w = 128, .box_w = 3, .box_h = 3, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 340, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 388, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 428, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 463, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 498, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 538, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 578, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 618, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 658, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 698, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 738, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 778, .adv_w = 128, .box_w = 3, .box_h = 8, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 790, .adv_w = 128, .box_w = 4, .box_h = 10, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 810, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 842, .adv_w = 128, .box_w = 8, .box_h = 5, .ofs_x = 0, .ofs_y = 2},
+    {.bitmap_index = 862, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 894, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 929, .adv_w = 128, .box_w = 9, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 983, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1028, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1063, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1103, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1143, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1178, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1213, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1253, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1293, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1328, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1363, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1408, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1443, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1483, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1523, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1563, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1598, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 1646, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1691, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1731, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1776, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1811, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1856, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1901, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1946, .adv_w = 128, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1991, .adv_w = 128, .box_w = 7, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2026, .adv_w = 128, .box_w = 4, .box_h = 13, .ofs_x = 3, .ofs_y = -2},
+    {.bitmap_index = 2052, .adv_w = 128, .box_w = 8, .box_h = 12, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2100, .adv_w = 128, .box_w = 4, .box_h = 13, .ofs_x = 2, .ofs_y = -2},
+    {.bitmap_index = 2126, .adv_w = 128, .box_w = 8, .box_h = 4, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 2142, .adv_w = 128, .box_w = 9, .box_h = 1, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 2147, .adv_w = 128, .box_w = 5, .box_h = 3, .ofs_x = 1, .ofs_y = 9},
+    {.bitmap_index = 2155, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2187, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2226, .adv_w = 128, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2254, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2298, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2330, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2369, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2413, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2452, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2491, .adv_w = 128, .box_w = 5, .box_h = 14, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2526, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2570, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2609, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2641, .adv_w = 128, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2669, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2701, .adv_w = 128, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = -3},
+    {.bitmap_index = 2740, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2784, .adv_w = 128, .box_w = 6, .box_h = 8, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2808, .adv_w = 128, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2836, .adv_w = 128, .box_w = 8, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2876, .adv_w = 128, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2904, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2936, .adv_w = 128, .box_w = 9, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2972, .adv_w = 128, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3004, .adv_w = 128, .box_w = 8, .box_h = 11, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 3048, .adv_w = 128, .box_w = 7, .box_h = 8, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3076, .adv_w = 128, .box_w = 6, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3115, .adv_w = 128, .box_w = 2, .box_h = 15, .ofs_x = 3, .ofs_y = -4},
+    {.bitmap_index = 3130, .adv_w = 128, .box_w = 6, .box_h = 13, .ofs_x = 1, .ofs_y = -2},
+    {.bitmap_index = 3169, .adv_w = 128, .box_w = 8, .box_h = 3, .ofs_x = 0, .ofs_y = 3}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    }
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = NULL,
+    .kern_scale = 0,
+    .cmap_num = 1,
+    .bpp = 4,
+    .kern_classes = 0,
+    .bitmap_format = 0,
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+const lv_font_t font_dejavu_mono_14_4 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,
+    .line_height = 17,
+    .base_line = 4,
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,
+    .fallback = NULL,
+    .user_data = NULL,
+};
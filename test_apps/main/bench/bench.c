@@ -0,0 +1,225 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "bench.h"
+
+static const char *TAG = "bench";
+
+typedef struct {
+    uint32_t *frame_us;
+    uint32_t *render_us;
+    uint32_t *flush_us;
+} bench_samples_t;
+
+static int bench_cmp_u32(const void *a, const void *b)
+{
+    uint32_t va = *(const uint32_t *)a;
+    uint32_t vb = *(const uint32_t *)b;
+    return (va > vb) - (va < vb);
+}
+
+/** Sorts values in place; percentiles use the nearest-rank method */
+static void bench_dist_calc(uint32_t *values, uint32_t count, bench_dist_t *out)
+{
+    uint64_t sum = 0;
+
+    memset(out, 0, sizeof(*out));
+    if (count == 0) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        sum += values[i];
+    }
+    qsort(values, count, sizeof(uint32_t), bench_cmp_u32);
+
+    out->mean = (uint32_t)(sum / count);
+    out->p50 = values[((uint64_t)count * 50U + 99U) / 100U - 1U];
+    out->p99 = values[((uint64_t)count * 99U + 99U) / 100U - 1U];
+    out->max = values[count - 1];
+}
+
+static void bench_counter_add(gfx_perf_counter_t *dst, const gfx_perf_counter_t *src)
+{
+    dst->calls += src->calls;
+    dst->pixels += src->pixels;
+    dst->time_us += src->time_us;
+}
+
+static void bench_blend_add(gfx_blend_perf_stats_t *dst, const gfx_blend_perf_stats_t *src)
+{
+    bench_counter_add(&dst->fill, &src->fill);
+    bench_counter_add(&dst->color_draw, &src->color_draw);
+    bench_counter_add(&dst->image_draw, &src->image_draw);
+    bench_counter_add(&dst->triangle_draw, &src->triangle_draw);
+    dst->triangle_covered_pixels += src->triangle_covered_pixels;
+    dst->triangle_aa_pixels += src->triangle_aa_pixels;
+}
+
+static void bench_samples_free(bench_samples_t *samples)
+{
+    free(samples->frame_us);
+    free(samples->render_us);
+    free(samples->flush_us);
+}
+
+static void bench_report_dist(FILE *out, const char *key, const bench_dist_t *dist)
+{
+    fprintf(out, "\"%s\": {\"mean\": %" PRIu32 ", \"p50\": %" PRIu32 ", \"p99\": %" PRIu32 ", \"max\": %" PRIu32 "}",
+            key, dist->mean, dist->p50, dist->p99, dist->max);
+}
+
+static void bench_report_counter(FILE *out, const char *key, const gfx_perf_counter_t *counter)
+{
+    /* pixels per microsecond == Mpix/s */
+    double mpix_s = (counter->time_us > 0) ? (double)counter->pixels / (double)counter->time_us : 0.0;
+
+    fprintf(out, "\"%s\": {\"calls\": %" PRIu64 ", \"pixels\": %" PRIu64 ", \"time_us\": %" PRIu64 ", \"mpix_s\": %.2f}",
+            key, counter->calls, counter->pixels, counter->time_us, mpix_s);
+}
+
+/** Fire the timers due in the next frame_ms of virtual time (animation, motion, scrolling) */
+static void bench_advance(gfx_handle_t handle, const bench_config_t *cfg)
+{
+    if (cfg->frame_ms > 0) {
+        gfx_timer_step(handle, cfg->frame_ms);
+    }
+}
+
+esp_err_t bench_run_scene(const bench_scene_t *scene, gfx_handle_t handle, gfx_disp_t *disp,
+                          const bench_config_t *cfg, bench_result_t *out)
+{
+    bench_samples_t samples = {0};
+    gfx_disp_perf_stats_t stats;
+    gfx_disp_perf_stats_t prev;
+    bench_scene_ctx_t ctx = {
+        .handle = handle,
+        .disp = disp,
+        .h_res = (uint16_t)gfx_disp_get_hor_res(disp),
+        .v_res = (uint16_t)gfx_disp_get_ver_res(disp),
+    };
+    esp_err_t ret;
+
+    if (scene == NULL || handle == NULL || disp == NULL || cfg == NULL || out == NULL || cfg->frames == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(out, 0, sizeof(*out));
+    out->name = scene->name;
+
+    samples.frame_us = calloc(cfg->frames, sizeof(uint32_t));
+    samples.render_us = calloc(cfg->frames, sizeof(uint32_t));
+    samples.flush_us = calloc(cfg->frames, sizeof(uint32_t));
+    if (samples.frame_us == NULL || samples.render_us == NULL || samples.flush_us == NULL) {
+        bench_samples_free(&samples);
+        return ESP_ERR_NO_MEM;
+    }
+
+    gfx_emote_lock(handle);
+    if (cfg->frame_ms > 0) {
+        gfx_timer_set_virtual_clock(handle, true);
+    }
+
+    size_t free_start = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    size_t free_min = free_start;
+
+    ret = scene->setup(&ctx);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "%s: setup failed (%s)", scene->name, esp_err_to_name(ret));
+        scene->teardown(&ctx);
+        gfx_timer_set_virtual_clock(handle, false);
+        gfx_emote_unlock(handle);
+        bench_samples_free(&samples);
+        return ret;
+    }
+
+    gfx_disp_refresh_all(disp);
+    for (uint32_t i = 0; i < cfg->warmup_frames; i++) {
+        scene->step(&ctx, i);
+        bench_advance(handle, cfg);
+        gfx_refr_now(handle);
+    }
+    gfx_disp_get_perf_stats(disp, &prev);
+
+    for (uint32_t i = 0; i < cfg->frames; i++) {
+        scene->step(&ctx, cfg->warmup_frames + i);
+        bench_advance(handle, cfg);
+        gfx_refr_now(handle);
+        gfx_disp_get_perf_stats(disp, &stats);
+
+        size_t free_now = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+        if (free_now < free_min) {
+            free_min = free_now;
+        }
+
+        /* A frame with nothing dirty leaves the previous frame's stats in place */
+        if (stats.frame_count == prev.frame_count) {
+            out->idle_frames++;
+            continue;
+        }
+        prev = stats;
+
+        samples.frame_us[out->frames] = (uint32_t)stats.frame_time_us;
+        samples.render_us[out->frames] = (uint32_t)stats.render_time_us;
+        samples.flush_us[out->frames] = (uint32_t)stats.flush_time_us;
+        out->frames++;
+        out->dirty_px += stats.dirty_pixels;
+        bench_blend_add(&out->blend, &stats.blend);
+    }
+
+    scene->teardown(&ctx);
+    gfx_timer_set_virtual_clock(handle, false);
+    gfx_emote_unlock(handle);
+
+    out->heap_high_water = free_start - free_min;
+    bench_dist_calc(samples.frame_us, out->frames, &out->frame_us);
+    bench_dist_calc(samples.render_us, out->frames, &out->render_us);
+    bench_dist_calc(samples.flush_us, out->frames, &out->flush_us);
+    bench_samples_free(&samples);
+
+    ESP_LOGI(TAG, "%s: %" PRIu32 " frames (%" PRIu32 " idle), p50 %" PRIu32 " us, p99 %" PRIu32 " us",
+             scene->name, out->frames, out->idle_frames, out->frame_us.p50, out->frame_us.p99);
+    return ESP_OK;
+}
+
+void bench_report_write(FILE *out, const bench_config_t *cfg, gfx_disp_t *disp,
+                        const bench_result_t *results, size_t count)
+{
+    fprintf(out, "{\"target\": \"%s\", \"h_res\": %" PRIu32 ", \"v_res\": %" PRIu32
+            ", \"frames\": %" PRIu32 ", \"warmup_frames\": %" PRIu32 ", \"frame_ms\": %" PRIu32 ", \"scenes\": [\n",
+            cfg->target ? cfg->target : "unknown",
+            gfx_disp_get_hor_res(disp), gfx_disp_get_ver_res(disp),
+            cfg->frames, cfg->warmup_frames, cfg->frame_ms);
+
+    for (size_t i = 0; i < count; i++) {
+        const bench_result_t *r = &results[i];
+        uint64_t dirty_mean = (r->frames > 0) ? r->dirty_px / r->frames : 0;
+
+        fprintf(out, "  {\"name\": \"%s\", \"frames\": %" PRIu32 ", \"idle_frames\": %" PRIu32 ",\n   ",
+                r->name, r->frames, r->idle_frames);
+        bench_report_dist(out, "frame_us", &r->frame_us);
+        fprintf(out, ",\n   ");
+        bench_report_dist(out, "render_us", &r->render_us);
+        fprintf(out, ",\n   ");
+        bench_report_dist(out, "flush_us", &r->flush_us);
+        fprintf(out, ",\n   \"dirty_px\": {\"total\": %" PRIu64 ", \"mean\": %" PRIu64 "},\n",
+                r->dirty_px, dirty_mean);
+        fprintf(out, "   \"blend\": {");
+        bench_report_counter(out, "fill", &r->blend.fill);
+        fprintf(out, ",\n             ");
+        bench_report_counter(out, "color_draw", &r->blend.color_draw);
+        fprintf(out, ",\n             ");
+        bench_report_counter(out, "image_draw", &r->blend.image_draw);
+        fprintf(out, ",\n             ");
+        bench_report_counter(out, "triangle_draw", &r->blend.triangle_draw);
+        fprintf(out, "},\n   \"heap_high_water\": %zu}%s\n", r->heap_high_water, (i + 1 < count) ? "," : "");
+    }
+    fprintf(out, "]}\n");
+}
@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "esp_err.h"
+#include "gfx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Frame-time benchmark: drives a scene for N frames with gfx_refr_now() while
+ * holding the render lock (no FPS cap, no timer-driven updates) and records
+ * gfx_disp_perf_stats_t per frame. Builds unchanged on target (test_bench.c)
+ * and on the host (host/bench/gfx_bench.c).
+ */
+
+#define BENCH_REPORT_BEGIN "BENCH_REPORT_BEGIN"
+#define BENCH_REPORT_END   "BENCH_REPORT_END"
+
+typedef struct {
+    gfx_handle_t handle;
+    gfx_disp_t *disp;
+    uint16_t h_res;
+    uint16_t v_res;
+    void *state;                /**< Scene-private state, owned by setup/teardown */
+} bench_scene_ctx_t;
+
+typedef struct {
+    const char *name;
+    esp_err_t (*setup)(bench_scene_ctx_t *ctx);
+    void (*step)(bench_scene_ctx_t *ctx, uint32_t frame);   /**< Mutate the scene before frame N is rendered */
+    void (*teardown)(bench_scene_ctx_t *ctx);
+} bench_scene_t;
+
+typedef struct {
+    uint32_t frames;            /**< Measured frames per scene */
+    uint32_t warmup_frames;     /**< Frames rendered before measuring (first full-screen draw, caches) */
+    uint32_t frame_ms;          /**< Virtual clock advance per frame (timers fire deterministically); 0 = wall clock */
+    const char *target;         /**< Reported as-is, e.g. "esp32s3" or "linux" */
+} bench_config_t;
+
+/** Frame-time distribution in microseconds */
+typedef struct {
+    uint32_t mean;
+    uint32_t p50;
+    uint32_t p99;
+    uint32_t max;
+} bench_dist_t;
+
+typedef struct {
+    const char *name;
+    uint32_t frames;            /**< Frames that rendered something */
+    uint32_t idle_frames;       /**< Frames with nothing dirty (not part of the distributions) */
+    bench_dist_t frame_us;
+    bench_dist_t render_us;
+    bench_dist_t flush_us;
+    uint64_t dirty_px;          /**< Sum over measured frames */
+    gfx_blend_perf_stats_t blend;   /**< Sum over measured frames */
+    size_t heap_high_water;     /**< Peak bytes in use above the pre-setup level, sampled per frame */
+} bench_result_t;
+
+/** Scenes shared by the target and host runners */
+extern const bench_scene_t bench_scenes[];
+extern const size_t bench_scene_count;
+
+/**
+ * @brief Run one scene and summarize its frames
+ *
+ * Takes the render lock for the whole run; the render task resumes afterwards.
+ * @return ESP_OK, ESP_ERR_NO_MEM, or the error from scene setup
+ */
+esp_err_t bench_run_scene(const bench_scene_t *scene, gfx_handle_t handle, gfx_disp_t *disp,
+                          const bench_config_t *cfg, bench_result_t *out);
+
+/**
+ * @brief Write results as one JSON object (see scripts/bench_compare.py)
+ */
+void bench_report_write(FILE *out, const bench_config_t *cfg, gfx_disp_t *disp,
+                        const bench_result_t *results, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
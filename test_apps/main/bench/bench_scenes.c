@@ -0,0 +1,296 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <inttypes.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "widget/gfx_motion.h"
+#include "../claw_motion.inc"
+
+/*
+ * Scenes only use C-array assets so they run on the host as well; the
+ * mmap-backed animation assets of test_anim.c / test_multi_obj.c are not
+ * available there.
+ */
+
+#define BENCH_IMG_COUNT             4
+#define BENCH_MOTION_ACTION_FRAMES  60
+#define BENCH_LABEL_TEXT_FRAMES     8
+
+extern const gfx_image_dsc_t icon_rgb565;
+extern const gfx_image_dsc_t icon_rgb565A8;
+extern const lv_font_t font_dejavu_mono_14_4;
+
+typedef struct {
+    gfx_obj_t *objs[BENCH_IMG_COUNT];
+} bench_img_state_t;
+
+typedef struct {
+    gfx_obj_t *qrcode;
+    gfx_obj_t *img;
+} bench_qrcode_state_t;
+
+typedef struct {
+    gfx_obj_t *wrap;
+    gfx_obj_t *scroll;
+    gfx_obj_t *counter;
+} bench_label_state_t;
+
+typedef struct {
+    gfx_motion_player_t player;
+    uint16_t action;
+} bench_motion_state_t;
+
+/** Triangle wave over [0, range]: deterministic bounce without per-object velocity state */
+static gfx_coord_t bench_bounce(uint32_t t, uint32_t range)
+{
+    if (range == 0) {
+        return 0;
+    }
+    uint32_t phase = t % (2U * range);
+    return (gfx_coord_t)((phase <= range) ? phase : 2U * range - phase);
+}
+
+static esp_err_t bench_img_setup(bench_scene_ctx_t *ctx, const gfx_image_dsc_t *src)
+{
+    bench_img_state_t *state = calloc(1, sizeof(bench_img_state_t));
+    if (state == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->state = state;
+
+    for (int i = 0; i < BENCH_IMG_COUNT; i++) {
+        state->objs[i] = gfx_img_create(ctx->disp);
+        if (state->objs[i] == NULL) {
+            return ESP_ERR_NO_MEM;
+        }
+        gfx_img_set_src(state->objs[i], (void *)src);
+    }
+    return ESP_OK;
+}
+
+static void bench_img_step(bench_scene_ctx_t *ctx, uint32_t frame)
+{
+    bench_img_state_t *state = (bench_img_state_t *)ctx->state;
+
+    for (int i = 0; i < BENCH_IMG_COUNT; i++) {
+        uint16_t w = 0;
+        uint16_t h = 0;
+
+        gfx_obj_get_size(state->objs[i], &w, &h);
+        uint32_t range_x = (ctx->h_res > w) ? ctx->h_res - w : 0;
+        uint32_t range_y = (ctx->v_res > h) ? ctx->v_res - h : 0;
+        gfx_obj_set_pos(state->objs[i],
+                        bench_bounce(frame * (3U + i) + i * 37U, range_x),
+                        bench_bounce(frame * (2U + i) + i * 23U, range_y));
+    }
+}
+
+static void bench_img_teardown(bench_scene_ctx_t *ctx)
+{
+    bench_img_state_t *state = (bench_img_state_t *)ctx->state;
+
+    if (state == NULL) {
+        return;
+    }
+    for (int i = 0; i < BENCH_IMG_COUNT; i++) {
+        if (state->objs[i] != NULL) {
+            gfx_obj_delete(state->objs[i]);
+        }
+    }
+    free(state);
+    ctx->state = NULL;
+}
+
+static esp_err_t bench_img_rgb565_setup(bench_scene_ctx_t *ctx)
+{
+    return bench_img_setup(ctx, &icon_rgb565);
+}
+
+static esp_err_t bench_img_rgb565a8_setup(bench_scene_ctx_t *ctx)
+{
+    return bench_img_setup(ctx, &icon_rgb565A8);
+}
+
+static esp_err_t bench_qrcode_setup(bench_scene_ctx_t *ctx)
+{
+    bench_qrcode_state_t *state = calloc(1, sizeof(bench_qrcode_state_t));
+    if (state == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->state = state;
+
+    uint16_t side = (ctx->h_res < ctx->v_res) ? ctx->h_res : ctx->v_res;
+    state->qrcode = gfx_qrcode_create(ctx->disp);
+    state->img = gfx_img_create(ctx->disp);
+    if (state->qrcode == NULL || state->img == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    gfx_qrcode_set_size(state->qrcode, side * 3 / 4);
+    gfx_qrcode_set_data(state->qrcode, "https://github.com/espressif2022/esp_emote_gfx");
+    gfx_obj_align(state->qrcode, GFX_ALIGN_CENTER, 0, 0);
+    gfx_img_set_src(state->img, (void *)&icon_rgb565A8);
+    return ESP_OK;
+}
+
+/** RGB565A8 icon sliding across the QR code; the code's colors flip every 16 frames */
+static void bench_qrcode_step(bench_scene_ctx_t *ctx, uint32_t frame)
+{
+    bench_qrcode_state_t *state = (bench_qrcode_state_t *)ctx->state;
+
+    if (frame % 16U == 0U) {
+        bool invert = (frame / 16U) & 1U;
+        gfx_qrcode_set_color(state->qrcode, invert ? GFX_COLOR_HEX(0xFFFFFF) : GFX_COLOR_HEX(0x000000));
+        gfx_qrcode_set_bg_color(state->qrcode, invert ? GFX_COLOR_HEX(0x000000) : GFX_COLOR_HEX(0xFFFFFF));
+    }
+    uint32_t range_x = (ctx->h_res > icon_rgb565A8.header.w) ? ctx->h_res - icon_rgb565A8.header.w : 0;
+    gfx_obj_set_pos(state->img, bench_bounce(frame * 4U, range_x), (gfx_coord_t)(ctx->v_res / 3));
+}
+
+static void bench_qrcode_teardown(bench_scene_ctx_t *ctx)
+{
+    bench_qrcode_state_t *state = (bench_qrcode_state_t *)ctx->state;
+
+    if (state == NULL) {
+        return;
+    }
+    if (state->img != NULL) {
+        gfx_obj_delete(state->img);
+    }
+    if (state->qrcode != NULL) {
+        gfx_obj_delete(state->qrcode);
+    }
+    free(state);
+    ctx->state = NULL;
+}
+
+static esp_err_t bench_motion_setup(bench_scene_ctx_t *ctx)
+{
+    bench_motion_state_t *state = calloc(1, sizeof(bench_motion_state_t));
+    esp_err_t ret;
+
+    if (state == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    ret = gfx_motion_player_init(&state->player, ctx->disp, &claw_motion_scene_asset);
+    if (ret != ESP_OK) {
+        free(state);
+        return ret;
+    }
+    ctx->state = state;
+    gfx_motion_player_set_canvas(&state->player, 0, 0, ctx->h_res, ctx->v_res);
+    return gfx_motion_player_set_action(&state->player, 0, true);
+}
+
+/** The player timer advances the pose on the bench's virtual clock; only switch actions here */
+static void bench_motion_step(bench_scene_ctx_t *ctx, uint32_t frame)
+{
+    bench_motion_state_t *state = (bench_motion_state_t *)ctx->state;
+
+    if (frame > 0 && frame % BENCH_MOTION_ACTION_FRAMES == 0) {
+        state->action = (uint16_t)((state->action + 1U) % CLAW_MOTION_ACTION_COUNT);
+        gfx_motion_player_set_action(&state->player, state->action, false);
+    }
+}
+
+static void bench_motion_teardown(bench_scene_ctx_t *ctx)
+{
+    bench_motion_state_t *state = (bench_motion_state_t *)ctx->state;
+
+    if (state == NULL) {
+        return;
+    }
+    gfx_motion_player_deinit(&state->player);
+    free(state);
+    ctx->state = NULL;
+}
+
+static gfx_obj_t *bench_label_create(bench_scene_ctx_t *ctx, uint16_t h, gfx_label_long_mode_t mode, uint32_t bg)
+{
+    gfx_obj_t *label = gfx_label_create(ctx->disp);
+
+    if (label == NULL) {
+        return NULL;
+    }
+    gfx_obj_set_size(label, ctx->h_res - 16, h);
+    gfx_label_set_font(label, (gfx_font_t)&font_dejavu_mono_14_4);
+    gfx_label_set_color(label, GFX_COLOR_HEX(0xFFFFFF));
+    gfx_label_set_bg_color(label, GFX_COLOR_HEX(bg));
+    gfx_label_set_bg_enable(label, true);
+    gfx_label_set_long_mode(label, mode);
+    return label;
+}
+
+static esp_err_t bench_label_setup(bench_scene_ctx_t *ctx)
+{
+    bench_label_state_t *state = calloc(1, sizeof(bench_label_state_t));
+    if (state == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    ctx->state = state;
+
+    uint16_t wrap_h = (ctx->v_res > 96) ? ctx->v_res - 96 : ctx->v_res / 2;
+    state->wrap = bench_label_create(ctx, wrap_h, GFX_LABEL_LONG_WRAP, 0x251B3A);
+    state->scroll = bench_label_create(ctx, 20, GFX_LABEL_LONG_SCROLL, 0x1D3A2D);
+    state->counter = bench_label_create(ctx, 20, GFX_LABEL_LONG_CLIP, 0x2C2C2C);
+    if (state->wrap == NULL || state->scroll == NULL || state->counter == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    gfx_label_set_text(state->wrap,
+                       "WRAP: The quick brown fox jumps over the lazy dog. "
+                       "Pack my box with five dozen liquor jugs. 0123456789 "
+                       "How vexingly quick daft zebras jump! {[(<>)]} #$%&*+=?@");
+    gfx_label_set_text(state->scroll,
+                       "SCROLL: glyph lookup, 4 bpp coverage and per-pixel blend on every frame ...");
+    gfx_label_set_scroll_speed(state->scroll, 20);
+    gfx_label_set_text_align(state->counter, GFX_TEXT_ALIGN_CENTER);
+    gfx_obj_align(state->wrap, GFX_ALIGN_TOP_MID, 0, 8);
+    gfx_obj_align(state->scroll, GFX_ALIGN_BOTTOM_MID, 0, -44);
+    gfx_obj_align(state->counter, GFX_ALIGN_BOTTOM_MID, 0, -12);
+    return ESP_OK;
+}
+
+/** Scroll runs on the label timer; the counter re-lays out its text and the wrap block recolors */
+static void bench_label_step(bench_scene_ctx_t *ctx, uint32_t frame)
+{
+    bench_label_state_t *state = (bench_label_state_t *)ctx->state;
+
+    gfx_label_set_text_fmt(state->counter, "frame %05" PRIu32, frame);
+    if (frame % BENCH_LABEL_TEXT_FRAMES == 0U) {
+        bool alt = (frame / BENCH_LABEL_TEXT_FRAMES) & 1U;
+        gfx_label_set_color(state->wrap, alt ? GFX_COLOR_HEX(0xF7D7FF) : GFX_COLOR_HEX(0xFFFFFF));
+    }
+}
+
+static void bench_label_teardown(bench_scene_ctx_t *ctx)
+{
+    bench_label_state_t *state = (bench_label_state_t *)ctx->state;
+
+    if (state == NULL) {
+        return;
+    }
+    if (state->counter != NULL) {
+        gfx_obj_delete(state->counter);
+    }
+    if (state->scroll != NULL) {
+        gfx_obj_delete(state->scroll);
+    }
+    if (state->wrap != NULL) {
+        gfx_obj_delete(state->wrap);
+    }
+    free(state);
+    ctx->state = NULL;
+}
+
+const bench_scene_t bench_scenes[] = {
+    { "img_rgb565",   bench_img_rgb565_setup,   bench_img_step,    bench_img_teardown },
+    { "img_rgb565a8", bench_img_rgb565a8_setup, bench_img_step,    bench_img_teardown },
+    { "qrcode",       bench_qrcode_setup,       bench_qrcode_step, bench_qrcode_teardown },
+    { "motion_claw",  bench_motion_setup,       bench_motion_step, bench_motion_teardown },
+    { "label",        bench_label_setup,        bench_label_step,  bench_label_teardown },
+};
+
+const size_t bench_scene_count = sizeof(bench_scenes) / sizeof(bench_scenes[0]);
@@ -0,0 +1,56 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "sdkconfig.h"
+#include "unity.h"
+#include "common.h"
+#include "bench/bench.h"
+
+static const char *TAG = "test_bench";
+
+#ifndef TEST_BENCH_FRAMES
+#define TEST_BENCH_FRAMES        300
+#endif
+#define TEST_BENCH_WARMUP_FRAMES 2
+#define TEST_BENCH_FRAME_MS      33
+
+/*
+ * Prints the JSON report between BENCH_REPORT_BEGIN / BENCH_REPORT_END; save the
+ * monitor log and pass it to scripts/bench_compare.py together with a baseline.
+ */
+static void test_bench_run(void)
+{
+    bench_config_t cfg = {
+        .frames = TEST_BENCH_FRAMES,
+        .warmup_frames = TEST_BENCH_WARMUP_FRAMES,
+        .frame_ms = TEST_BENCH_FRAME_MS,
+        .target = CONFIG_IDF_TARGET,
+    };
+    bench_result_t *results = calloc(bench_scene_count, sizeof(bench_result_t));
+
+    TEST_ASSERT_NOT_NULL(results);
+    TEST_ASSERT_NOT_NULL(disp_default);
+
+    for (size_t i = 0; i < bench_scene_count; i++) {
+        test_app_log_step(TAG, bench_scenes[i].name);
+        TEST_ASSERT_EQUAL(ESP_OK, bench_run_scene(&bench_scenes[i], emote_handle, disp_default, &cfg, &results[i]));
+    }
+
+    printf("%s\n", BENCH_REPORT_BEGIN);
+    bench_report_write(stdout, &cfg, disp_default, results, bench_scene_count);
+    printf("%s\n", BENCH_REPORT_END);
+    free(results);
+}
+
+TEST_CASE("bench: frame time over built-in scenes", "[bench]")
+{
+    test_app_runtime_t runtime;
+
+    TEST_ASSERT_EQUAL(ESP_OK, test_app_runtime_open(&runtime, TEST_APP_ASSETS_PARTITION_DEFAULT));
+    test_bench_run();
+    test_app_runtime_close(&runtime);
+}